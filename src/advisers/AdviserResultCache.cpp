@@ -0,0 +1,183 @@
+#include "advisers/AdviserResultCache.h"
+#include "support/Settings.h"
+#include "support/Utils.h"
+#include "support/Logger.h"
+
+#include <cstdint>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <thread>
+
+namespace OpenMagnetics {
+
+namespace {
+
+std::string fnv1a_hex(const std::string& text) {
+    uint64_t hash = 14695981039346656037ull;
+    for (unsigned char character : text) {
+        hash ^= character;
+        hash *= 1099511628211ull;
+    }
+    char buffer[17];
+    std::snprintf(buffer, sizeof(buffer), "%016llx", static_cast<unsigned long long>(hash));
+    return buffer;
+}
+
+std::filesystem::path entry_path(const std::string& directory, const std::string& hash) {
+    return std::filesystem::path(directory) / (hash + ".json");
+}
+
+std::optional<AdviserResultCache::Results> read_from_disk(const std::string& directory, const AdviserResultCache::Key& key) {
+    auto path = entry_path(directory, key.hash);
+    std::error_code error;
+    if (!std::filesystem::exists(path, error)) {
+        return std::nullopt;
+    }
+    try {
+        std::ifstream file(path);
+        json entry = json::parse(file);
+        if (entry.at("key").get<std::string>() != key.canonical) {
+            return std::nullopt;
+        }
+        AdviserResultCache::Results results;
+        for (auto& result : entry.at("results")) {
+            Mas mas;
+            from_json(result.at("mas"), mas);
+            results.emplace_back(std::move(mas), result.at("scoring").get<double>());
+        }
+        return results;
+    }
+    catch (const std::exception& e) {
+        OM_WARNING_M("AdviserResultCache", "Ignoring unreadable cache entry " + path.string() + ": " + e.what());
+        return std::nullopt;
+    }
+}
+
+void write_to_disk(const std::string& directory, const AdviserResultCache::Key& key, const AdviserResultCache::Results& results) {
+    try {
+        std::filesystem::create_directories(directory);
+        json entry;
+        entry["key"] = key.canonical;
+        entry["results"] = json::array();
+        for (auto& [mas, scoring] : results) {
+            json result;
+            to_json(result["mas"], mas);
+            result["scoring"] = scoring;
+            entry["results"].push_back(std::move(result));
+        }
+        // Write-then-rename, so a concurrent reader in another process sees
+        // either the old file or the complete new one.
+        auto path = entry_path(directory, key.hash);
+        std::ostringstream suffix;
+        suffix << ".tmp" << std::hash<std::thread::id>{}(std::this_thread::get_id());
+        auto temporaryPath = path;
+        temporaryPath += suffix.str();
+        {
+            std::ofstream file(temporaryPath);
+            file << entry;
+        }
+        std::filesystem::rename(temporaryPath, path);
+    }
+    catch (const std::exception& e) {
+        OM_WARNING_M("AdviserResultCache", std::string("Could not persist cache entry: ") + e.what());
+    }
+}
+
+} // namespace
+
+AdviserResultCache& AdviserResultCache::instance() {
+    static AdviserResultCache cache;
+    return cache;
+}
+
+bool AdviserResultCache::enabled() {
+    auto& settings = Settings::GetInstance();
+    return settings.get_adviser_result_cache_size() > 0 || settings.get_adviser_result_cache_directory().has_value();
+}
+
+AdviserResultCache::Key AdviserResultCache::make_key(const json& request) {
+    json canonical;
+    canonical["request"] = request;
+    canonical["settings"] = Settings::GetInstance().get_fingerprint();
+    Key key;
+    if (auto digest = get_databases_digest()) {
+        canonical["databases"] = digest.value();
+        key.persistent = true;
+    }
+    else {
+        // Only meaningful inside this process: kept out of the disk tier.
+        canonical["databasesGeneration"] = get_databases_generation();
+        key.persistent = false;
+    }
+    key.canonical = canonical.dump();
+    key.hash = fnv1a_hex(key.canonical);
+    return key;
+}
+
+std::optional<AdviserResultCache::Results> AdviserResultCache::read(const Key& key) {
+    auto& settings = Settings::GetInstance();
+    size_t capacity = settings.get_adviser_result_cache_size();
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        auto entry = _entries.find(key.hash);
+        if (entry != _entries.end() && entry->second.canonical == key.canonical) {
+            _recency.splice(_recency.begin(), _recency, entry->second.position);
+            return entry->second.results;
+        }
+    }
+
+    auto directory = settings.get_adviser_result_cache_directory();
+    if (!directory || !key.persistent) {
+        return std::nullopt;
+    }
+    auto results = read_from_disk(directory.value(), key);
+    if (results) {
+        std::lock_guard<std::mutex> lock(_mutex);
+        insert(key.hash, key.canonical, results.value(), capacity);
+    }
+    return results;
+}
+
+void AdviserResultCache::store(const Key& key, const Results& results) {
+    auto& settings = Settings::GetInstance();
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        insert(key.hash, key.canonical, results, settings.get_adviser_result_cache_size());
+    }
+    auto directory = settings.get_adviser_result_cache_directory();
+    if (directory && key.persistent) {
+        write_to_disk(directory.value(), key, results);
+    }
+}
+
+void AdviserResultCache::insert(const std::string& hash, const std::string& canonical, const Results& results, size_t capacity) {
+    auto existing = _entries.find(hash);
+    if (existing != _entries.end()) {
+        _recency.erase(existing->second.position);
+        _entries.erase(existing);
+    }
+    if (capacity == 0) {
+        return;
+    }
+    while (_entries.size() >= capacity) {
+        _entries.erase(_recency.back());
+        _recency.pop_back();
+    }
+    _recency.push_front(hash);
+    _entries.emplace(hash, Entry{canonical, results, _recency.begin()});
+}
+
+void AdviserResultCache::clear() {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _entries.clear();
+    _recency.clear();
+}
+
+size_t AdviserResultCache::size() {
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _entries.size();
+}
+
+} // namespace OpenMagnetics
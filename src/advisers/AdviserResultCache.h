@@ -0,0 +1,85 @@
+#pragma once
+#include "constructive_models/Mas.h"
+#include "Definitions.h"
+
+#include <cstddef>
+#include <list>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace OpenMagnetics {
+
+// Content-addressed memo of MagneticAdviser::get_advised_magnetic() results,
+// for services that receive the same specification over and over.
+//
+// KEY: make_key() takes the request as the adviser canonicalises it (the
+// processed Inputs, the filter flow with its weights, the adviser's own
+// options) and adds Settings::get_fingerprint() and get_databases_digest(),
+// which names the catalogue contents the same way in every process. After an
+// in-place catalogue edit the digest is unknown and get_databases_generation()
+// stands in for it; such keys are not persistent, as the generation only means
+// something inside this process. The canonical string is hashed (FNV-1a, 64
+// bit, stable across platforms so it can name files); the full string is
+// stored with every entry and compared on lookup, so a hash collision is a
+// miss, never a wrong answer.
+//
+// TIERS:
+//   * In-process LRU of Settings::get_adviser_result_cache_size() entries.
+//     SHARED between threads and guarded by a mutex; reads return copies.
+//   * When Settings::get_adviser_result_cache_directory() is set, one JSON
+//     file per key in that directory, consulted on an LRU miss and promoted
+//     into the LRU. Unreadable or foreign files are treated as misses. Only
+//     persistent keys use this tier.
+//
+// INVALIDATION: loading different catalogue data changes the digest (or the
+// generation), so keys made before it can never match again; their entries
+// age out of the LRU, and their files stay behind unused.
+// Tiers are bypassed by the adviser whenever the result would depend on
+// something the key does not capture (a LibraryContext scope, a truncated
+// search).
+class AdviserResultCache {
+    public:
+        using Results = std::vector<std::pair<Mas, double>>;
+
+        struct Key {
+            std::string hash;
+            std::string canonical;
+            // False when the key names the catalogues by generation: the
+            // entry stays in the in-process tier.
+            bool persistent = false;
+        };
+
+        static AdviserResultCache& instance();
+
+        // True when either tier is configured in the calling thread's Settings.
+        static bool enabled();
+        static Key make_key(const json& request);
+
+        std::optional<Results> read(const Key& key);
+        void store(const Key& key, const Results& results);
+
+        // Drops the in-process tier. Files in the cache directory are left alone.
+        void clear();
+        size_t size();
+
+    private:
+        AdviserResultCache() = default;
+
+        struct Entry {
+            std::string canonical;
+            Results results;
+            std::list<std::string>::iterator position;
+        };
+
+        void insert(const std::string& hash, const std::string& canonical, const Results& results, size_t capacity);
+
+        std::mutex _mutex;
+        std::list<std::string> _recency;  // most recently used first
+        std::unordered_map<std::string, Entry> _entries;
+};
+
+} // namespace OpenMagnetics
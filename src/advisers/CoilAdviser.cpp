@@ -327,7 +327,7 @@ namespace OpenMagnetics {
             }
         }
         if (invalidCount > 0) {
-            logEntry("Filtered out " + std::to_string(invalidCount) + " invalid designs out of " + std::to_string(masMagnetics.size()), "CoilAdviser", 2);
+            logEntry([&] { return "Filtered out " + std::to_string(invalidCount) + " invalid designs out of " + std::to_string(masMagnetics.size()); }, "CoilAdviser", 2);
         }
         return validMasMagneticsWithScoring;
     }
@@ -464,7 +464,7 @@ namespace OpenMagnetics {
 
         
         size_t maximumNumberResultsPerPattern = std::max(2.0, ceil(static_cast<double>(maximumNumberResults) / (patterns.size() * repetitions.size())));
-        logEntry("Trying " + std::to_string(repetitions.size()) + " repetitions and " + std::to_string(patterns.size()) + " patterns", "CoilAdviser");
+        logEntry([&] { return "Trying " + std::to_string(repetitions.size()) + " repetitions and " + std::to_string(patterns.size()) + " patterns"; }, "CoilAdviser");
 
         // Early-termination cap. For multi-winding coils (Flyback, LLC,
         // Push-Pull, IBB, Vienna, Weinberg…) the patterns × repetitions ×
@@ -486,6 +486,11 @@ namespace OpenMagnetics {
             if (earlyTerminated) break;
             for (auto pattern : patterns) {
                 if (earlyTerminated) break;
+                if (_stopCondition.should_stop()) {
+                    logEntry([&] { return "CoilAdviser: stop requested after " + std::to_string(masesWithCoil.size()) + " candidates"; }, "CoilAdviser");
+                    earlyTerminated = true;
+                    break;
+                }
                 auto aux = mas.get_mutable_magnetic().get_mutable_coil().check_pattern_and_repetitions_integrity(pattern, repetition);
                 pattern = aux.first;
                 repetition = aux.second;
@@ -524,8 +529,8 @@ namespace OpenMagnetics {
 
                         std::move(resultsPerPattern.begin(), resultsPerPattern.end(), std::back_inserter(masesWithCoil));
                         if (masesWithCoil.size() >= earlyTerminationCap) {
-                            logEntry("CoilAdviser early-terminating: " + std::to_string(masesWithCoil.size()) +
-                                     " candidates (cap=" + std::to_string(earlyTerminationCap) + ")", "CoilAdviser");
+                            logEntry([&] { return "CoilAdviser early-terminating: " + std::to_string(masesWithCoil.size()) +
+                                     " candidates (cap=" + std::to_string(earlyTerminationCap) + ")"; }, "CoilAdviser");
                             earlyTerminated = true;
                             break;
                         }
@@ -543,8 +548,8 @@ namespace OpenMagnetics {
                     auto resultsPerPattern = get_advised_planar_coil_for_pattern(wires, mas, pattern, repetition, maximumNumberResultsPerPattern, reference);
                     std::move(resultsPerPattern.begin(), resultsPerPattern.end(), std::back_inserter(masesWithCoil));
                     if (masesWithCoil.size() >= earlyTerminationCap) {
-                        logEntry("CoilAdviser early-terminating (planar): " + std::to_string(masesWithCoil.size()) +
-                                 " candidates (cap=" + std::to_string(earlyTerminationCap) + ")", "CoilAdviser");
+                        logEntry([&] { return "CoilAdviser early-terminating (planar): " + std::to_string(masesWithCoil.size()) +
+                                 " candidates (cap=" + std::to_string(earlyTerminationCap) + ")"; }, "CoilAdviser");
                         earlyTerminated = true;
                         break;
                     }
@@ -558,7 +563,7 @@ namespace OpenMagnetics {
         // wanted (integrated-leakage designs). Fully gated behind the setting; the
         // candidates run through the same wire/insulation/winding/scoring flow, and
         // their leakage/coupling comes from the per-column reluctance network.
-        if (settings.get_coil_adviser_allow_lateral_placement() && !isCmc && !isDmcMultiWinding &&
+        if (settings.get_coil_adviser_allow_lateral_placement() && !isCmc && !isDmcMultiWinding && !_stopCondition.should_stop() &&
             coreType == CoreType::TWO_PIECE_SET &&
             mas.get_magnetic().get_coil().get_functional_description().size() == 2 &&
             mas.get_mutable_inputs().get_wiring_technology() == WiringTechnology::WOUND) {
@@ -609,11 +614,11 @@ namespace OpenMagnetics {
                                                                        maximumNumberResultsPerPattern, reference);
                     std::move(lateralResults.begin(), lateralResults.end(), std::back_inserter(masesWithCoil));
                 }
-                logEntry("Lateral-placement pass produced " + std::to_string(masesWithCoil.size()) + " total candidates", "CoilAdviser");
+                logEntry([&] { return "Lateral-placement pass produced " + std::to_string(masesWithCoil.size()) + " total candidates"; }, "CoilAdviser");
             }
         }
 
-        logEntry("Found " + std::to_string(masesWithCoil.size()) + " magnetics", "CoilAdviser");
+        logEntry([&] { return "Found " + std::to_string(masesWithCoil.size()) + " magnetics"; }, "CoilAdviser");
         std::vector<std::pair<Mas, double>> invalidMagneticsWithScoring;
         auto masMagneticsWithScoring = score_magnetics(masesWithCoil, _loadedFilterFlow, &invalidMagneticsWithScoring);
 
@@ -629,8 +634,8 @@ namespace OpenMagnetics {
         // Fallback: If all designs were filtered out but we had valid windings,
         // return the best-scored of the FAILED designs, clearly marked as such.
         if (masesWithoutScoring.empty() && !invalidMagneticsWithScoring.empty()) {
-            logEntry("WARNING: All " + std::to_string(masesWithCoil.size()) + " designs were filtered out by criteria. " +
-                     "Returning best-scored designs marked INVALID as fallback.", "CoilAdviser", 1);
+            logEntry([&] { return "WARNING: All " + std::to_string(masesWithCoil.size()) + " designs were filtered out by criteria. " +
+                     "Returning best-scored designs marked INVALID as fallback."; }, "CoilAdviser", 1);
 
             stable_sort(invalidMagneticsWithScoring.begin(), invalidMagneticsWithScoring.end(), [](const std::pair<Mas, double>& b1, const std::pair<Mas, double>& b2) {
                 return b1.second > b2.second;
@@ -708,7 +713,7 @@ namespace OpenMagnetics {
                 }
             }
             _lastNoResultsReason = reason;
-            logEntry("WARNING: " + reason, "CoilAdviser", 1);
+            logEntry([&] { return "WARNING: " + reason; }, "CoilAdviser", 1);
         }
 
         return masesWithoutScoring;
@@ -855,10 +860,10 @@ namespace OpenMagnetics {
                     
                     // Log suggestion for thick copper at high frequency
                     if (wireHeight > 4.0 * optimalCopperThickness) {
-                        logEntry("Skin depth optimization: Winding " + std::to_string(windingIndex) + 
+                        logEntry([&] { return "Skin depth optimization: Winding " + std::to_string(windingIndex) + 
                                  " copper (" + std::to_string(wireHeight * 1e6) + " µm) is " +
                                  std::to_string(wireHeight / optimalCopperThickness) + "× optimal thickness (" +
-                                 std::to_string(optimalCopperThickness * 1e6) + " µm). Consider thinner copper.",
+                                 std::to_string(optimalCopperThickness * 1e6) + " µm). Consider thinner copper."; },
                                  "CoilAdviser", 2);
                     }
                 }
@@ -1092,7 +1097,7 @@ namespace OpenMagnetics {
                 {{"maximumEffectiveCurrentDensity", defaults.maximumEffectiveCurrentDensity * 2}, {"maximumNumberParallels", defaults.maximumNumberParallels}},
                 {{"maximumEffectiveCurrentDensity", defaults.maximumEffectiveCurrentDensity * 2}, {"maximumNumberParallels", defaults.maximumNumberParallels * 2}}
             };
-            logEntry("Trying " + std::to_string(wireConfigurations.size()) + " wire configurations", "CoilAdviser", 2);
+            logEntry([&] { return "Trying " + std::to_string(wireConfigurations.size()) + " wire configurations"; }, "CoilAdviser", 2);
 
             // wound_with windings (e.g. center-tapped LLC half-secondaries)
             // are virtualized into the same section as their partner, so the
@@ -1132,7 +1137,7 @@ namespace OpenMagnetics {
             for (auto& wireConfiguration : wireConfigurations) {
                 _wireAdviser.set_maximum_effective_current_density(wireConfiguration["maximumEffectiveCurrentDensity"]);
                 _wireAdviser.set_maximum_number_parallels(wireConfiguration["maximumNumberParallels"]);
-                logEntry("Trying wires with a current density of " + std::to_string(wireConfiguration["maximumEffectiveCurrentDensity"]) + " and " + std::to_string(wireConfiguration["maximumNumberParallels"]) + " maximum parallels", "CoilAdviser", 3);
+                logEntry([&] { return "Trying wires with a current density of " + std::to_string(wireConfiguration["maximumEffectiveCurrentDensity"]) + " and " + std::to_string(wireConfiguration["maximumNumberParallels"]) + " maximum parallels"; }, "CoilAdviser", 3);
 
                 auto sectionIndex = coil.convert_conduction_section_index_to_global(conductionSectionIndex);
 
@@ -1181,7 +1186,7 @@ namespace OpenMagnetics {
             _diagnosisWireCandidates += wireCoilPerWinding[windingIndex].size();
         }
 
-        logEntry("Trying to wind " + std::to_string(wireCoilPerWinding[0].size()) + " coil possibilities", "CoilAdviser");
+        logEntry([&] { return "Trying to wind " + std::to_string(wireCoilPerWinding[0].size()) + " coil possibilities"; }, "CoilAdviser");
                     mas.get_mutable_magnetic().set_coil(coil);
 
         auto currentWireIndexPerWinding = std::vector<size_t>(numberWindings, 0);
@@ -1392,7 +1397,7 @@ namespace OpenMagnetics {
                 break;
             }
             timeout--;
-            if (timeout == 0) {
+            if (timeout == 0 || _stopCondition.should_stop()) {
                 break;
             }
             // B18 FIX: score-guided wire advancement (advance winding with worst wire score)
@@ -1420,7 +1425,7 @@ namespace OpenMagnetics {
             if (!anyAdvanceable) break; // COA-BUG-1 FIX: all windings exhausted
             currentWireIndexPerWinding[lowestIndex]++;
         }
-        logEntry("Managed to wind " + std::to_string(masesWithCoil.size()) + " coils", "CoilAdviser");
+        logEntry([&] { return "Managed to wind " + std::to_string(masesWithCoil.size()) + " coils"; }, "CoilAdviser");
 
         return masesWithCoil;
     }
@@ -1521,14 +1526,14 @@ namespace OpenMagnetics {
                 {{"maximumEffectiveCurrentDensity", defaults.maximumEffectiveCurrentDensity * 2}, {"maximumNumberParallels", defaults.maximumNumberParallels}},
                 {{"maximumEffectiveCurrentDensity", defaults.maximumEffectiveCurrentDensity * 2}, {"maximumNumberParallels", defaults.maximumNumberParallels * 2}}
             };
-            logEntry("Trying " + std::to_string(wireConfigurations.size()) + " wire configurations", "CoilAdviser", 2);
+            logEntry([&] { return "Trying " + std::to_string(wireConfigurations.size()) + " wire configurations"; }, "CoilAdviser", 2);
 
             wireCoilPerWinding.push_back(std::vector<std::pair<Winding, double>>{});
 
             for (auto& wireConfiguration : wireConfigurations) {
                 _wireAdviser.set_maximum_effective_current_density(wireConfiguration["maximumEffectiveCurrentDensity"]);
                 _wireAdviser.set_maximum_number_parallels(wireConfiguration["maximumNumberParallels"]);
-                logEntry("Trying planar wires with a current density of " + std::to_string(wireConfiguration["maximumEffectiveCurrentDensity"]) + " and " + std::to_string(wireConfiguration["maximumNumberParallels"]) + " maximum parallels", "CoilAdviser", 3);
+                logEntry([&] { return "Trying planar wires with a current density of " + std::to_string(wireConfiguration["maximumEffectiveCurrentDensity"]) + " and " + std::to_string(wireConfiguration["maximumNumberParallels"]) + " maximum parallels"; }, "CoilAdviser", 3);
 
                 auto wiresWithScoring = _wireAdviser.get_advised_planar_wire(coil.get_functional_description()[windingIndex],
                                                                              sections[sectionIndex],
@@ -1553,10 +1558,10 @@ namespace OpenMagnetics {
                 }
             }
             if (!found) {
-                logEntry("No planar wires found for winding " + std::to_string(windingIndex), "CoilAdviser", 2);
+                logEntry([&] { return "No planar wires found for winding " + std::to_string(windingIndex); }, "CoilAdviser", 2);
             }
             else {
-                logEntry("Found " + std::to_string(wireCoilPerWinding.back().size()) + " planar wire options for winding " + std::to_string(windingIndex), "CoilAdviser", 2);
+                logEntry([&] { return "Found " + std::to_string(wireCoilPerWinding.back().size()) + " planar wire options for winding " + std::to_string(windingIndex); }, "CoilAdviser", 2);
             }
 
         }
@@ -1570,7 +1575,7 @@ namespace OpenMagnetics {
             }
         }
 
-        logEntry("Trying to wind " + std::to_string(wireCoilPerWinding[0].size()) + " coil possibilities", "CoilAdviser");
+        logEntry([&] { return "Trying to wind " + std::to_string(wireCoilPerWinding[0].size()) + " coil possibilities"; }, "CoilAdviser");
         mas.get_mutable_magnetic().set_coil(coil);
 
         auto currentWireIndexPerWinding = std::vector<size_t>(numberWindings, 0);
@@ -1647,10 +1652,10 @@ namespace OpenMagnetics {
                                     (sections[sIdx].get_dimensions()[1] +
                                      sections[sIdx+1].get_dimensions()[1]) / 2.0;
                                 if (spacing < requiredClearance) {
-                                    logEntry("B19: planar clearance " +
+                                    logEntry([&] { return "B19: planar clearance " +
                                         std::to_string(spacing * 1e3) + " mm < required " +
                                         std::to_string(requiredClearance * 1e3) +
-                                        " mm — skipping", "CoilAdviser", 2);
+                                        " mm — skipping"; }, "CoilAdviser", 2);
                                     planarClearanceViolated = true; // skip this wire combination
                                     break;
                                 }
@@ -1689,7 +1694,7 @@ namespace OpenMagnetics {
                 }
             }
             timeout--;
-            if (timeout == 0) {
+            if (timeout == 0 || _stopCondition.should_stop()) {
                 break;
             }
             // B18 FIX: score-guided wire advancement (advance winding with worst wire score)
@@ -1717,7 +1722,7 @@ namespace OpenMagnetics {
             if (!anyAdvanceable) break; // COA-BUG-1 FIX: all windings exhausted
             currentWireIndexPerWinding[lowestIndex]++;
         }
-        logEntry("Managed to wind " + std::to_string(masesWithCoil.size()) + " coils", "CoilAdviser");
+        logEntry([&] { return "Managed to wind " + std::to_string(masesWithCoil.size()) + " coils"; }, "CoilAdviser");
 
         return masesWithCoil;
 
@@ -3,6 +3,7 @@
 #include "advisers/WireAdviser.h"
 #include "constructive_models/Coil.h"
 #include "constructive_models/Mas.h"
+#include "support/Cancellation.h"
 #include "support/Utils.h"
 #include <MAS.hpp>
 #include <limits>
@@ -105,6 +106,9 @@ class CoilAdviser : public WireAdviser {
         // MagneticAdviser no longer has to swap the process-shared wireDatabase
         // to honour a wireType constraint. Empty => no additional pruning.
         AdviserConstraints _wireConstraints;
+        // Checked between wire combinations and patterns: once it fires, the
+        // coils wound so far are scored and returned.
+        StopCondition _stopCondition;
         std::map<MagneticFilters, std::shared_ptr<MagneticFilter>> _filters;
         std::vector<MagneticFilterOperation> _loadedFilterFlow;
         OpenMagnetics::WireAdviser _wireAdviser;
@@ -159,6 +163,9 @@ class CoilAdviser : public WireAdviser {
         void set_wire_constraints(const AdviserConstraints& constraints) {
             _wireConstraints = constraints;
         }
+        void set_stop_condition(const StopCondition& stopCondition) {
+            _stopCondition = stopCondition;
+        }
         void set_common_wire_standard(std::optional<WireStandard> commonWireStandard) {
             _commonWireStandard = commonWireStandard;
         }
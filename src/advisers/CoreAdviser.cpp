@@ -94,6 +94,10 @@ void CoreAdviser::set_weights(std::map<CoreAdviserFilters, double> weights) {
     _weights = weights;
 }
 
+void CoreAdviser::set_stop_condition(const StopCondition& stopCondition) {
+    _stopCondition = stopCondition;
+}
+
 std::map<std::string, std::map<CoreAdviser::CoreAdviserFilters, double>> CoreAdviser::get_scorings(bool weighted){
     std::map<std::string, std::map<CoreAdviser::CoreAdviserFilters, double>> swappedScorings;
     for (auto& [filter, aux] : _scorings) {
@@ -377,7 +381,7 @@ std::vector<std::pair<Mas, double>> CoreAdviser::get_advised_core(Inputs inputs,
             expand_magnetic_dataset_with_stacks(inputs, cores, &magnetics);
         }
 
-        logEntry("First attempt produced not enough results, so now we are searching again with " + std::to_string(magnetics.size()) + " magnetics, including up to " + std::to_string(defaults.coreAdviserMaximumNumberStacks) + " cores stacked when possible.", "CoreAdviser");
+        logEntry([&] { return "First attempt produced not enough results, so now we are searching again with " + std::to_string(magnetics.size()) + " magnetics, including up to " + std::to_string(defaults.coreAdviserMaximumNumberStacks) + " cores stacked when possible."; }, "CoreAdviser");
         maximumMagneticsAfterFiltering = magnetics.size();
         filteredMagnetics = filter_available_cores_power_application(&magnetics, inputs, weights, maximumMagneticsAfterFiltering, maximumNumberResults);
         return filteredMagnetics;
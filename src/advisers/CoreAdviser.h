@@ -14,6 +14,7 @@
 #include "constructive_models/Mas.h"
 #include <cmath>
 #include <MAS.hpp>
+#include "support/Cancellation.h"
 #include "support/Exceptions.h"
 #include "support/LibraryContext.h"
 
@@ -130,6 +131,7 @@ class CoreAdviser {
         WindingOhmicLosses _windingOhmicLosses;
         MAS::MagneticApplication _application = MAS::MagneticApplication::POWER;
         CoreAdviserModes _mode = CoreAdviserModes::STANDARD_CORES;
+        StopCondition _stopCondition;
 
 
     public:
@@ -182,6 +184,9 @@ class CoreAdviser {
         void set_mode(CoreAdviserModes value);
         CoreAdviserModes get_mode();
         void set_weights(std::map<CoreAdviserFilters, double> weights);
+        // Checked between post-processed candidates: once it fires, the cores
+        // post-processed so far are returned.
+        void set_stop_condition(const StopCondition& stopCondition);
 
         /**
          * @brief Main entry point for core recommendation.
@@ -263,7 +268,7 @@ class CoreAdviser {
          * @param core Core with material properties.
          * @return Total core losses in Watts.
          */
-        double calculate_core_losses_for_gap(double gap, Inputs inputs, Core core);
+        double calculate_core_losses_for_gap(double gap, Inputs inputs, Core core, const std::shared_ptr<CoreLossesModel>& coreLossesModel);
 
         /**
          * @brief Get peak current from inputs for saturation calculations.
@@ -755,12 +755,14 @@ void add_initial_turns_by_inductance(std::vector<std::pair<Magnetic, double>> *m
                     if (seededIsat && seededIsat.value() > 0 && seededIsat.value() < requiredIsat) {
                         Inputs lmInputs;
                         lmInputs.set_design_requirements(inputs.get_design_requirements());
+                        // Successive N on the same core: each re-gap starts from the last one.
+                        MagnetizingInductanceSolverState regapState;
                         auto regapAndIsat = [&](double n, Core& outCore) -> std::optional<double> {
                             Coil tempCoil = (*magneticsWithScoring)[i].first.get_coil();
                             tempCoil.get_mutable_functional_description()[0].set_number_turns(static_cast<int64_t>(std::llround(n)));
                             outCore = core;
                             try {
-                                auto gaps = magnetizingInductance.calculate_gapping_from_number_turns_and_inductance(outCore, tempCoil, &lmInputs, GappingType::GROUND);
+                                auto gaps = magnetizingInductance.calculate_gapping_from_number_turns_and_inductance(outCore, tempCoil, &lmInputs, GappingType::GROUND, 4, &regapState);
                                 if (gaps.empty()) return std::nullopt;
                                 outCore.set_gapping(gaps);
                                 outCore.process_gap();
@@ -67,7 +67,7 @@ evaluate_and_cull(std::vector<std::pair<Magnetic, double>>* unfilteredMagnetics,
             scoring = evalResult.second;
         }
         catch (const OpenMagneticsException& e) {
-            logEntry(std::string("CoreAdviser ") + filterName + ": culling infeasible candidate — " + e.what(),
+            logEntry([&] { return std::string("CoreAdviser ") + filterName + ": culling infeasible candidate — " + e.what(); },
                      "CoreAdviser", 2);
             valid = false;
         }
@@ -226,8 +226,8 @@ std::vector<std::pair<Magnetic, double>> CoreAdviser::MagneticCoreFilterLosses::
         !(*unfilteredMagnetics).empty() &&
         (*unfilteredMagnetics)[0].first.get_coil().get_functional_description().size() !=
             inputs.get_operating_points()[0].get_excitations_per_winding().size()) {
-        logEntry("Losses filter cannot score multi-winding inputs against single-winding candidate coils; passing " +
-                     std::to_string((*unfilteredMagnetics).size()) + " candidates through unscored",
+        logEntry([&] { return "Losses filter cannot score multi-winding inputs against single-winding candidate coils; passing " +
+                     std::to_string((*unfilteredMagnetics).size()) + " candidates through unscored"; },
                  "CoreAdviser");
         return *unfilteredMagnetics;
     }
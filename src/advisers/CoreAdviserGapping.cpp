@@ -121,9 +121,9 @@ CoreAdviser::GappingConstraints CoreAdviser::calculate_gapping_constraints(Input
             // optimizer work on DBL_MAX poison values (which it used to
             // silently receive from calculate_core_losses_for_gap). This
             // fallback is named, logged, and bounded — not a hidden default.
-            logEntry(std::string("Golden-section gap optimization failed (")
+            logEntry([&] { return std::string("Golden-section gap optimization failed (")
                      + e.what() + "), falling back to SIMPLE strategy for core "
-                     + core.get_name().value_or("unnamed"), "CoreAdviser");
+                     + core.get_name().value_or("unnamed"); }, "CoreAdviser");
             constraints.optimalGap = effectiveMinGap;
         }
     } else {
@@ -186,7 +186,7 @@ double CoreAdviser::get_peak_current(Inputs inputs) {
     return peakCurrent;
 }
 
-double CoreAdviser::calculate_core_losses_for_gap(double gap, Inputs inputs, Core core) {
+double CoreAdviser::calculate_core_losses_for_gap(double gap, Inputs inputs, Core core, const std::shared_ptr<CoreLossesModel>& coreLossesModel) {
     // Phase 1 fix: previously wrapped in `try { ... } catch (const std::exception&)
     // { return DBL_MAX; }`, which silently turned uncomputable losses into a
     // "very high loss" signal that contaminated the golden-section optimizer
@@ -204,9 +204,6 @@ double CoreAdviser::calculate_core_losses_for_gap(double gap, Inputs inputs, Cor
             "gap does not fit the winding column"));
     }
 
-    auto coreLossesModel = CoreLossesModel::factory(
-        std::map<std::string, std::string>({{"coreLosses", "Steinmetz"}}));
-
     double totalLosses = 0.0;
     for (auto& op : inputs.get_operating_points()) {
         auto excitation = Inputs::get_primary_excitation(op);
@@ -230,8 +227,11 @@ double CoreAdviser::optimize_gap_golden_section(double minGap, double maxGap, In
     double c = a + RESPHI * (b - a);
     double d = b - RESPHI * (b - a);
 
-    double fc = calculate_core_losses_for_gap(c, inputs, core);
-    double fd = calculate_core_losses_for_gap(d, inputs, core);
+    // One model for every probe of this search, not one per probe.
+    auto coreLossesModel = CoreLossesModel::factory(CoreLossesModels::STEINMETZ);
+
+    double fc = calculate_core_losses_for_gap(c, inputs, core, coreLossesModel);
+    double fd = calculate_core_losses_for_gap(d, inputs, core, coreLossesModel);
 
     for (int i = 0; i < MAX_ITERATIONS && (b - a) > 1e-6; ++i) {
         if (fc < fd) {
@@ -240,14 +240,14 @@ double CoreAdviser::optimize_gap_golden_section(double minGap, double maxGap, In
             d = c;
             fd = fc;
             c = a + RESPHI * (b - a);
-            fc = calculate_core_losses_for_gap(c, inputs, core);
+            fc = calculate_core_losses_for_gap(c, inputs, core, coreLossesModel);
         } else {
             // Minimum is in [c, b]
             a = c;
             c = d;
             fc = fd;
             d = b - RESPHI * (b - a);
-            fd = calculate_core_losses_for_gap(d, inputs, core);
+            fd = calculate_core_losses_for_gap(d, inputs, core, coreLossesModel);
         }
     }
 
@@ -343,18 +343,18 @@ void CoreAdviser::add_gapping_standard_cores(std::vector<std::pair<Magnetic, dou
             constraints = calculate_gapping_constraints(inputs, core);
         }
         catch (const GapException& e) {
-            logEntry("Rejecting core '" + core.get_name().value_or("?")
-                     + "': gap-infeasible while sizing: " + std::string(e.what()),
+            logEntry([&] { return "Rejecting core '" + core.get_name().value_or("?")
+                     + "': gap-infeasible while sizing: " + std::string(e.what()); },
                      "CoreAdviser", 2);
             gapInfeasibleIndexes.push_back(i);
             continue;
         }
 
-        logEntry("Gap: core=" + core.get_name().value_or("?")
+        logEntry([&] { return "Gap: core=" + core.get_name().value_or("?")
                  + " minGap=" + std::to_string(constraints.minGap)
                  + " maxGap=" + std::to_string(constraints.maxGap)
                  + " optGap=" + std::to_string(constraints.optimalGap)
-                 + " peakI=" + std::to_string(get_peak_current(inputs)),
+                 + " peakI=" + std::to_string(get_peak_current(inputs)); },
                  "CoreAdviser");
 
         // Apply the optimal gap
@@ -365,8 +365,8 @@ void CoreAdviser::add_gapping_standard_cores(std::vector<std::pair<Magnetic, dou
         // (process_gap_or_throw escaping from the inductance filter aborted whole Heaviside
         // design sweeps: one bad candidate cost every good one behind it).
         if (!core.process_gap()) {
-            logEntry("Rejecting core '" + core.get_name().value_or("?") + "': "
-                     + core.get_last_gap_processing_failure().value_or("gap does not fit the winding column"),
+            logEntry([&] { return "Rejecting core '" + core.get_name().value_or("?") + "': "
+                     + core.get_last_gap_processing_failure().value_or("gap does not fit the winding column"); },
                      "CoreAdviser", 2);
             gapInfeasibleIndexes.push_back(i);
             continue;
@@ -449,21 +449,21 @@ void CoreAdviser::reject_winding_killing_gaps(std::vector<std::pair<Magnetic, do
     // looser ceiling, which still cuts the genuinely catastrophic gaps. Always
     // logged so the relaxation is visible.
     if (kept.empty() && before > 0) {
-        logEntry("Post-gap fringing guard: all " + std::to_string(before) +
+        logEntry([&] { return "Post-gap fringing guard: all " + std::to_string(before) +
                  " candidate(s) exceeded the strict fringing-factor limit (" +
                  std::to_string(defaults.coreAdviserWindingKillingFringingFactorLimit) +
                  "); relaxing to " +
                  std::to_string(defaults.coreAdviserWindingKillingFringingFactorLimitRelaxed) +
-                 " to avoid returning zero cores.",
+                 " to avoid returning zero cores."; },
                  "CoreAdviser", 0);
         kept = filterAtLimit(defaults.coreAdviserWindingKillingFringingFactorLimitRelaxed);
     }
 
     if (kept.size() < before) {
-        logEntry("Post-gap fringing guard rejected "
+        logEntry([&] { return "Post-gap fringing guard rejected "
                  + std::to_string(before - kept.size())
                  + " core(s) whose finalized gap exceeded the fringing-factor limit "
-                   "(winding/proximity-loss risk).",
+                   "(winding/proximity-loss risk)."; },
                  "CoreAdviser");
     }
     *magneticsWithScoring = std::move(kept);
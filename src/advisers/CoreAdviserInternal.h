@@ -66,10 +66,12 @@ struct CoreLossesModelPair {
     std::shared_ptr<CoreLossesModel> steinmetz;
     std::shared_ptr<CoreLossesModel> proprietary;
 };
+// The tabulated surfaces outlive the call (CoreLossesTabulatedModel::get_shared),
+// so repeated material rankings reuse them.
 inline CoreLossesModelPair make_default_core_losses_model_pair() {
     return {
-        CoreLossesModel::factory(std::map<std::string, std::string>({{"coreLosses", "Steinmetz"}})),
-        CoreLossesModel::factory(std::map<std::string, std::string>({{"coreLosses", "Proprietary"}}))
+        CoreLossesTabulatedModel::get_shared(CoreLossesModels::STEINMETZ),
+        CoreLossesTabulatedModel::get_shared(CoreLossesModels::PROPRIETARY)
     };
 }
 
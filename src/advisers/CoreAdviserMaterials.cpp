@@ -248,14 +248,20 @@ std::vector<std::pair<Magnetic, double>> CoreAdviser::add_ferrite_materials_by_i
 
     auto minimumImpedanceRequirement = inputs.get_design_requirements().get_minimum_impedance().value();
 
+    std::vector<double> requirementFrequencies;
+    for (const auto& impedanceAtFrequency : minimumImpedanceRequirement) {
+        requirementFrequencies.push_back(impedanceAtFrequency.get_frequency());
+    }
+    std::vector<double> complexPermeabilityRealParts(requirementFrequencies.size());
+    std::vector<double> complexPermeabilityImaginaryParts(requirementFrequencies.size());
+
     ComplexPermeability complexPermeabilityModel;
-    for (auto coreMaterial : coreMaterialsToEvaluate) {
+    for (const auto& coreMaterial : coreMaterialsToEvaluate) {
         double totalComplexPermeability = 0;
         try {
-            for (auto impedanceAtFrequency : minimumImpedanceRequirement) {
-                auto frequency = impedanceAtFrequency.get_frequency();
-                auto [complexPermeabilityRealPart, complexPermeabilityImaginaryPart] = complexPermeabilityModel.get_complex_permeability(coreMaterial, frequency);
-                totalComplexPermeability += hypot(complexPermeabilityRealPart, complexPermeabilityImaginaryPart);
+            complexPermeabilityModel.get_complex_permeability(coreMaterial, requirementFrequencies, complexPermeabilityRealParts, complexPermeabilityImaginaryParts);
+            for (size_t index = 0; index < requirementFrequencies.size(); ++index) {
+                totalComplexPermeability += hypot(complexPermeabilityRealParts[index], complexPermeabilityImaginaryParts[index]);
             }
         }
         catch (const std::exception& e) {
@@ -327,6 +327,10 @@ std::vector<std::pair<Mas, double>> CoreAdviser::post_process_and_cut(std::vecto
         if (masWithScoring.size() >= maximumNumberResults) {
             break;
         }
+        if (_stopCondition.should_stop()) {
+            logEntry([&] { return "CoreAdviser: stop requested, returning " + std::to_string(masWithScoring.size()) + " post-processed cores"; }, "CoreAdviser", 2);
+            break;
+        }
         std::string shapeName;
         if (uniqueShapes) {
             shapeName = magneticWithScoring.first.get_core().get_shape_name();
@@ -351,7 +355,7 @@ std::vector<std::pair<Mas, double>> CoreAdviser::post_process_and_cut(std::vecto
             // drop it and let the next-scored candidate backfill (ABT #126: the
             // old resize-first order silently returned ZERO results when the
             // top-N were unwindable while windable survivors had been discarded).
-            logEntry(std::string("CoreAdviser: dropping core that failed post-processing (backfilling): ") + e.what(), "CoreAdviser", 2);
+            logEntry([&] { return std::string("CoreAdviser: dropping core that failed post-processing (backfilling): ") + e.what(); }, "CoreAdviser", 2);
         }
     }
     return masWithScoring;
@@ -458,7 +462,7 @@ std::vector<std::pair<Mas, double>> CoreAdviser::filter_available_cores_power_ap
         bool reducedSaturationMargin = false;
         if (magneticsWithScoring.size() == 0 && settings.get_core_adviser_saturation_margin() > 1.0) {
             double originalSaturationMargin = settings.get_core_adviser_saturation_margin();
-            logEntry("Still no cores. Relaxing saturation margin from " + std::to_string(originalSaturationMargin) + " to 1.0 (results will be tagged)...", "CoreAdviser");
+            logEntry([&] { return "Still no cores. Relaxing saturation margin from " + std::to_string(originalSaturationMargin) + " to 1.0 (results will be tagged)..."; }, "CoreAdviser");
             {
                 // RAII (ABT #113 sweep): the retry filters below can throw; a
                 // manual restore would leak the relaxed 1.0 margin.
@@ -638,9 +642,9 @@ std::vector<std::pair<Mas, double>> CoreAdviser::filter_available_cores_suppress
         auto beforeLosses = magneticsWithScoring;
         magneticsWithScoring = filterLosses.filter_magnetics(&magneticsWithScoring, inputs, weights[CoreAdviserFilters::EFFICIENCY], true);
         if (magneticsWithScoring.empty() && !beforeLosses.empty()) {
-            logEntry("Losses filter could not score any suppression candidate (no power-loss "
+            logEntry([&] { return "Losses filter could not score any suppression candidate (no power-loss "
                      "model for impedance-characterised materials); passing " +
-                         std::to_string(beforeLosses.size()) + " candidates through unscored",
+                         std::to_string(beforeLosses.size()) + " candidates through unscored"; },
                      "CoreAdviser");
             magneticsWithScoring = std::move(beforeLosses);
         }
@@ -728,7 +732,7 @@ std::vector<std::pair<Mas, double>> CoreAdviser::filter_standard_cores_power_app
     if (settings.get_core_adviser_enable_intermediate_pruning() && ferriteCores.size() > ferriteLimit) {
         ferriteCores.resize(ferriteLimit);
     }
-    logEntry("Ferrite cores after pruning: " + std::to_string(ferriteCores.size()), "CoreAdviser");
+    logEntry([&] { return "Ferrite cores after pruning: " + std::to_string(ferriteCores.size()); }, "CoreAdviser");
 
     // ========================================================================
     // STEP 3: Process FERRITE cores (gapped)
@@ -892,9 +896,9 @@ std::vector<std::pair<Mas, double>> CoreAdviser::filter_standard_cores_power_app
         magneticsWithScoring.push_back(core);
     }
     
-    logEntry("Combined results: " + std::to_string(magneticsWithScoring.size()) + 
+    logEntry([&] { return "Combined results: " + std::to_string(magneticsWithScoring.size()) + 
              " (ferrite: " + std::to_string(ferriteCores.size()) + 
-             ", powder: " + std::to_string(powderCores.size()) + ")", "CoreAdviser");
+             ", powder: " + std::to_string(powderCores.size()) + ")"; }, "CoreAdviser");
 
     if (magneticsWithScoring.size() == 0) {
         return {};
@@ -973,9 +977,9 @@ std::vector<std::pair<Mas, double>> CoreAdviser::filter_standard_cores_interfere
         auto beforeLosses = magneticsWithScoring;
         magneticsWithScoring = filterLosses.filter_magnetics(&magneticsWithScoring, inputs, 1 * userWeight(CoreAdviserFilters::EFFICIENCY), true);
         if (magneticsWithScoring.empty() && !beforeLosses.empty()) {
-            logEntry("Losses filter could not score any suppression candidate (no power-loss "
+            logEntry([&] { return "Losses filter could not score any suppression candidate (no power-loss "
                      "model for impedance-characterised materials); passing " +
-                         std::to_string(beforeLosses.size()) + " candidates through unscored",
+                         std::to_string(beforeLosses.size()) + " candidates through unscored"; },
                      "CoreAdviser");
             magneticsWithScoring = std::move(beforeLosses);
         }
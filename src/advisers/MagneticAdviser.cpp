@@ -1,11 +1,15 @@
 #include "processors/Inputs.h"
 #include <source_location>
 #include <cfloat>
+#include <chrono>
 #include <cmath>
 #include <limits>
+#include <optional>
 #include "advisers/MagneticAdviser.h"
+#include "advisers/AdviserResultCache.h"
 #include "advisers/CoreAdviser.h"
 #include "advisers/MagneticFilterInternal.h"  // is_energy_storing_topology()
+#include "advisers/MagneticAdviserInternal.h"
 #include "physical_models/Impedance.h"
 #include "processors/MagneticSimulator.h"
 #include "support/Painter.h"
@@ -30,6 +34,22 @@ void drop_invalid_when_valid_exists(std::vector<std::pair<Mas, double>>& scored)
     std::erase_if(scored, [](std::pair<Mas, double>& entry) { return coil_failed_validity_filters(entry.first); });
 }
 
+// Best-first order with the same deterministic reference tie-break as the
+// final ranking, cut to maximumNumberResults. Used for progress snapshots.
+std::vector<std::pair<Mas, double>> rank_candidates(std::vector<std::pair<Mas, double>> scored, size_t maximumNumberResults) {
+    drop_invalid_when_valid_exists(scored);
+    std::sort(scored.begin(), scored.end(), [](std::pair<Mas, double>& b1, std::pair<Mas, double>& b2) {
+        if (b1.second != b2.second) {
+            return b1.second > b2.second;
+        }
+        return b1.first.get_mutable_magnetic().get_reference() < b2.first.get_mutable_magnetic().get_reference();
+    });
+    if (scored.size() > maximumNumberResults) {
+        scored.erase(scored.begin() + maximumNumberResults, scored.end());
+    }
+    return scored;
+}
+
 // ABT #164: RAII scope that installs the per-call type constraints on the
 // adviser instance for the duration of a ctx-aware overload, restoring the
 // previous value on exit (also on exception). Unlike the old
@@ -97,6 +117,31 @@ WoundCandidateOutcome process_wound_candidate(
         return WoundCandidateOutcome::Skipped;
     }
 
+    auto check = simulate_and_check_saturation(mas, magneticSimulator, settings, previousCoilIncludeAdditionalCoordinates);
+    if (check == SimulatedCandidateCheck::SimulationFailed) {
+        return WoundCandidateOutcome::Skipped;
+    }
+    processedCoils++;
+    if (check == SimulatedCandidateCheck::Saturates) {
+        return WoundCandidateOutcome::Skipped;
+    }
+
+    masData.push_back(mas);
+    if (masData.size() >= globalCandidateCap) {
+        return WoundCandidateOutcome::GlobalCapHit;
+    }
+    if (processedCoils >= perCoreCoilCap) {
+        usedNumberSectionsAndMargin.push_back(numberSectionsAndMarginCombination);
+        return WoundCandidateOutcome::PerCoreCapHit;
+    }
+    return WoundCandidateOutcome::Added;
+}
+} // namespace
+
+SimulatedCandidateCheck simulate_and_check_saturation(Mas& mas,
+                                                      MagneticSimulator& magneticSimulator,
+                                                      Settings& settings,
+                                                      bool previousCoilIncludeAdditionalCoordinates) {
     if (previousCoilIncludeAdditionalCoordinates) {
         // RAII (ABT #113 sweep): delimit_and_compact can throw; the manual
         // set-back-to-false would then be skipped.
@@ -106,12 +151,10 @@ WoundCandidateOutcome process_wound_candidate(
     try {
         mas = magneticSimulator.simulate(mas);
     } catch (const std::exception& e) {
-        logEntry(std::string("MagneticAdviser: skipping candidate, simulate failed: ") + e.what(), "MagneticAdviser", 2);
-        return WoundCandidateOutcome::Skipped;
+        logEntry([&] { return std::string("MagneticAdviser: skipping candidate, simulate failed: ") + e.what(); }, "MagneticAdviser", 2);
+        return SimulatedCandidateCheck::SimulationFailed;
     }
 
-    processedCoils++;
-
     // Final saturation gate on the ASSEMBLED magnetic. score_magnetics only
     // scores (it discards the validity flag), and the CoreAdviser saturation
     // gate ran on the SEED turns — but the coil adviser / loss optimisation can
@@ -142,24 +185,15 @@ WoundCandidateOutcome process_wound_candidate(
                 }
             }
             if (saturates) {
-                logEntry("MagneticAdviser: dropping '" + mas.get_mutable_magnetic().get_reference()
-                         + "' — final saturation current below margin", "MagneticAdviser", 2);
-                return WoundCandidateOutcome::Skipped;
+                logEntry([&] { return "MagneticAdviser: dropping '" + mas.get_mutable_magnetic().get_reference()
+                         + "' — final saturation current below margin"; }, "MagneticAdviser", 2);
+                return SimulatedCandidateCheck::Saturates;
             }
         }
     }
 
-    masData.push_back(mas);
-    if (masData.size() >= globalCandidateCap) {
-        return WoundCandidateOutcome::GlobalCapHit;
-    }
-    if (processedCoils >= perCoreCoilCap) {
-        usedNumberSectionsAndMargin.push_back(numberSectionsAndMarginCombination);
-        return WoundCandidateOutcome::PerCoreCapHit;
-    }
-    return WoundCandidateOutcome::Added;
+    return SimulatedCandidateCheck::Passed;
 }
-} // namespace
 
 void MagneticAdviser::set_unique_core_shapes(bool value) {
     _uniqueCoreShapes = value;
@@ -185,6 +219,103 @@ CoreAdviser::CoreAdviserModes MagneticAdviser::get_core_mode() {
     return _coreAdviserMode;
 }
 
+void MagneticAdviser::set_stop_condition(const StopCondition& stopCondition) {
+    _stopCondition = stopCondition;
+}
+
+void MagneticAdviser::set_progress_callback(std::function<void(const AdviserProgress&)> callback) {
+    _progressCallback = std::move(callback);
+}
+
+bool MagneticAdviser::get_last_search_truncated() const {
+    return _lastSearchTruncated;
+}
+
+void MagneticAdviser::set_memory_budget(std::optional<size_t> bytes) {
+    _memoryBudget = bytes;
+}
+
+std::optional<size_t> MagneticAdviser::get_memory_budget() const {
+    return _memoryBudget;
+}
+
+size_t MagneticAdviser::get_last_search_peak_candidate_memory() const {
+    return _lastSearchPeakCandidateMemory;
+}
+
+bool MagneticAdviser::get_last_search_memory_limited() const {
+    return _lastSearchMemoryLimited;
+}
+
+namespace {
+// Heap behind the names, coordinates and optional fields of one description
+// element, on top of its sizeof. A rough per-element figure is enough: the
+// budget is about orders of magnitude, and the waveforms dominate.
+constexpr size_t descriptionElementHeapBytes = 256;
+
+template<typename Element>
+size_t estimate_elements_memory(const std::vector<Element>& elements) {
+    return elements.size() * (sizeof(Element) + descriptionElementHeapBytes);
+}
+
+size_t estimate_signal_memory(const std::optional<SignalDescriptor>& signal) {
+    if (!signal) {
+        return 0;
+    }
+    size_t bytes = sizeof(SignalDescriptor);
+    if (signal->get_waveform()) {
+        bytes += signal->get_waveform()->get_data().size() * sizeof(double);
+        if (signal->get_waveform()->get_time()) {
+            bytes += signal->get_waveform()->get_time()->size() * sizeof(double);
+        }
+    }
+    if (signal->get_harmonics()) {
+        bytes += (signal->get_harmonics()->get_amplitudes().size() + signal->get_harmonics()->get_frequencies().size()) * sizeof(double);
+    }
+    return bytes;
+}
+} // namespace
+
+size_t MagneticAdviser::estimate_candidate_memory(const Mas& mas) {
+    size_t bytes = sizeof(Mas);
+
+    const auto& coil = mas.get_magnetic().get_coil();
+    bytes += estimate_elements_memory(coil.get_functional_description());
+    if (coil.get_sections_description()) {
+        bytes += estimate_elements_memory(coil.get_sections_description().value());
+    }
+    if (coil.get_layers_description()) {
+        bytes += estimate_elements_memory(coil.get_layers_description().value());
+    }
+    if (coil.get_turns_description()) {
+        bytes += estimate_elements_memory(coil.get_turns_description().value());
+    }
+
+    for (const auto& operatingPoint : mas.get_inputs().get_operating_points()) {
+        bytes += estimate_elements_memory(operatingPoint.get_excitations_per_winding());
+        for (const auto& excitation : operatingPoint.get_excitations_per_winding()) {
+            bytes += estimate_signal_memory(excitation.get_current());
+            bytes += estimate_signal_memory(excitation.get_voltage());
+            bytes += estimate_signal_memory(excitation.get_magnetizing_current());
+            bytes += estimate_signal_memory(excitation.get_magnetic_flux_density());
+        }
+    }
+
+    bytes += estimate_elements_memory(mas.get_outputs());
+    for (const auto& output : mas.get_outputs()) {
+        if (output.get_winding_losses()) {
+            const auto& windingLosses = output.get_winding_losses().value();
+            for (const auto* lossesPerElement : {&windingLosses.get_winding_losses_per_winding(), &windingLosses.get_winding_losses_per_section(),
+                                                 &windingLosses.get_winding_losses_per_layer(), &windingLosses.get_winding_losses_per_turn()}) {
+                if (*lossesPerElement) {
+                    bytes += estimate_elements_memory(lossesPerElement->value());
+                }
+            }
+        }
+    }
+    return bytes;
+}
+
 void MagneticAdviser::load_filter_flow(std::vector<MagneticFilterOperation> flow, std::optional<Inputs> inputs) {
     _filters.clear();
     _loadedFilterFlow = flow;
@@ -425,9 +556,9 @@ std::vector<std::pair<Mas, double>> MagneticAdviser::get_advised_magnetic_fast(I
             // would later throw COIL_NOT_PROCESSED. Skip it here so only fully
             // wound candidates enter the result pool (ABT #42).
             if (!wound) {
-                logEntry("MagneticAdviser::get_advised_magnetic_fast: skipping candidate '"
+                logEntry([&] { return "MagneticAdviser::get_advised_magnetic_fast: skipping candidate '"
                          + mas.get_mutable_magnetic().get_core().get_name().value_or("?")
-                         + "' — fast_wind produced no turns (window too small for the turns)",
+                         + "' — fast_wind produced no turns (window too small for the turns)"; },
                          "MagneticAdviser", 2);
                 continue;
             }
@@ -486,7 +617,7 @@ std::vector<std::pair<Mas, double>> MagneticAdviser::get_advised_magnetic_fast(I
             }
         }
         catch (const std::exception& e) {
-            logEntry(std::string("MagneticAdviser::get_advised_magnetic_fast: skipping candidate, scoring failed: ") + e.what(), "MagneticAdviser", 2);
+            logEntry([&] { return std::string("MagneticAdviser::get_advised_magnetic_fast: skipping candidate, scoring failed: ") + e.what(); }, "MagneticAdviser", 2);
             continue;
         }
     }
@@ -558,9 +689,80 @@ std::vector<std::pair<Mas, double>> MagneticAdviser::get_advised_magnetic(Inputs
     return get_advised_magnetic(inputs, customMagneticFilterFlow, maximumNumberResults);
 }
 
+json MagneticAdviser::get_result_cache_request(const Inputs& inputs, const std::vector<MagneticFilterOperation>& filterFlow, size_t maximumNumberResults) const {
+    json request;
+    to_json(request["inputs"], inputs);
+    request["filterFlow"] = json::array();
+    for (auto& operation : filterFlow) {
+        json step;
+        step["filter"] = std::string(magic_enum::enum_name(operation.get_filter()));
+        step["invert"] = operation.get_invert();
+        step["log"] = operation.get_log();
+        step["strictlyRequired"] = operation.get_strictly_required();
+        step["weight"] = operation.get_weight();
+        request["filterFlow"].push_back(step);
+    }
+    request["maximumNumberResults"] = maximumNumberResults;
+    request["application"] = std::string(magic_enum::enum_name(_application));
+    request["coreMode"] = std::string(magic_enum::enum_name(_coreAdviserMode));
+    request["simulateResults"] = _simulateResults;
+    request["uniqueCoreShapes"] = _uniqueCoreShapes;
+    request["constraints"]["shapeFamily"] = json::array({_constraints.shapeFamily.allowed, _constraints.shapeFamily.blocked});
+    request["constraints"]["coreMaterialType"] = json::array({_constraints.coreMaterialType.allowed, _constraints.coreMaterialType.blocked});
+    request["constraints"]["wireType"] = json::array({_constraints.wireType.allowed, _constraints.wireType.blocked});
+    return request;
+}
+
 std::vector<std::pair<Mas, double>> MagneticAdviser::get_advised_magnetic(Inputs inputs, std::vector<MagneticFilterOperation> filterFlow, size_t maximumNumberResults) {
+    // Scoped catalogues are not part of the key, so their results are never
+    // cached; everything else the ranking depends on is.
+    if (!AdviserResultCache::enabled() || LibraryContext::Scope::anyActive()) {
+        return search_advised_magnetic(inputs, filterFlow, maximumNumberResults);
+    }
+
+    // Key on the processed inputs, so that a request and its pre-processed
+    // twin share one entry; the search then runs on the same form.
+    inputs.process();
+    auto& resultCache = AdviserResultCache::instance();
+    auto key = AdviserResultCache::make_key(get_result_cache_request(inputs, filterFlow, maximumNumberResults));
+    if (auto cached = resultCache.read(key)) {
+        logEntry([&] { return "Returning " + std::to_string(cached->size()) + " cached magnetics for request " + key.hash; }, "MagneticAdviser", 2);
+        clear_scoring();
+        _failedScorings.clear();
+        _lastSearchTruncated = false;
+        // The cached designs are the only candidates this call holds.
+        _lastSearchPeakCandidateMemory = 0;
+        for (auto& [mas, scoring] : cached.value()) {
+            _lastSearchPeakCandidateMemory += estimate_candidate_memory(mas);
+        }
+        _lastSearchMemoryLimited = false;
+        if (_progressCallback) {
+            AdviserProgress progress;
+            progress.stage = AdviserProgress::Stage::FINISHED;
+            progress.detail = "cached";
+            progress.candidates = cached->size();
+            progress.best = cached.value();
+            _progressCallback(progress);
+        }
+        return cached.value();
+    }
+
+    auto results = search_advised_magnetic(inputs, filterFlow, maximumNumberResults);
+    // A truncated or memory-limited search is a valid answer for THIS call's
+    // budget, not for the request: serving it later would make the result
+    // depend on timing or on the caller's budget.
+    if (!_lastSearchTruncated && !_lastSearchMemoryLimited) {
+        resultCache.store(key, results);
+    }
+    return results;
+}
+
+std::vector<std::pair<Mas, double>> MagneticAdviser::search_advised_magnetic(Inputs inputs, std::vector<MagneticFilterOperation> filterFlow, size_t maximumNumberResults) {
     clear_scoring();
     _failedScorings.clear();  // stale rejections would mis-rank the next run (ABT #801)
+    _lastSearchTruncated = false;
+    _lastSearchPeakCandidateMemory = 0;
+    _lastSearchMemoryLimited = false;
     load_filter_flow(filterFlow, inputs);
     std::vector<Mas> masData;
 
@@ -645,7 +847,7 @@ std::vector<std::pair<Mas, double>> MagneticAdviser::get_advised_magnetic(Inputs
     }
     
     if (toroidsOriginallyEnabled && maxVoltage > 600) {
-        logEntry("High voltage requirements (" + std::to_string(int(maxVoltage)) + "V) detected. Disabling toroidal cores for better results.", "MagneticAdviser", 0);
+        logEntry([&] { return "High voltage requirements (" + std::to_string(int(maxVoltage)) + "V) detected. Disabling toroidal cores for better results."; }, "MagneticAdviser", 0);
         settings.set_use_toroidal_cores(false);
         toroidsOriginallyEnabled = false; // Don't retry since we proactively disabled
         clear_loaded_cores();
@@ -704,6 +906,9 @@ std::vector<std::pair<Mas, double>> MagneticAdviser::get_advised_magnetic(Inputs
     // process-shared wireDatabase. Empty constraints => no wire pruning.
     coilAdviser.set_wire_constraints(_constraints);
     MagneticSimulator magneticSimulator;
+    coreAdviser.set_stop_condition(_stopCondition);
+    coilAdviser.set_stop_condition(_stopCondition);
+    magneticSimulator.set_stop_condition(_stopCondition);
     size_t numberWindings = inputs.get_design_requirements().get_turns_ratios().size() + 1;
     size_t coresWound = 0;
 
@@ -712,6 +917,53 @@ std::vector<std::pair<Mas, double>> MagneticAdviser::get_advised_magnetic(Inputs
     size_t requestedCores = expectedWoundCores;
     std::vector<std::string> evaluatedCores;
     size_t previouslyObtainedCores = SIZE_MAX;
+
+    // Approximate bytes held by masData, and how many of its entries are
+    // already included in that figure.
+    size_t candidateMemory = 0;
+    size_t accountedCandidates = 0;
+
+    // Latches _lastSearchTruncated: once the stop condition fired, every loop
+    // below unwinds and the candidates simulated so far are ranked as usual.
+    auto stop_requested = [&]() {
+        if (!_lastSearchTruncated && _stopCondition.should_stop()) {
+            logEntry([&] { return "Stop requested, ranking the " + std::to_string(masData.size()) + " magnetics found so far"; }, "MagneticAdviser", 1);
+            _lastSearchTruncated = true;
+        }
+        return _lastSearchTruncated;
+    };
+    // Publishing `best` re-scores the whole pool, as much work as the final
+    // ranking, so SCORING goes out for the first designs found and then at
+    // most once per progressScoringInterval, and only when the pool changed.
+    const auto progressScoringInterval = std::chrono::milliseconds(500);
+    std::optional<std::chrono::steady_clock::time_point> lastScoringPublished;
+    size_t candidatesAtLastScoring = 0;
+    auto publish_progress = [&](AdviserProgress::Stage stage, const std::string& detail) {
+        if (!_progressCallback) {
+            return;
+        }
+        if (stage == AdviserProgress::Stage::SCORING) {
+            auto now = std::chrono::steady_clock::now();
+            if (masData.size() == candidatesAtLastScoring ||
+                (lastScoringPublished && now - lastScoringPublished.value() < progressScoringInterval)) {
+                return;
+            }
+            lastScoringPublished = now;
+            candidatesAtLastScoring = masData.size();
+        }
+        AdviserProgress progress;
+        progress.stage = stage;
+        progress.detail = detail;
+        progress.evaluatedCores = evaluatedCores.size();
+        progress.candidates = masData.size();
+        progress.candidateMemory = candidateMemory;
+        progress.truncated = _lastSearchTruncated;
+        if (stage == AdviserProgress::Stage::SCORING) {
+            // A preview: the final ranking records the scorings, once.
+            progress.best = rank_candidates(score_magnetics(masData, filterFlow, false), maximumNumberResults);
+        }
+        _progressCallback(progress);
+    };
     size_t whileIteration = 0;
     const size_t maxWhileIterations = 2;  // Limit exponential growth
     const size_t maxEvaluatedCores = 40;  // OPTIMIZATION: Balanced - 40 cores to capture variety including medium-sized
@@ -729,9 +981,50 @@ std::vector<std::pair<Mas, double>> MagneticAdviser::get_advised_magnetic(Inputs
     const size_t perCoreCoilCap = std::min(size_t(5), size_t(ceil(maximumNumberResults * 0.5)));
     const size_t globalCandidateCap = std::max(size_t(1), maximumNumberResults) * 4;
     bool globalCapReached = false;
-    while (coresWound < expectedWoundCores && whileIteration < maxWhileIterations && evaluatedCores.size() < maxEvaluatedCores && !globalCapReached) {
+
+    // The caps above bound the COUNT; the memory budget bounds the estimated
+    // size, which grows with turns, windings and waveform resolution.
+    // Going over the budget ranks the pool and keeps its best candidates (at
+    // most maximumNumberResults) within memoryBudgetPruneFraction of it, so
+    // that the next prune is a fair number of candidates away rather than the
+    // very next one. Returns true when the search must stop: the best
+    // candidate alone is over budget.
+    const double memoryBudgetPruneFraction = 0.5;
+    auto enforce_memory_budget = [&]() {
+        for (; accountedCandidates < masData.size(); ++accountedCandidates) {
+            candidateMemory += estimate_candidate_memory(masData[accountedCandidates]);
+        }
+        _lastSearchPeakCandidateMemory = std::max(_lastSearchPeakCandidateMemory, candidateMemory);
+        if (!_memoryBudget || candidateMemory <= _memoryBudget.value()) {
+            return false;
+        }
+        _lastSearchMemoryLimited = true;
+        auto pruneTarget = static_cast<size_t>(_memoryBudget.value() * memoryBudgetPruneFraction);
+        // Not recorded: get_scorings() must only cover the final pool, and
+        // most of this one is about to be dropped.
+        auto best = rank_candidates(score_magnetics(masData, filterFlow, false), maximumNumberResults);
+        masData.clear();
+        candidateMemory = 0;
+        for (auto& [mas, scoring] : best) {
+            auto masMemory = estimate_candidate_memory(mas);
+            if (!masData.empty() && candidateMemory + masMemory > pruneTarget) {
+                break;
+            }
+            candidateMemory += masMemory;
+            masData.push_back(std::move(mas));
+        }
+        accountedCandidates = masData.size();
+        logEntry([&] { return "Memory budget exceeded, kept the best " + std::to_string(masData.size()) + " magnetics (" + std::to_string(candidateMemory) + " bytes)"; }, "MagneticAdviser", 1);
+        if (candidateMemory > _memoryBudget.value()) {
+            logEntry("Memory budget exceeded by the best magnetic alone, stopping the search", "MagneticAdviser", 1);
+            return true;
+        }
+        return false;
+    };
+    while (coresWound < expectedWoundCores && whileIteration < maxWhileIterations && evaluatedCores.size() < maxEvaluatedCores && !globalCapReached && !stop_requested()) {
         whileIteration++;
         requestedCores += 20;  // Linear growth instead of exponential
+        publish_progress(AdviserProgress::Stage::CORE_SELECTION, "");
         // ABT #164: constraint-aware overload filters a LOCAL core/shape view
         // (ctx=nullptr; any ctx catalog override was already applied by the
         // outer LibraryContext::Scope). Empty _constraints => identical to the
@@ -744,6 +1037,9 @@ std::vector<std::pair<Mas, double>> MagneticAdviser::get_advised_magnetic(Inputs
         previouslyObtainedCores = masMagneticsWithCore.size();
 
         for (auto& [mas, coreScoring] : masMagneticsWithCore) {
+            if (stop_requested()) {
+                break;
+            }
             auto coreNameOpt = mas.get_magnetic().get_core().get_name();
             if (!coreNameOpt) {
                 continue;
@@ -759,12 +1055,13 @@ std::vector<std::pair<Mas, double>> MagneticAdviser::get_advised_magnetic(Inputs
 
             // Check performance limit
             if (evaluatedCores.size() >= maxEvaluatedCores) {
-                logEntry("Reached maxEvaluatedCores limit (" + std::to_string(maxEvaluatedCores) + ")", "MagneticAdviser", 2);
+                logEntry([&] { return "Reached maxEvaluatedCores limit (" + std::to_string(maxEvaluatedCores) + ")"; }, "MagneticAdviser", 2);
                 break;
             }
 
-            logEntry("core: " + coreName, "MagneticAdviser", 2);
+            logEntry([&] { return "core: " + coreName; }, "MagneticAdviser", 2);
             logEntry("Getting coil", "MagneticAdviser", 2);
+            publish_progress(AdviserProgress::Stage::WINDING, coreName);
             std::vector<std::pair<size_t, double>> usedNumberSectionsAndMargin;
             auto masMagneticsWithCoreAndCoil = coilAdviser.get_advised_coil(mas, std::max(2.0, ceil(double(maximumNumberResults) / masMagneticsWithCore.size())));
 
@@ -774,11 +1071,18 @@ std::vector<std::pair<Mas, double>> MagneticAdviser::get_advised_magnetic(Inputs
             }
             size_t processedCoils = 0;
             for (auto mas : masMagneticsWithCoreAndCoil) {
+                if (stop_requested()) {
+                    break;
+                }
                 auto outcome = process_wound_candidate(
                     mas, magneticSimulator, settings, previousCoilIncludeAdditionalCoordinates,
                     perCoreCoilCap, globalCandidateCap, usedNumberSectionsAndMargin, masData, processedCoils);
+                if (enforce_memory_budget()) {
+                    globalCapReached = true;
+                    break;
+                }
                 if (outcome == WoundCandidateOutcome::GlobalCapHit) {
-                    logEntry("Reached globalCandidateCap (" + std::to_string(globalCandidateCap) + ")", "MagneticAdviser", 2);
+                    logEntry([&] { return "Reached globalCandidateCap (" + std::to_string(globalCandidateCap) + ")"; }, "MagneticAdviser", 2);
                     globalCapReached = true;
                     break;
                 }
@@ -786,6 +1090,7 @@ std::vector<std::pair<Mas, double>> MagneticAdviser::get_advised_magnetic(Inputs
                     break;
                 }
             }
+            publish_progress(AdviserProgress::Stage::SCORING, coreName);
             if (globalCapReached) {
                 break;
             }
@@ -795,7 +1100,7 @@ std::vector<std::pair<Mas, double>> MagneticAdviser::get_advised_magnetic(Inputs
         }
     }
 
-    logEntry("Found " + std::to_string(masData.size()) + " magnetics", "MagneticAdviser", 2);
+    logEntry([&] { return "Found " + std::to_string(masData.size()) + " magnetics"; }, "MagneticAdviser", 2);
     
     auto masMagneticsWithScoring = score_magnetics(masData, filterFlow);
     drop_invalid_when_valid_exists(masMagneticsWithScoring);
@@ -817,7 +1122,7 @@ std::vector<std::pair<Mas, double>> MagneticAdviser::get_advised_magnetic(Inputs
     }
 
     // Retry without toroids if toroids were enabled but no results found
-    if (masMagneticsWithScoring.empty() && toroidsOriginallyEnabled) {
+    if (masMagneticsWithScoring.empty() && toroidsOriginallyEnabled && !_lastSearchTruncated) {
         logEntry("No magnetics found with toroids enabled. Retrying without toroids...", "MagneticAdviser", 0);
         settings.set_use_toroidal_cores(false);
         clear_loaded_cores();
@@ -825,13 +1130,15 @@ std::vector<std::pair<Mas, double>> MagneticAdviser::get_advised_magnetic(Inputs
         evaluatedCores.clear();
         coresWound = 0;
         masData.clear();
+        candidateMemory = 0;
+        accountedCandidates = 0;
         
         // Retry the core search
         whileIteration = 0;
         requestedCores = expectedWoundCores;
         previouslyObtainedCores = SIZE_MAX;
         globalCapReached = false;
-        while (coresWound < expectedWoundCores && whileIteration < maxWhileIterations && evaluatedCores.size() < maxEvaluatedCores && !globalCapReached) {
+        while (coresWound < expectedWoundCores && whileIteration < maxWhileIterations && evaluatedCores.size() < maxEvaluatedCores && !globalCapReached && !stop_requested()) {
             whileIteration++;
             requestedCores += 20;
             auto masMagneticsWithCore = coreAdviser.get_advised_core(inputs, coreWeights, requestedCores, nullptr, _constraints);
@@ -842,6 +1149,9 @@ std::vector<std::pair<Mas, double>> MagneticAdviser::get_advised_magnetic(Inputs
             previouslyObtainedCores = masMagneticsWithCore.size();
 
             for (auto& [mas, coreScoring] : masMagneticsWithCore) {
+                if (stop_requested()) {
+                    break;
+                }
                 auto coreNameOpt = mas.get_magnetic().get_core().get_name();
                 if (!coreNameOpt) {
                     continue;
@@ -856,11 +1166,11 @@ std::vector<std::pair<Mas, double>> MagneticAdviser::get_advised_magnetic(Inputs
                 }
 
                 if (evaluatedCores.size() >= maxEvaluatedCores) {
-                    logEntry("Reached maxEvaluatedCores limit (" + std::to_string(maxEvaluatedCores) + ")", "MagneticAdviser", 2);
+                    logEntry([&] { return "Reached maxEvaluatedCores limit (" + std::to_string(maxEvaluatedCores) + ")"; }, "MagneticAdviser", 2);
                     break;
                 }
 
-                logEntry("core: " + coreName, "MagneticAdviser", 2);
+                logEntry([&] { return "core: " + coreName; }, "MagneticAdviser", 2);
                 logEntry("Getting coil", "MagneticAdviser", 2);
                 std::vector<std::pair<size_t, double>> usedNumberSectionsAndMargin;
                 auto masMagneticsWithCoreAndCoil = coilAdviser.get_advised_coil(mas, std::max(2.0, ceil(double(maximumNumberResults) / masMagneticsWithCore.size())));
@@ -875,11 +1185,18 @@ std::vector<std::pair<Mas, double>> MagneticAdviser::get_advised_magnetic(Inputs
                 // isat gate) instead of pushing raw, unsimulated, un-saturation-
                 // checked magnetics.
                 for (auto& masWithCoil : masMagneticsWithCoreAndCoil) {
+                    if (stop_requested()) {
+                        break;
+                    }
                     auto outcome = process_wound_candidate(
                         masWithCoil, magneticSimulator, settings, previousCoilIncludeAdditionalCoordinates,
                         perCoreCoilCap, globalCandidateCap, usedNumberSectionsAndMargin, masData, processedCoils);
+                    if (enforce_memory_budget()) {
+                        globalCapReached = true;
+                        break;
+                    }
                     if (outcome == WoundCandidateOutcome::GlobalCapHit) {
-                        logEntry("Reached globalCandidateCap (" + std::to_string(globalCandidateCap) + ") in retry", "MagneticAdviser", 2);
+                        logEntry([&] { return "Reached globalCandidateCap (" + std::to_string(globalCandidateCap) + ") in retry"; }, "MagneticAdviser", 2);
                         globalCapReached = true;
                         break;
                     }
@@ -896,7 +1213,7 @@ std::vector<std::pair<Mas, double>> MagneticAdviser::get_advised_magnetic(Inputs
             }
         }
         
-        logEntry("Found " + std::to_string(masData.size()) + " magnetics without toroids", "MagneticAdviser", 2);
+        logEntry([&] { return "Found " + std::to_string(masData.size()) + " magnetics without toroids"; }, "MagneticAdviser", 2);
         masMagneticsWithScoring = score_magnetics(masData, filterFlow);
         drop_invalid_when_valid_exists(masMagneticsWithScoring);
 
@@ -909,6 +1226,17 @@ std::vector<std::pair<Mas, double>> MagneticAdviser::get_advised_magnetic(Inputs
         }
     }
 
+    if (_progressCallback) {
+        AdviserProgress progress;
+        progress.stage = AdviserProgress::Stage::FINISHED;
+        progress.evaluatedCores = evaluatedCores.size();
+        progress.candidates = masData.size();
+        progress.candidateMemory = candidateMemory;
+        progress.best = masMagneticsWithScoring;
+        progress.truncated = _lastSearchTruncated;
+        _progressCallback(progress);
+    }
+
     // coil_include_additional_coordinates and the three core-filter settings
     // (plus the cached core DB) are restored on scope exit by
     // coilIncludeCoordinatesGuard and coreFilterSettingsRestorer (declared
@@ -970,12 +1298,14 @@ std::vector<std::pair<Mas, double>> MagneticAdviser::get_advised_magnetic(std::v
     // can produce different rankings between runs.
     clear_scoring();
     _failedScorings.clear();  // stale rejections would mis-rank the next run (ABT #801)
+    _lastSearchTruncated = false;
 
     load_filter_flow(filterFlow, catalogueMagneticsWithInputs[0].get_inputs());
     std::vector<MagneticFilterOperation> strictlyRequiredFilterFlow;
     std::vector<MagneticFilterOperation> nonStrictlyRequiredFilterFlow;
     std::vector<Mas> validMas;
     MagneticSimulator magneticSimulator;
+    magneticSimulator.set_stop_condition(_stopCondition);
 
     std::map<std::string, double> scoringPerReference;
     std::vector<Mas> catalogueMasWithStriclyRequirementsPassed;
@@ -1002,6 +1332,11 @@ std::vector<std::pair<Mas, double>> MagneticAdviser::get_advised_magnetic(std::v
     std::string previousThrowMessage;
     size_t identicalThrowStreak = 0;
     for (size_t index = 0; index < catalogueMagneticsWithInputs.size(); ++index) {
+        if (_stopCondition.should_stop()) {
+            logEntry([&] { return "Stop requested after " + std::to_string(index) + " of " + std::to_string(catalogueMagneticsWithInputs.size()) + " catalogue magnetics"; }, "MagneticAdviser", 1);
+            _lastSearchTruncated = true;
+            break;
+        }
         auto mas = catalogueMagneticsWithInputs[index];
         std::vector<Outputs> outputs;
         auto inputs = mas.get_inputs();
@@ -1024,7 +1359,7 @@ std::vector<std::pair<Mas, double>> MagneticAdviser::get_advised_magnetic(std::v
                 previousThrowMessage.clear();
             }
             catch (const std::exception& e) {
-                logEntry(std::string("MagneticAdviser: strict filter ") + std::string(magic_enum::enum_name(filterEnum)) + " threw, rejecting magnetic: " + e.what(), "MagneticAdviser", 2);
+                logEntry([&] { return std::string("MagneticAdviser: strict filter ") + std::string(magic_enum::enum_name(filterEnum)) + " threw, rejecting magnetic: " + e.what(); }, "MagneticAdviser", 2);
                 std::string thisMsg = e.what();
                 if (thisMsg == previousThrowMessage) {
                     ++identicalThrowStreak;
@@ -1098,7 +1433,7 @@ std::vector<std::pair<Mas, double>> MagneticAdviser::get_advised_magnetic(std::v
                 }
             }
             catch (const std::exception& e) {
-                logEntry(std::string("MagneticAdviser: non-strict filter ") + std::string(magic_enum::enum_name(filterEnum)) + " threw, rejecting magnetic: " + e.what(), "MagneticAdviser", 2);
+                logEntry([&] { return std::string("MagneticAdviser: non-strict filter ") + std::string(magic_enum::enum_name(filterEnum)) + " threw, rejecting magnetic: " + e.what(); }, "MagneticAdviser", 2);
                 valid = false;
                 break;
             }
@@ -1155,8 +1490,13 @@ std::vector<std::pair<Mas, double>> MagneticAdviser::get_advised_magnetic(std::v
             for (auto [mas, scoring] : masMagneticsWithScoring) {
                 try {
                     mas = magneticSimulator.simulate(mas, true);
+                } catch (const CalculationInterruptedException&) {
+                    // Out of time: every later simulate would be interrupted
+                    // too, so return only the designs that carry outputs.
+                    _lastSearchTruncated = true;
+                    break;
                 } catch (const std::exception& e) {
-                    logEntry(std::string("MagneticAdviser: skipping final-simulate candidate: ") + e.what(), "MagneticAdviser", 2);
+                    logEntry([&] { return std::string("MagneticAdviser: skipping final-simulate candidate: ") + e.what(); }, "MagneticAdviser", 2);
                     continue;
                 }
                 masMagneticsWithScoringSimulated.push_back({mas, scoring});
@@ -1189,7 +1529,7 @@ std::vector<std::pair<Mas, double>> MagneticAdviser::get_advised_magnetic(std::v
     }
 }
 
-std::vector<std::pair<Mas, double>> MagneticAdviser::score_magnetics(std::vector<Mas> masMagnetics, std::vector<MagneticFilterOperation> filterFlow) {
+std::vector<std::pair<Mas, double>> MagneticAdviser::score_magnetics(std::vector<Mas> masMagnetics, std::vector<MagneticFilterOperation> filterFlow, bool recordScorings) {
     std::vector<std::pair<Mas, double>> masMagneticsWithScoring;
 
     // Return early if no magnetics to score
@@ -1213,7 +1553,9 @@ std::vector<std::pair<Mas, double>> MagneticAdviser::score_magnetics(std::vector
         for (auto mas : masMagnetics) {
             auto [valid, scoring] = filterIt->second->evaluate_magnetic(&mas.get_mutable_magnetic(), &mas.get_mutable_inputs());
             scorings.push_back(scoring);
-            add_scoring(mas.get_mutable_magnetic().get_reference(), filterEnum, scoring);
+            if (recordScorings) {
+                add_scoring(mas.get_mutable_magnetic().get_reference(), filterEnum, scoring);
+            }
         }
         if (masMagneticsWithScoring.size() > 0) {
             normalize_scoring(&masMagneticsWithScoring, scorings, filterConfiguration);
@@ -7,13 +7,67 @@
 #include "processors/Inputs.h"
 #include "Definitions.h"
 #include "Defaults.h"
+#include "support/Cancellation.h"
 #include <MAS.hpp>
+#include <functional>
 #include <set>
 
 using namespace MAS;
 
 namespace OpenMagnetics {
 
+/**
+ * @brief One non-dominated design returned by MagneticAdviser::get_pareto_front().
+ */
+struct ParetoCandidate {
+    Mas mas;
+    /// Raw objective values, exactly as returned by MagneticFilter::evaluate_magnetic
+    /// (not normalized, so they stay comparable across runs).
+    std::map<MagneticFilters, double> objectives;
+    /// Non-domination rank over every design evaluated during the search (0 = front).
+    size_t rank = 0;
+    /// NSGA-II crowding distance inside its rank; infinite for the extremes of each objective.
+    double crowdingDistance = 0;
+};
+
+/**
+ * @brief Tuning knobs of the NSGA-II search in MagneticAdviser::get_pareto_front().
+ *
+ * The genome is (core, coil variant): cores come from the CoreAdviser ranking
+ * (at most `maximumNumberCores`), coil variants from CoilAdviser (at most
+ * `coilsPerCore` per core, wound lazily the first time a core is visited).
+ */
+struct ParetoSearchOptions {
+    size_t populationSize = 16;
+    size_t numberGenerations = 6;
+    double crossoverProbability = 0.9;
+    double mutationProbability = 0.3;
+    size_t maximumNumberCores = 40;
+    size_t coilsPerCore = 3;
+    /// Fixed seed: the same inputs always return the same front.
+    uint64_t seed = 42;
+};
+
+/**
+ * @brief Progress event streamed by MagneticAdviser (see set_progress_callback()).
+ */
+struct AdviserProgress {
+    enum class Stage : int {
+        CORE_SELECTION,  //!< asking CoreAdviser for (more) cores
+        WINDING,         //!< CoilAdviser is winding `detail` (the core name)
+        SCORING,         //!< a core's candidates were simulated; `best` holds the current top-k (throttled, see set_progress_callback())
+        FINISHED         //!< final ranking in `best`; `truncated` says whether the search was cut short
+    };
+    Stage stage;
+    std::string detail;
+    size_t evaluatedCores = 0;
+    size_t candidates = 0;  //!< simulated candidates in the pool so far
+    size_t candidateMemory = 0;  //!< approximate bytes held by the pool (see estimate_candidate_memory())
+    /// Current best designs (at most maximumNumberResults), only on SCORING and FINISHED.
+    std::vector<std::pair<Mas, double>> best;
+    bool truncated = false;
+};
+
 /**
  * @class MagneticAdviser
  * @brief Top-level magnetic component design optimization system.
@@ -81,15 +135,20 @@ namespace OpenMagnetics {
  *
  * ## Known Limitations & Future Improvements
  *
- * **LOGIC-1: No Thermal Coupling** — Core temperature affects winding resistance
- * which affects losses which affects temperature. Current system evaluates independently.
- * TODO: Add 2-3 iteration thermal-electromagnetic coupling loop.
+ * **LOGIC-1: Thermal Coupling Off by Default** — Core temperature affects winding
+ * resistance which affects losses which affects temperature. MagneticSimulator can
+ * iterate the two to a converged hot spot (Settings
+ * magnetic_simulator_thermal_coupling); the adviser keeps the ambient evaluation
+ * unless that setting is enabled.
  *
  * **LOGIC-2: No Loss Balance Optimization** — Industry best practice targets 50/50
  * core-to-copper loss ratio. TODO: Add loss-balance metric to scoring.
  *
- * **LOGIC-3: Linear Scalarization Only** — Cannot find solutions on non-convex
- * Pareto fronts. TODO: For small result sets, add epsilon-constraint or NSGA-II.
+ * **LOGIC-3: Linear Scalarization** — get_advised_magnetic() cannot find
+ * solutions on non-convex Pareto fronts. get_pareto_front() runs an NSGA-II
+ * search over the same objectives instead and returns the whole non-dominated
+ * front; rank_pareto_front() then turns a weight change into a re-ranking of
+ * that front without re-running the adviser.
  *
  * **LOGIC-5: No DC Bias in Material Selection** — Permeability drops significantly
  * under DC bias for powder cores. TODO: Include DC bias in material comparison.
@@ -183,6 +242,17 @@ class MagneticAdviser{
         AdviserConstraints _constraints;
         MAS::MagneticApplication _application = MAS::MagneticApplication::POWER;
         CoreAdviser::CoreAdviserModes _coreAdviserMode = CoreAdviser::CoreAdviserModes::STANDARD_CORES;
+        // Cancellation token / deadline, forwarded to the nested CoreAdviser,
+        // CoilAdviser and MagneticSimulator. When it fires the adviser stops
+        // evaluating new candidates and ranks what it already simulated.
+        StopCondition _stopCondition;
+        std::function<void(const AdviserProgress&)> _progressCallback;
+        bool _lastSearchTruncated = false;
+        // Budget, in approximate bytes, for the simulated candidate pool of
+        // the weighted search. Unset = only the count caps apply.
+        std::optional<size_t> _memoryBudget;
+        size_t _lastSearchPeakCandidateMemory = 0;
+        bool _lastSearchMemoryLimited = false;
 
         MagneticAdviser() {
         }
@@ -196,6 +266,37 @@ class MagneticAdviser{
         MAS::MagneticApplication get_application();
         void set_core_mode(CoreAdviser::CoreAdviserModes value);
         CoreAdviser::CoreAdviserModes get_core_mode();
+        void set_stop_condition(const StopCondition& stopCondition);
+        /// @brief Called on the adviser's thread at every stage change. Publishing
+        /// the current best-k re-scores the candidate pool, so it is only done
+        /// while a callback is installed, and SCORING is sent for the first
+        /// designs found and then at most twice a second. FINISHED always
+        /// carries the final ranking.
+        void set_progress_callback(std::function<void(const AdviserProgress&)> callback);
+        /// @brief True when the last get_advised_magnetic()/get_pareto_front() call
+        /// returned early because its StopCondition fired. A catalogue search
+        /// stopped during the final simulation returns only the designs whose
+        /// outputs were computed.
+        bool get_last_search_truncated() const;
+
+        /// @brief Bound the memory held by simulated candidates during get_advised_magnetic().
+        /// When the pool's estimated size goes over the budget, it is ranked
+        /// and cut to its best candidates (at most maximumNumberResults) that
+        /// fit in half the budget; if the best one alone is over, the search
+        /// stops and ranks what it has. Either way
+        /// get_last_search_memory_limited() reports it. std::nullopt (the
+        /// default) disables the budget.
+        void set_memory_budget(std::optional<size_t> bytes);
+        std::optional<size_t> get_memory_budget() const;
+        /// @brief Largest estimated candidate pool of the last search, in
+        /// bytes; on a result-cache hit, the estimate of the cached designs.
+        size_t get_last_search_peak_candidate_memory() const;
+        /// @brief True when the last search pruned or stopped because of the memory budget.
+        bool get_last_search_memory_limited() const;
+        /// @brief Approximate heap held by one candidate: coil descriptions,
+        /// excitation waveforms and harmonics, and per-element loss outputs.
+        /// Meshes are not counted, they live only while a candidate is simulated.
+        static size_t estimate_candidate_memory(const Mas& mas);
 
         /**
          * @brief Get optimized magnetic designs using default weights.
@@ -247,6 +348,15 @@ class MagneticAdviser{
          * @return Vector of (Mas, score) pairs sorted by descending score.
          */
         std::vector<std::pair<Mas, double>> get_advised_magnetic(Inputs inputs, std::vector<MagneticFilterOperation> filterFlow, size_t maximumNumberResults);
+        /// @brief The search behind get_advised_magnetic(), bypassing the
+        /// result cache (see advisers/AdviserResultCache.h). A cache hit
+        /// returns the stored ranking without searching, so get_scorings()
+        /// is empty after it.
+        std::vector<std::pair<Mas, double>> search_advised_magnetic(Inputs inputs, std::vector<MagneticFilterOperation> filterFlow, size_t maximumNumberResults);
+        /// @brief Everything of a get_advised_magnetic() call that decides its
+        /// ranking, besides Settings and the catalogues; the result-cache key.
+        /// Expects processed Inputs.
+        json get_result_cache_request(const Inputs& inputs, const std::vector<MagneticFilterOperation>& filterFlow, size_t maximumNumberResults) const;
         std::vector<std::pair<Mas, double>> get_advised_magnetic(Inputs inputs, std::vector<Magnetic> catalogueMagnetics, size_t maximumNumberResults=1, bool strict=true);
         std::vector<std::pair<Mas, double>> get_advised_magnetic(Inputs inputs, std::vector<Magnetic> catalogueMagnetics, std::vector<MagneticFilterOperation> filterFlow, size_t maximumNumberResults=1, bool strict=true);
         std::vector<std::pair<Mas, double>> get_advised_magnetic(Inputs inputs, const std::map<std::string, Magnetic>& catalogueMagnetics, std::vector<MagneticFilterOperation> filterFlow, size_t maximumNumberResults=1, bool strict=true);
@@ -274,9 +384,12 @@ class MagneticAdviser{
          * @brief Score a collection of magnetic designs using the filter flow.
          * @param masMagneticsWithCoil Vector of complete magnetic designs to score.
          * @param filterFlow Filter operations defining scoring criteria.
+         * @param recordScorings Whether the raw scores go into the scorings that
+         *        get_scorings() reports. Off for intermediate rankings of a pool
+         *        that is not the final result.
          * @return Vector of (Mas, score) pairs with normalized scores.
          */
-        std::vector<std::pair<Mas, double>> score_magnetics(std::vector<Mas> masMagneticsWithCoil, std::vector<MagneticFilterOperation> filterFlow);
+        std::vector<std::pair<Mas, double>> score_magnetics(std::vector<Mas> masMagneticsWithCoil, std::vector<MagneticFilterOperation> filterFlow, bool recordScorings = true);
 
         /// @brief Print a human-readable summary of a magnetic design.
         static void preview_magnetic(Mas mas);
@@ -290,6 +403,40 @@ class MagneticAdviser{
          */
         std::map<std::string, std::map<MagneticFilters, double>> get_scorings();
 
+        /**
+         * @brief Multi-objective search returning the whole Pareto front.
+         *
+         * NSGA-II (fast non-dominated sorting, crowding distance, binary
+         * tournament, elitist (mu + lambda) survival) over (core, coil)
+         * genomes. CoreAdviser and CoilAdviser act as the variation
+         * operators: mutation moves to a neighbouring core in the CoreAdviser
+         * ranking or to another CoilAdviser variant, crossover takes the core
+         * of one parent and the coil variant of the other. Every generation
+         * is simulated and scored in parallel (see support/Parallel.h).
+         *
+         * Objective direction follows each operation's `invert` flag (true =
+         * minimize the raw value); `weight` and `log` are ignored here and
+         * only matter for rank_pareto_front(). Designs rejected by a filter
+         * are dominated by every accepted one.
+         *
+         * @param inputs Design requirements and operating conditions.
+         * @param objectives Filters to optimize jointly (e.g. COST, LOSSES, DIMENSIONS).
+         * @param options Search budget and seed.
+         * @return The non-dominated designs, sorted by descending crowding distance.
+         */
+        std::vector<ParetoCandidate> get_pareto_front(Inputs inputs, std::vector<MagneticFilterOperation> objectives, ParetoSearchOptions options);
+        std::vector<ParetoCandidate> get_pareto_front(Inputs inputs, ParetoSearchOptions options);
+        std::vector<ParetoCandidate> get_pareto_front(Inputs inputs);
+
+        /**
+         * @brief Scalarize a front with a filter flow, without re-simulating.
+         *
+         * Applies the same normalize_scoring() as score_magnetics() to the
+         * stored raw objectives, so changing weights is a cheap re-ranking.
+         * Filters of the flow that were not objectives of the search are skipped.
+         */
+        static std::vector<std::pair<Mas, double>> rank_pareto_front(const std::vector<ParetoCandidate>& front, std::vector<MagneticFilterOperation> filterFlow, size_t maximumNumberResults);
+
         /**
          * @brief Design magnetics from a converter topology using ngspice simulation.
          * 
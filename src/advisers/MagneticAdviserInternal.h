@@ -0,0 +1,40 @@
+#pragma once
+
+// Internal helpers shared across the MagneticAdviser translation units
+// (MagneticAdviser.cpp, MagneticAdviserPareto.cpp). Not part of the public
+// API; only sibling .cpp files in src/advisers/ (and the tests pinning these
+// helpers) should include this header.
+
+#include "constructive_models/Mas.h"
+#include "processors/MagneticSimulator.h"
+#include "support/Settings.h"
+
+#include <random>
+
+namespace OpenMagnetics {
+
+enum class SimulatedCandidateCheck {
+    SimulationFailed,  // delimit/simulate threw — candidate never counted
+    Saturates,         // simulated, but final isat is below margin * ipeak
+    Passed
+};
+
+// delimit_and_compact (when the caller had additional coordinates enabled)
+// → simulate → final saturation gate on the ASSEMBLED magnetic, shared by the
+// weighted flow (process_wound_candidate) and the Pareto search. Logs why a
+// candidate is dropped. Thread-confined: takes the caller's simulator and
+// Settings and touches no shared state, so parallel evaluators can call it
+// with per-worker instances.
+SimulatedCandidateCheck simulate_and_check_saturation(Mas& mas,
+                                                      MagneticSimulator& magneticSimulator,
+                                                      Settings& settings,
+                                                      bool previousCoilIncludeAdditionalCoordinates);
+
+// Coil variant a Pareto child keeps once its core is settled. Coil pools are
+// per core (CoilAdviser rankings of different lengths), so an index taken
+// from another parent or kept across a core mutation is only reused when it
+// exists in this core's pool, as "the same rank"; otherwise a variant of this
+// pool is drawn uniformly. coilPoolSize must be positive.
+size_t resolve_child_coil_index(size_t coilIndex, size_t coilPoolSize, std::mt19937_64& generator);
+
+} // namespace OpenMagnetics
@@ -0,0 +1,522 @@
+#include "advisers/MagneticAdviser.h"
+#include "advisers/MagneticAdviserInternal.h"
+#include "processors/MagneticSimulator.h"
+#include "support/Exceptions.h"
+#include "support/Parallel.h"
+#include "support/Logger.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <map>
+#include <numeric>
+#include <optional>
+#include <random>
+#include <set>
+
+namespace OpenMagnetics {
+
+namespace {
+
+// A design in the search space: the coreIndex-th core of the CoreAdviser
+// ranking, wound with its coilIndex-th CoilAdviser variant.
+struct ParetoGenome {
+    size_t coreIndex;
+    size_t coilIndex;
+    auto operator<=>(const ParetoGenome&) const = default;
+};
+
+// Simulated and scored genome. `costs` are oriented so that lower is always
+// better: the raw filter value when the operation is inverted, its negation
+// otherwise.
+struct ParetoEvaluation {
+    // Number of objective filters that rejected the design (plus the coil
+    // validity stamp). A design that failed to simulate or saturates gets
+    // numberObjectives + 2 and is never returned.
+    size_t violations = 0;
+    std::vector<double> costs;
+    std::map<MagneticFilters, double> objectives;
+    std::optional<Mas> mas;
+};
+
+// Deb's constrained domination: fewer violations wins outright, and the
+// objectives only decide between fully feasible designs.
+bool dominates(const ParetoEvaluation& a, const ParetoEvaluation& b) {
+    if (a.violations != b.violations) {
+        return a.violations < b.violations;
+    }
+    if (a.violations > 0) {
+        return false;
+    }
+    bool strictlyBetter = false;
+    for (size_t objectiveIndex = 0; objectiveIndex < a.costs.size(); ++objectiveIndex) {
+        if (a.costs[objectiveIndex] > b.costs[objectiveIndex]) {
+            return false;
+        }
+        if (a.costs[objectiveIndex] < b.costs[objectiveIndex]) {
+            strictlyBetter = true;
+        }
+    }
+    return strictlyBetter;
+}
+
+// Deb et al. fast non-dominated sort. Returns fronts of indices into `members`.
+std::vector<std::vector<size_t>> non_dominated_sort(const std::vector<const ParetoEvaluation*>& members) {
+    size_t numberMembers = members.size();
+    std::vector<std::vector<size_t>> dominatedBy(numberMembers);
+    std::vector<size_t> dominationCount(numberMembers, 0);
+    for (size_t i = 0; i < numberMembers; ++i) {
+        for (size_t j = i + 1; j < numberMembers; ++j) {
+            if (dominates(*members[i], *members[j])) {
+                dominatedBy[i].push_back(j);
+                dominationCount[j]++;
+            }
+            else if (dominates(*members[j], *members[i])) {
+                dominatedBy[j].push_back(i);
+                dominationCount[i]++;
+            }
+        }
+    }
+
+    std::vector<std::vector<size_t>> fronts;
+    std::vector<size_t> currentFront;
+    for (size_t i = 0; i < numberMembers; ++i) {
+        if (dominationCount[i] == 0) {
+            currentFront.push_back(i);
+        }
+    }
+    while (!currentFront.empty()) {
+        std::vector<size_t> nextFront;
+        for (auto i : currentFront) {
+            for (auto j : dominatedBy[i]) {
+                if (--dominationCount[j] == 0) {
+                    nextFront.push_back(j);
+                }
+            }
+        }
+        std::sort(nextFront.begin(), nextFront.end());
+        fronts.push_back(std::move(currentFront));
+        currentFront = std::move(nextFront);
+    }
+    return fronts;
+}
+
+// NSGA-II crowding distance of each member of `front` (same order). Extremes
+// of every objective get +inf so the front keeps its span. Infeasible fronts
+// carry no meaningful objectives and all get 0.
+std::vector<double> crowding_distances(const std::vector<const ParetoEvaluation*>& members, const std::vector<size_t>& front) {
+    std::vector<double> distances(front.size(), 0);
+    if (front.empty() || members[front[0]]->violations > 0) {
+        return distances;
+    }
+    if (front.size() <= 2) {
+        std::fill(distances.begin(), distances.end(), std::numeric_limits<double>::infinity());
+        return distances;
+    }
+    size_t numberObjectives = members[front[0]]->costs.size();
+    std::vector<size_t> order(front.size());
+    for (size_t objectiveIndex = 0; objectiveIndex < numberObjectives; ++objectiveIndex) {
+        std::iota(order.begin(), order.end(), 0);
+        std::stable_sort(order.begin(), order.end(), [&](size_t a, size_t b) {
+            return members[front[a]]->costs[objectiveIndex] < members[front[b]]->costs[objectiveIndex];
+        });
+        double minimum = members[front[order.front()]]->costs[objectiveIndex];
+        double maximum = members[front[order.back()]]->costs[objectiveIndex];
+        distances[order.front()] = std::numeric_limits<double>::infinity();
+        distances[order.back()] = std::numeric_limits<double>::infinity();
+        if (!(maximum > minimum) || !std::isfinite(maximum - minimum)) {
+            continue;
+        }
+        for (size_t k = 1; k + 1 < order.size(); ++k) {
+            distances[order[k]] += (members[front[order[k + 1]]]->costs[objectiveIndex] -
+                                    members[front[order[k - 1]]]->costs[objectiveIndex]) / (maximum - minimum);
+        }
+    }
+    return distances;
+}
+
+} // namespace
+
+size_t resolve_child_coil_index(size_t coilIndex, size_t coilPoolSize, std::mt19937_64& generator) {
+    if (coilIndex < coilPoolSize) {
+        return coilIndex;
+    }
+    return std::uniform_int_distribution<size_t>(0, coilPoolSize - 1)(generator);
+}
+
+std::vector<ParetoCandidate> MagneticAdviser::get_pareto_front(Inputs inputs) {
+    return get_pareto_front(inputs, _defaultCustomMagneticFilterFlow, ParetoSearchOptions());
+}
+
+std::vector<ParetoCandidate> MagneticAdviser::get_pareto_front(Inputs inputs, ParetoSearchOptions options) {
+    return get_pareto_front(inputs, _defaultCustomMagneticFilterFlow, options);
+}
+
+std::vector<ParetoCandidate> MagneticAdviser::get_pareto_front(Inputs inputs, std::vector<MagneticFilterOperation> objectives, ParetoSearchOptions options) {
+    if (objectives.empty()) {
+        throw InvalidInputException("get_pareto_front needs at least one objective");
+    }
+    if (options.populationSize < 2) {
+        throw InvalidInputException("get_pareto_front needs a population of at least 2 designs");
+    }
+    clear_scoring();
+    _failedScorings.clear();
+    _lastSearchTruncated = false;
+    load_filter_flow(objectives, inputs);
+
+    // Same catalog preconditions as get_advised_magnetic: inside a
+    // LibraryContext scope the (possibly empty) catalogs are the inventory.
+    if (coreDatabase.empty() && !LibraryContext::Scope::anyActive()) {
+        load_cores();
+    }
+    if (wireDatabase.empty() && !LibraryContext::Scope::anyActive()) {
+        load_wires();
+    }
+
+    bool previousCoilIncludeAdditionalCoordinates = settings.get_coil_include_additional_coordinates();
+    SettingsGuard<bool> coilIncludeCoordinatesGuard(settings,
+        &Settings::get_coil_include_additional_coordinates,
+        &Settings::set_coil_include_additional_coordinates, false);
+
+    // Core pool: the CoreAdviser ranking, so that neighbouring indices are
+    // similar cores and a ±1..2 index shift is a small mutation.
+    std::map<CoreAdviser::CoreAdviserFilters, double> coreWeights;
+    for (auto& objective : objectives) {
+        if (objective.get_filter() == MagneticFilters::COST) {
+            coreWeights[CoreAdviser::CoreAdviserFilters::COST] = 1.0;
+        }
+        if (objective.get_filter() == MagneticFilters::DIMENSIONS) {
+            coreWeights[CoreAdviser::CoreAdviserFilters::DIMENSIONS] = 1.0;
+        }
+        if (objective.get_filter() == MagneticFilters::LOSSES) {
+            coreWeights[CoreAdviser::CoreAdviserFilters::EFFICIENCY] = 1.0;
+        }
+    }
+    CoreAdviser coreAdviser;
+    coreAdviser.set_unique_core_shapes(true);
+    coreAdviser.set_application(get_application());
+    coreAdviser.set_mode(get_core_mode());
+    coreAdviser.set_stop_condition(_stopCondition);
+    std::vector<Mas> corePool;
+    {
+        std::set<std::string> usedCoreNames;
+        for (auto& [mas, coreScoring] : coreAdviser.get_advised_core(inputs, coreWeights, options.maximumNumberCores, nullptr, _constraints)) {
+            auto coreNameOpt = mas.get_magnetic().get_core().get_name();
+            if (!coreNameOpt || !usedCoreNames.insert(coreNameOpt.value()).second) {
+                continue;
+            }
+            corePool.push_back(mas);
+        }
+    }
+    if (corePool.empty()) {
+        logEntry("Pareto search: CoreAdviser returned no cores", "MagneticAdviser", 1);
+        return {};
+    }
+
+    // Coil pools are wound lazily, on this thread, the first time the search
+    // visits a core: CoilAdviser is the most expensive generator and most of
+    // the core ranking is never reached.
+    CoilAdviser coilAdviser;
+    coilAdviser.set_wire_constraints(_constraints);
+    coilAdviser.set_stop_condition(_stopCondition);
+    std::vector<std::optional<std::vector<Mas>>> coilPools(corePool.size());
+    auto get_coil_pool = [&](size_t coreIndex) -> const std::vector<Mas>& {
+        auto& pool = coilPools[coreIndex];
+        if (!pool) {
+            pool = std::vector<Mas>();
+            for (auto& mas : coilAdviser.get_advised_coil(corePool[coreIndex], std::max(size_t(1), options.coilsPerCore))) {
+                auto sectionsOpt = mas.get_magnetic().get_coil().get_sections_description();
+                if (!sectionsOpt || sectionsOpt->empty() || !mas.get_magnetic().get_coil().get_turns_description()) {
+                    continue;
+                }
+                pool->push_back(mas);
+            }
+        }
+        return *pool;
+    };
+
+    std::mt19937_64 generator(options.seed);
+    std::uniform_real_distribution<double> uniform(0.0, 1.0);
+    std::map<ParetoGenome, ParetoEvaluation> archive;
+
+    // Every generation runs under the caller's configuration, captured once.
+    auto settingsSnapshot = SettingsSnapshot::capture();
+
+    // Simulate and score every not-yet-seen genome of `genomes` in parallel.
+    // Each index owns its simulator and filters (they carry member state) and
+    // writes only its own slot, so the archive is identical for any thread count.
+    size_t numberObjectives = objectives.size();
+    auto evaluate = [&](const std::vector<ParetoGenome>& genomes) {
+        std::vector<ParetoGenome> pending;
+        for (auto& genome : genomes) {
+            if (!archive.contains(genome) && std::find(pending.begin(), pending.end(), genome) == pending.end()) {
+                pending.push_back(genome);
+            }
+        }
+        std::vector<const Mas*> seeds;
+        for (auto& genome : pending) {
+            seeds.push_back(&get_coil_pool(genome.coreIndex)[genome.coilIndex]);
+        }
+        std::vector<ParetoEvaluation> evaluations(pending.size());
+        parallel_for(pending.size(), settingsSnapshot, [&](size_t index) {
+            auto& evaluation = evaluations[index];
+            evaluation.costs.assign(numberObjectives, std::numeric_limits<double>::infinity());
+            Mas mas = *seeds[index];
+            MagneticSimulator magneticSimulator;
+            magneticSimulator.set_stop_condition(_stopCondition);
+            auto check = simulate_and_check_saturation(mas, magneticSimulator, Settings::GetInstance(), previousCoilIncludeAdditionalCoordinates);
+            if (check != SimulatedCandidateCheck::Passed) {
+                evaluation.violations = numberObjectives + 2;
+                return;
+            }
+            if (coil_failed_validity_filters(mas)) {
+                evaluation.violations++;
+            }
+            for (size_t objectiveIndex = 0; objectiveIndex < numberObjectives; ++objectiveIndex) {
+                auto& objective = objectives[objectiveIndex];
+                try {
+                    auto filter = MagneticFilter::factory(objective.get_filter(), inputs);
+                    auto [valid, scoring] = filter->evaluate_magnetic(&mas.get_mutable_magnetic(), &mas.get_mutable_inputs());
+                    evaluation.objectives[objective.get_filter()] = scoring;
+                    if (!valid || !std::isfinite(scoring)) {
+                        evaluation.violations++;
+                        continue;
+                    }
+                    evaluation.costs[objectiveIndex] = objective.get_invert()? scoring : -scoring;
+                }
+                catch (const std::exception& e) {
+                    logEntry([&] { return std::string("Pareto search: objective evaluation failed: ") + e.what(); }, "MagneticAdviser", 2);
+                    evaluation.violations++;
+                }
+            }
+            evaluation.mas = std::move(mas);
+        });
+        for (size_t index = 0; index < pending.size(); ++index) {
+            archive[pending[index]] = std::move(evaluations[index]);
+        }
+
+        // A design dominated by anything in the archive stays dominated for
+        // the rest of the search, so only the current archive front needs to
+        // keep its simulated Mas. Bounds memory like the candidate caps of
+        // get_advised_magnetic do.
+        std::vector<const ParetoEvaluation*> members;
+        std::vector<ParetoEvaluation*> mutableMembers;
+        for (auto& [genome, evaluation] : archive) {
+            members.push_back(&evaluation);
+            mutableMembers.push_back(&evaluation);
+        }
+        auto fronts = non_dominated_sort(members);
+        for (size_t frontIndex = 1; frontIndex < fronts.size(); ++frontIndex) {
+            for (auto memberIndex : fronts[frontIndex]) {
+                mutableMembers[memberIndex]->mas.reset();
+            }
+        }
+    };
+
+    // Initial population: the best CoilAdviser variant of the top-ranked
+    // cores, then second variants, until the population is full.
+    std::vector<ParetoGenome> population;
+    for (size_t coilIndex = 0; coilIndex < std::max(size_t(1), options.coilsPerCore) && population.size() < options.populationSize; ++coilIndex) {
+        for (size_t coreIndex = 0; coreIndex < corePool.size() && population.size() < options.populationSize; ++coreIndex) {
+            if (coilIndex < get_coil_pool(coreIndex).size()) {
+                population.push_back({coreIndex, coilIndex});
+            }
+        }
+    }
+    if (population.empty()) {
+        logEntry("Pareto search: no core could be wound", "MagneticAdviser", 1);
+        return {};
+    }
+    logEntry([&] { return "Pareto search: initial population of " + std::to_string(population.size()); }, "MagneticAdviser", 2);
+    evaluate(population);
+
+    auto mutate = [&](ParetoGenome genome) {
+        const auto& coilPool = get_coil_pool(genome.coreIndex);
+        bool mutateCoil = coilPool.size() > 1 && (corePool.size() == 1 || uniform(generator) < 0.5);
+        if (mutateCoil) {
+            size_t offset = 1 + std::uniform_int_distribution<size_t>(0, coilPool.size() - 2)(generator);
+            genome.coilIndex = (genome.coilIndex + offset) % coilPool.size();
+        }
+        else if (corePool.size() > 1) {
+            long step = std::uniform_int_distribution<long>(1, 2)(generator);
+            if (uniform(generator) < 0.5) {
+                step = -step;
+            }
+            long coreIndex = std::clamp(long(genome.coreIndex) + step, 0L, long(corePool.size()) - 1);
+            genome.coreIndex = size_t(coreIndex);
+        }
+        return genome;
+    };
+
+    for (size_t generation = 0; generation < options.numberGenerations; ++generation) {
+        if (_stopCondition.should_stop()) {
+            logEntry([&] { return "Pareto search: stop requested after " + std::to_string(generation) + " generations"; }, "MagneticAdviser", 1);
+            _lastSearchTruncated = true;
+            break;
+        }
+        std::vector<const ParetoEvaluation*> members;
+        for (auto& genome : population) {
+            members.push_back(&archive.at(genome));
+        }
+        std::vector<size_t> ranks(population.size());
+        std::vector<double> crowding(population.size());
+        auto fronts = non_dominated_sort(members);
+        for (size_t frontIndex = 0; frontIndex < fronts.size(); ++frontIndex) {
+            auto distances = crowding_distances(members, fronts[frontIndex]);
+            for (size_t k = 0; k < fronts[frontIndex].size(); ++k) {
+                ranks[fronts[frontIndex][k]] = frontIndex;
+                crowding[fronts[frontIndex][k]] = distances[k];
+            }
+        }
+        auto tournament = [&]() {
+            std::uniform_int_distribution<size_t> pick(0, population.size() - 1);
+            size_t a = pick(generator);
+            size_t b = pick(generator);
+            if (ranks[a] != ranks[b]) {
+                return ranks[a] < ranks[b]? a : b;
+            }
+            if (crowding[a] != crowding[b]) {
+                return crowding[a] > crowding[b]? a : b;
+            }
+            return std::min(a, b);
+        };
+
+        std::vector<ParetoGenome> offspring;
+        for (size_t attempt = 0; offspring.size() < options.populationSize && attempt < options.populationSize * 10; ++attempt) {
+            auto child = population[tournament()];
+            if (uniform(generator) < options.crossoverProbability) {
+                // Core of one parent, coil rank of the other (re-drawn below
+                // when this core has fewer variants).
+                child.coilIndex = population[tournament()].coilIndex;
+            }
+            if (uniform(generator) < options.mutationProbability) {
+                child = mutate(child);
+            }
+            const auto& coilPool = get_coil_pool(child.coreIndex);
+            if (coilPool.empty()) {
+                continue;
+            }
+            child.coilIndex = resolve_child_coil_index(child.coilIndex, coilPool.size(), generator);
+            if (archive.contains(child) || std::find(offspring.begin(), offspring.end(), child) != offspring.end()) {
+                continue;
+            }
+            offspring.push_back(child);
+        }
+        if (offspring.empty()) {
+            logEntry([&] { return "Pareto search: design space exhausted after " + std::to_string(generation) + " generations"; }, "MagneticAdviser", 2);
+            break;
+        }
+        evaluate(offspring);
+
+        // Elitist (mu + lambda) survival: whole fronts first, the last one
+        // that does not fit truncated by descending crowding distance.
+        std::vector<ParetoGenome> combined = population;
+        combined.insert(combined.end(), offspring.begin(), offspring.end());
+        std::vector<const ParetoEvaluation*> combinedMembers;
+        for (auto& genome : combined) {
+            combinedMembers.push_back(&archive.at(genome));
+        }
+        std::vector<ParetoGenome> nextPopulation;
+        for (auto& front : non_dominated_sort(combinedMembers)) {
+            if (nextPopulation.size() + front.size() <= options.populationSize) {
+                for (auto memberIndex : front) {
+                    nextPopulation.push_back(combined[memberIndex]);
+                }
+                continue;
+            }
+            auto distances = crowding_distances(combinedMembers, front);
+            std::vector<size_t> order(front.size());
+            std::iota(order.begin(), order.end(), 0);
+            std::stable_sort(order.begin(), order.end(), [&](size_t a, size_t b) { return distances[a] > distances[b]; });
+            for (size_t k = 0; nextPopulation.size() < options.populationSize; ++k) {
+                nextPopulation.push_back(combined[front[order[k]]]);
+            }
+            break;
+        }
+        population = std::move(nextPopulation);
+        logEntry([&] { return "Pareto search: generation " + std::to_string(generation + 1) + " evaluated " + std::to_string(offspring.size()) + " designs"; }, "MagneticAdviser", 2);
+    }
+
+    // The returned front is non-dominated over EVERYTHING evaluated, not just
+    // the last population. When nothing is fully feasible it is the least
+    // violating simulated set, as the weighted flow keeps invalid fallbacks
+    // only when no valid design exists.
+    std::vector<const ParetoEvaluation*> members;
+    for (auto& [genome, evaluation] : archive) {
+        if (evaluation.violations <= numberObjectives + 1 && evaluation.mas) {
+            members.push_back(&evaluation);
+        }
+    }
+    std::vector<ParetoCandidate> front;
+    if (members.empty()) {
+        return front;
+    }
+    auto fronts = non_dominated_sort(members);
+    auto distances = crowding_distances(members, fronts[0]);
+    for (size_t k = 0; k < fronts[0].size(); ++k) {
+        auto& evaluation = *members[fronts[0][k]];
+        ParetoCandidate candidate;
+        candidate.mas = evaluation.mas.value();
+        candidate.objectives = evaluation.objectives;
+        candidate.rank = 0;
+        candidate.crowdingDistance = distances[k];
+        for (auto& [filter, scoring] : candidate.objectives) {
+            add_scoring(candidate.mas.get_mutable_magnetic().get_reference(), filter, scoring);
+        }
+        front.push_back(std::move(candidate));
+    }
+    std::sort(front.begin(), front.end(), [](ParetoCandidate& a, ParetoCandidate& b) {
+        if (a.crowdingDistance != b.crowdingDistance) {
+            return a.crowdingDistance > b.crowdingDistance;
+        }
+        return a.mas.get_mutable_magnetic().get_reference() < b.mas.get_mutable_magnetic().get_reference();
+    });
+    logEntry([&] { return "Pareto search: front of " + std::to_string(front.size()) + " designs out of " + std::to_string(archive.size()) + " evaluated"; }, "MagneticAdviser", 2);
+    return front;
+}
+
+std::vector<std::pair<Mas, double>> MagneticAdviser::rank_pareto_front(const std::vector<ParetoCandidate>& front, std::vector<MagneticFilterOperation> filterFlow, size_t maximumNumberResults) {
+    std::vector<std::pair<Mas, double>> masMagneticsWithScoring;
+    for (auto& candidate : front) {
+        masMagneticsWithScoring.push_back({candidate.mas, 0.0});
+    }
+    if (masMagneticsWithScoring.empty()) {
+        return masMagneticsWithScoring;
+    }
+    for (auto& filterConfiguration : filterFlow) {
+        std::vector<double> scorings;
+        for (auto& candidate : front) {
+            auto it = candidate.objectives.find(filterConfiguration.get_filter());
+            if (it == candidate.objectives.end()) {
+                break;
+            }
+            scorings.push_back(it->second);
+        }
+        if (scorings.size() != front.size()) {
+            continue;  // not an objective of the search
+        }
+        normalize_scoring(&masMagneticsWithScoring, scorings, filterConfiguration);
+    }
+
+    // Same stack penalty as score_magnetics, so a re-ranking matches what a
+    // weighted run would have produced for these designs.
+    for (auto& [mas, scoring] : masMagneticsWithScoring) {
+        auto numStacksOpt = mas.get_magnetic().get_core().get_functional_description().get_number_stacks();
+        if (numStacksOpt && numStacksOpt.value() > 1) {
+            scoring *= (1.0 - (numStacksOpt.value() - 1) * 0.15);
+        }
+    }
+
+    std::sort(masMagneticsWithScoring.begin(), masMagneticsWithScoring.end(), [](std::pair<Mas, double>& b1, std::pair<Mas, double>& b2) {
+        if (b1.second != b2.second) {
+            return b1.second > b2.second;
+        }
+        return b1.first.get_mutable_magnetic().get_reference() < b2.first.get_mutable_magnetic().get_reference();
+    });
+    if (masMagneticsWithScoring.size() > maximumNumberResults) {
+        masMagneticsWithScoring.erase(masMagneticsWithScoring.begin() + maximumNumberResults, masMagneticsWithScoring.end());
+    }
+    return masMagneticsWithScoring;
+}
+
+} // namespace OpenMagnetics
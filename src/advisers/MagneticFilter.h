@@ -1,6 +1,7 @@
 #pragma once
 #include "physical_models/Temperature.h"
 #include "physical_models/CoreLosses.h"
+#include "physical_models/CoreTemperature.h"
 #include "physical_models/Impedance.h"
 #include "physical_models/MagneticEnergy.h"
 #include "physical_models/MagnetizingInductance.h"
@@ -372,6 +373,7 @@ class MagneticFilterHeight : public MagneticFilter {
 class MagneticFilterTemperatureRise : public MagneticFilter {
     private:
         MagneticFilterLossesNoProximity _magneticFilterLossesNoProximity;
+        std::shared_ptr<CoreTemperatureModel> _coreTemperatureModel;  // resolved on first use
     public:
         MagneticFilterTemperatureRise() {};
         std::pair<bool, double> evaluate_magnetic(Magnetic* magnetic, Inputs* inputs, std::vector<Outputs>* outputs = nullptr);
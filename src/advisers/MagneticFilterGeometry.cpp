@@ -151,7 +151,9 @@ std::pair<bool, double> MagneticFilterHeight::evaluate_magnetic(Magnetic* magnet
 std::pair<bool, double> MagneticFilterTemperatureRise::evaluate_magnetic(Magnetic* magnetic, Inputs* inputs, std::vector<Outputs>* outputs) {
     double losses = cached_or_compute_scoring(magnetic, inputs, outputs, MagneticFilters::LOSSES_NO_PROXIMITY, _magneticFilterLossesNoProximity);
 
-    auto coreTemperatureModel = CoreTemperatureModel::factory(defaults.coreTemperatureModelDefault);
+    if (!_coreTemperatureModel) {
+        _coreTemperatureModel = CoreTemperatureModel::factory(defaults.coreTemperatureModelDefault);
+    }
 
     // Base the temperature rise on the actual operating-point ambient, not a hardcoded 25 degC
     // default: a design specified at an 85 degC ambient runs hotter than one at 25 degC, and the
@@ -161,7 +163,7 @@ std::pair<bool, double> MagneticFilterTemperatureRise::evaluate_magnetic(Magneti
     if (inputs != nullptr && !inputs->get_operating_points().empty()) {
         ambientTemperature = inputs->get_maximum_temperature();
     }
-    auto coreTemperature = coreTemperatureModel->get_core_temperature(magnetic->get_core(), losses, ambientTemperature);
+    auto coreTemperature = _coreTemperatureModel->get_core_temperature(magnetic->get_core(), losses, ambientTemperature);
     double calculatedTemperature = coreTemperature.get_maximum_temperature();
 
     return {true, calculatedTemperature};
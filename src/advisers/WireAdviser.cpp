@@ -742,19 +742,19 @@ std::vector<std::pair<Winding, double>> WireAdviser::get_advised_planar_wire(Win
                                                                                                size_t maximumNumberResults) {
     auto coilsWithScoring = create_planar_dataset(winding, section, current, temperature, numberSections);
 
-    logEntry("We start the search with " + std::to_string(coilsWithScoring.size()) + " wires");
+    logEntry([&] { return "We start the search with " + std::to_string(coilsWithScoring.size()) + " wires"; });
 
     coilsWithScoring = filter_by_effective_resistance(&coilsWithScoring, current, temperature);
-    logEntry("There are " + std::to_string(coilsWithScoring.size()) + " planar wires after filtering by effective resistance.");
+    logEntry([&] { return "There are " + std::to_string(coilsWithScoring.size()) + " planar wires after filtering by effective resistance."; });
 
     // WA-BUG-1 FIX: guard with harmonics check (matches get_advised_wire)
     if (current.get_harmonics()) {
         coilsWithScoring = filter_by_skin_losses_density(&coilsWithScoring, current, temperature);
-        logEntry("There are " + std::to_string(coilsWithScoring.size()) + " planar wires after filtering by skin losses density.");
+        logEntry([&] { return "There are " + std::to_string(coilsWithScoring.size()) + " planar wires after filtering by skin losses density."; });
     }
 
     coilsWithScoring = filter_by_proximity_factor(&coilsWithScoring, current, temperature);
-    logEntry("There are " + std::to_string(coilsWithScoring.size()) + " planar wires after filtering by proximity factor.");
+    logEntry([&] { return "There are " + std::to_string(coilsWithScoring.size()) + " planar wires after filtering by proximity factor."; });
 
     break_score_ties(&coilsWithScoring);
 
@@ -784,37 +784,37 @@ std::vector<std::pair<Winding, double>> WireAdviser::get_advised_wire(std::vecto
     auto coilsWithScoring = create_dataset(winding, wires, section, current, temperature);
 
 
-    logEntry("We start the search with " + std::to_string(coilsWithScoring.size()) + " wires");
+    logEntry([&] { return "We start the search with " + std::to_string(coilsWithScoring.size()) + " wires"; });
     coilsWithScoring = filter_by_area_no_parallels(&coilsWithScoring, section);
-    logEntry("There are " + std::to_string(coilsWithScoring.size()) + " after filtering by area no parallels.");
+    logEntry([&] { return "There are " + std::to_string(coilsWithScoring.size()) + " after filtering by area no parallels."; });
 
     if (_wireSolidInsulationRequirements) {
         coilsWithScoring = filter_by_solid_insulation_requirements(&coilsWithScoring, _wireSolidInsulationRequirements.value());
-        logEntry("There are " + std::to_string(coilsWithScoring.size()) + " after filtering by solid insulation.");
+        logEntry([&] { return "There are " + std::to_string(coilsWithScoring.size()) + " after filtering by solid insulation."; });
     }
 
     auto tempCoilsWithScoring = filter_by_area_with_parallels(&coilsWithScoring, section, numberSections, false);
-    logEntry("There are " + std::to_string(tempCoilsWithScoring.size()) + " after filtering by area with parallels.");
+    logEntry([&] { return "There are " + std::to_string(tempCoilsWithScoring.size()) + " after filtering by area with parallels."; });
 
     if (tempCoilsWithScoring.size() == 0) {
         coilsWithScoring = filter_by_area_with_parallels(&coilsWithScoring, section, numberSections, true);
-        logEntry("There are " + std::to_string(coilsWithScoring.size()) + " after filtering by area with parallels, allowing not fitting.");
+        logEntry([&] { return "There are " + std::to_string(coilsWithScoring.size()) + " after filtering by area with parallels, allowing not fitting."; });
     }
     else{
         coilsWithScoring = tempCoilsWithScoring;
     }
 
     coilsWithScoring = filter_by_effective_resistance(&coilsWithScoring, current, temperature);
-    logEntry("There are " + std::to_string(coilsWithScoring.size()) + " after filtering by effective resistance.");
+    logEntry([&] { return "There are " + std::to_string(coilsWithScoring.size()) + " after filtering by effective resistance."; });
 
     // Skin losses density filter requires harmonics data
     if (current.get_harmonics()) {
         coilsWithScoring = filter_by_skin_losses_density(&coilsWithScoring, current, temperature);
-        logEntry("There are " + std::to_string(coilsWithScoring.size()) + " after filtering by skin losses density.");
+        logEntry([&] { return "There are " + std::to_string(coilsWithScoring.size()) + " after filtering by skin losses density."; });
     }
 
     coilsWithScoring = filter_by_proximity_factor(&coilsWithScoring, current, temperature);
-    logEntry("There are " + std::to_string(coilsWithScoring.size()) + " after filtering by proximity factor.");
+    logEntry([&] { return "There are " + std::to_string(coilsWithScoring.size()) + " after filtering by proximity factor."; });
 
     break_score_ties(&coilsWithScoring);
 
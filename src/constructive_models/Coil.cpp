@@ -20,6 +20,7 @@
 #include "physical_models/WindingOhmicLosses.h"
 #include "support/Exceptions.h"
 #include "support/Logger.h"
+#include "support/WorkCounters.h"
 
 using json = nlohmann::json;
 
@@ -4059,6 +4060,7 @@ std::vector<size_t> Coil::extract_stack_up(std::vector<Section> sections) {
 }
 
 bool Coil::wind(std::vector<double> proportionPerWinding, std::vector<size_t> pattern, size_t repetitions) {
+    count_work(WorkCounter::COIL_WIND);
     // ABT #850: a failed wind must not poison the coil. The ABT #676 margin recovery
     // below loads persisted section margins into TRANSIENT members
     // (_marginsPerSection and friends) that outlive the wind and survive clearing the
@@ -2017,7 +2017,7 @@ double Core::get_reluctance(double temperature){
     auto coreMaterial = resolve_material();
     InitialPermeability initialPermeability;
     auto initialPermeabilityValue = initialPermeability.get_initial_permeability(coreMaterial, temperature, std::nullopt, std::nullopt);
-    auto reluctanceModel = ReluctanceModel::factory();
+    ReluctanceModelHandle reluctanceModel;
 
     auto magnetizingInductanceOutput = reluctanceModel->get_core_reluctance(*this, initialPermeabilityValue);
     double calculatedReluctance = magnetizingInductanceOutput.get_core_reluctance();
@@ -2030,7 +2030,7 @@ double Core::get_resistivity(double temperature){
 }
 
 double Core::get_resistivity(CoreMaterial coreMaterial, double temperature){
-    auto resistivityModel = ResistivityModel::factory(ResistivityModels::CORE_MATERIAL);
+    auto& resistivityModel = ResistivityModel::get_shared(ResistivityModels::CORE_MATERIAL);
     auto resistivity = (*resistivityModel).get_resistivity(coreMaterial, temperature);
     return resistivity;
 }
@@ -7,10 +7,14 @@
 #include "constructive_models/Wire.h"
 #include "constructive_models/Bobbin.h"
 
+#include <memory>
+
 using namespace MAS;
 
 namespace OpenMagnetics {
 
+class CoilMeshCache;
+
 class Magnetic : public MAS::Magnetic {
     private:
         // core/coil are optional because, as of the MAS chip_beads_datasheet_schema
@@ -24,6 +28,7 @@ class Magnetic : public MAS::Magnetic {
         std::optional<MagneticManufacturerInfo> manufacturer_info;
         std::optional<std::vector<double>> _maximumDimensions;
         std::optional<Coil> coil;
+        std::shared_ptr<CoilMeshCache> _coilMeshCache;
     public:
         Magnetic() = default;
         virtual ~Magnetic() = default;
@@ -76,6 +81,13 @@ class Magnetic : public MAS::Magnetic {
         const std::optional<MagneticManufacturerInfo>& get_manufacturer_info() const { return manufacturer_info; }
         void set_manufacturer_info(std::optional<MagneticManufacturerInfo> v) { manufacturer_info = v; }
 
+        // Geometry-only coil mesh (support/CoilMesher.h). Copies of this magnetic
+        // share the same cache, so attaching one before handing the magnetic to
+        // the simulator, the leakage model or the painter lets all of them reuse
+        // the meshed turns. Not serialized.
+        const std::shared_ptr<CoilMeshCache>& get_coil_mesh_cache() const { return _coilMeshCache; }
+        void set_coil_mesh_cache(std::shared_ptr<CoilMeshCache> cache) { _coilMeshCache = std::move(cache); }
+
         Bobbin get_bobbin();
         std::vector<Wire> get_wires();
         std::vector<double> get_turns_ratios() const;
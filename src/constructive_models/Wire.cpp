@@ -2144,7 +2144,7 @@ namespace OpenMagnetics {
     Wire Wire::get_wire_for_dc_resistance_per_meter(double dcResistancePerMeter, double temperature) {
         WireMaterial wireMaterial = find_wire_material_by_name(defaults.defaultConductorMaterial);;
 
-        auto resistivityModel = ResistivityModel::factory(ResistivityModels::WIRE_MATERIAL);
+        auto& resistivityModel = ResistivityModel::get_shared(ResistivityModels::WIRE_MATERIAL);
         auto resistivity = (*resistivityModel).get_resistivity(wireMaterial, temperature);
 
         double wireConductingArea = resistivity / dcResistancePerMeter;
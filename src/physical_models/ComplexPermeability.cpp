@@ -4,6 +4,7 @@
 #include "support/Utils.h"
 #include <algorithm>
 #include <math.h>
+#include <tuple>
 #include "support/Exceptions.h"
 
 
@@ -225,7 +226,30 @@ ComplexPermeabilityData ComplexPermeability::calculate_complex_permeability_from
 }
 
 
-std::pair<double, double> ComplexPermeability::get_complex_permeability(CoreMaterial coreMaterial, double frequency) {
+namespace {
+
+void build_complex_permeability_interpolator(std::vector<PermeabilityPoint> permeabilityPoints, const std::string& materialName,
+                                             std::map<std::string, tk::spline>& interps, std::map<std::string, std::pair<double, double>>& frequencySpans) {
+    std::vector<double> x, y;
+
+    std::sort(permeabilityPoints.begin(), permeabilityPoints.end(), [](const PermeabilityPoint& b1, const PermeabilityPoint& b2) {
+        return b1.get_frequency().value() < b2.get_frequency().value();
+    });
+
+    for (const auto& permeabilityPoint : permeabilityPoints) {
+        if (x.empty() || fabs(*permeabilityPoint.get_frequency() - x.back()) > 1e-9) {
+            x.push_back(*permeabilityPoint.get_frequency());
+            y.push_back(permeabilityPoint.get_value());
+        }
+    }
+
+    interps[materialName] = tk::spline(x, y, tk::spline::cspline_hermite);
+    frequencySpans[materialName] = {x.front(), x.back()};
+}
+
+} // namespace
+
+ComplexPermeabilityInterpolators ComplexPermeability::resolve_interpolators(const CoreMaterial& coreMaterial) {
     // Fast path: if both interpolators are already cached for this material,
     // skip the expensive recomputation of the complex permeability data
     // (calculate_frequency_for_initial_permeability_drop runs O(40) pow() per
@@ -233,102 +257,59 @@ std::pair<double, double> ComplexPermeability::get_complex_permeability(CoreMate
     // that scan thousands of cores share only a few materials and end up
     // rebuilding the same per-material curves thousands of times, which
     // dominates DMC/CMC core selection wall time.
-    const std::string& materialNameForCache = coreMaterial.get_name();
-    if (complexPermeabilityRealInterps.contains(materialNameForCache) &&
-        complexPermeabilityImaginaryInterps.contains(materialNameForCache)) {
-        auto realSpan = complexPermeabilityRealFrequencySpans[materialNameForCache];
-        double cachedReal = std::max(1., complexPermeabilityRealInterps[materialNameForCache](std::clamp(frequency, realSpan.first, realSpan.second)));
-        if (std::isnan(cachedReal)) {
-            throw NaNResultException("complex Permeability real part must be a number, not NaN");
-        }
-        auto imaginarySpan = complexPermeabilityImaginaryFrequencySpans[materialNameForCache];
-        double cachedImag = complexPermeabilityImaginaryInterps[materialNameForCache](std::clamp(frequency, imaginarySpan.first, imaginarySpan.second));
-        if (std::isnan(cachedImag)) {
-            throw NaNResultException("complex Permeability imaginary part must be a number, not NaN");
-        }
-        return {cachedReal, cachedImag};
-    }
-
-    ComplexPermeabilityData complexPermeabilityData;
-    if (!coreMaterial.get_permeability().get_complex()) {
-        if (InitialPermeability::has_frequency_dependency(coreMaterial)) {
-            complexPermeabilityData = calculate_complex_permeability_from_frequency_dependent_initial_permeability(coreMaterial);
+    const std::string& materialName = coreMaterial.get_name();
+    if (!complexPermeabilityRealInterps.contains(materialName) ||
+        !complexPermeabilityImaginaryInterps.contains(materialName)) {
+        ComplexPermeabilityData complexPermeabilityData;
+        if (!coreMaterial.get_permeability().get_complex()) {
+            if (InitialPermeability::has_frequency_dependency(coreMaterial)) {
+                complexPermeabilityData = calculate_complex_permeability_from_frequency_dependent_initial_permeability(coreMaterial);
+            }
+            else {
+                throw MaterialDataMissingException(materialName, "Complex permeability");
+            }
         }
         else {
-            throw MaterialDataMissingException(coreMaterial.get_name(), "Complex permeability");
+            complexPermeabilityData = coreMaterial.get_permeability().get_complex().value();
         }
-    }
-    else {
-        complexPermeabilityData = coreMaterial.get_permeability().get_complex().value();
-    }
-
-    auto realPart = complexPermeabilityData.get_real();
-    auto imaginaryPart = complexPermeabilityData.get_imaginary();
-
-    if (!std::holds_alternative<std::vector<PermeabilityPoint>>(realPart) ||
-        !std::holds_alternative<std::vector<PermeabilityPoint>>(imaginaryPart)) {
-        throw InvalidInputException(ErrorCode::MISSING_DATA, "Complex permeability data is not in expected format for " + coreMaterial.get_name());
-    }
-    auto realPermeabilityPoints = std::get<std::vector<PermeabilityPoint>>(realPart);
-    auto imaginaryPermeabilityPoints = std::get<std::vector<PermeabilityPoint>>(imaginaryPart);
-
-    if (realPermeabilityPoints.size() < 2) {
-        throw InvalidInputException(ErrorCode::MISSING_DATA, "Not enough complex permeability data for  " + coreMaterial.get_name());
-    }
 
-    if (!complexPermeabilityRealInterps.contains(coreMaterial.get_name()))
-    {
-        int n = realPermeabilityPoints.size();
-        std::vector<double> x, y;
-
-
-        std::sort(realPermeabilityPoints.begin(), realPermeabilityPoints.end(), [](const PermeabilityPoint& b1, const PermeabilityPoint& b2) {
-            return b1.get_frequency().value() < b2.get_frequency().value();
-        });
+        auto realPart = complexPermeabilityData.get_real();
+        auto imaginaryPart = complexPermeabilityData.get_imaginary();
 
+        if (!std::holds_alternative<std::vector<PermeabilityPoint>>(realPart) ||
+            !std::holds_alternative<std::vector<PermeabilityPoint>>(imaginaryPart)) {
+            throw InvalidInputException(ErrorCode::MISSING_DATA, "Complex permeability data is not in expected format for " + materialName);
+        }
+        auto& realPermeabilityPoints = std::get<std::vector<PermeabilityPoint>>(realPart);
+        auto& imaginaryPermeabilityPoints = std::get<std::vector<PermeabilityPoint>>(imaginaryPart);
 
-        for (int i = 0; i < n; i++) {
-            if (x.empty() || fabs(*realPermeabilityPoints[i].get_frequency() - x.back()) > 1e-9) {
-                x.push_back(*realPermeabilityPoints[i].get_frequency());
-                y.push_back(realPermeabilityPoints[i].get_value());
-            }
+        if (realPermeabilityPoints.size() < 2) {
+            throw InvalidInputException(ErrorCode::MISSING_DATA, "Not enough complex permeability data for  " + materialName);
         }
 
-        tk::spline interp(x, y, tk::spline::cspline_hermite);
-        complexPermeabilityRealInterps[coreMaterial.get_name()] = interp;
-        complexPermeabilityRealFrequencySpans[coreMaterial.get_name()] = {x.front(), x.back()};
+        if (!complexPermeabilityRealInterps.contains(materialName)) {
+            build_complex_permeability_interpolator(std::move(realPermeabilityPoints), materialName, complexPermeabilityRealInterps, complexPermeabilityRealFrequencySpans);
+        }
+        if (!complexPermeabilityImaginaryInterps.contains(materialName)) {
+            build_complex_permeability_interpolator(std::move(imaginaryPermeabilityPoints), materialName, complexPermeabilityImaginaryInterps, complexPermeabilityImaginaryFrequencySpans);
+        }
     }
-    auto realSpan = complexPermeabilityRealFrequencySpans[coreMaterial.get_name()];
-    double complexPermeabilityRealValue = std::max(1., complexPermeabilityRealInterps[coreMaterial.get_name()](std::clamp(frequency, realSpan.first, realSpan.second)));
 
+    return {&complexPermeabilityRealInterps.at(materialName),
+            &complexPermeabilityImaginaryInterps.at(materialName),
+            complexPermeabilityRealFrequencySpans.at(materialName),
+            complexPermeabilityImaginaryFrequencySpans.at(materialName)};
+}
+
+std::pair<double, double> ComplexPermeability::evaluate_interpolators(const ComplexPermeabilityInterpolators& interpolators, double frequency) {
+    const auto& realSpan = interpolators.realFrequencySpan;
+    double complexPermeabilityRealValue = std::max(1., (*interpolators.real)(std::clamp(frequency, realSpan.first, realSpan.second)));
     if (std::isnan(complexPermeabilityRealValue)) {
         throw NaNResultException("complex Permeability real part must be a number, not NaN");
     }
 
-    if (!complexPermeabilityImaginaryInterps.contains(coreMaterial.get_name()))
-    {
-        int n = imaginaryPermeabilityPoints.size();
-        std::vector<double> x, y;
-
-        std::sort(imaginaryPermeabilityPoints.begin(), imaginaryPermeabilityPoints.end(), [](const PermeabilityPoint& b1, const PermeabilityPoint& b2) {
-            return b1.get_frequency().value() < b2.get_frequency().value();
-        });
-
-
-        for (int i = 0; i < n; i++) {
-            if (x.empty() || fabs(*imaginaryPermeabilityPoints[i].get_frequency() - x.back()) > 1e-9) {
-                x.push_back(*imaginaryPermeabilityPoints[i].get_frequency());
-                y.push_back(imaginaryPermeabilityPoints[i].get_value());
-            }
-        }
-
-        tk::spline interp(x, y, tk::spline::cspline_hermite);
-        complexPermeabilityImaginaryInterps[coreMaterial.get_name()] = interp;
-        complexPermeabilityImaginaryFrequencySpans[coreMaterial.get_name()] = {x.front(), x.back()};
-    }
-    auto imaginarySpan = complexPermeabilityImaginaryFrequencySpans[coreMaterial.get_name()];
-    double complexPermeabilityImaginaryValue = complexPermeabilityImaginaryInterps[coreMaterial.get_name()](std::clamp(frequency, imaginarySpan.first, imaginarySpan.second));
-
+    const auto& imaginarySpan = interpolators.imaginaryFrequencySpan;
+    double complexPermeabilityImaginaryValue = (*interpolators.imaginary)(std::clamp(frequency, imaginarySpan.first, imaginarySpan.second));
     if (std::isnan(complexPermeabilityImaginaryValue)) {
         throw NaNResultException("complex Permeability imaginary part must be a number, not NaN");
     }
@@ -336,4 +317,18 @@ std::pair<double, double> ComplexPermeability::get_complex_permeability(CoreMate
     return {complexPermeabilityRealValue, complexPermeabilityImaginaryValue};
 }
 
+std::pair<double, double> ComplexPermeability::get_complex_permeability(const CoreMaterial& coreMaterial, double frequency) {
+    return evaluate_interpolators(resolve_interpolators(coreMaterial), frequency);
+}
+
+void ComplexPermeability::get_complex_permeability(const CoreMaterial& coreMaterial, std::span<const double> frequencies, std::span<double> realParts, std::span<double> imaginaryParts) {
+    if (realParts.size() != frequencies.size() || imaginaryParts.size() != frequencies.size()) {
+        throw InvalidInputException(ErrorCode::INVALID_INPUT, "Complex permeability outputs must have one element per frequency");
+    }
+    auto interpolators = resolve_interpolators(coreMaterial);
+    for (size_t index = 0; index < frequencies.size(); ++index) {
+        std::tie(realParts[index], imaginaryParts[index]) = evaluate_interpolators(interpolators, frequencies[index]);
+    }
+}
+
 } // namespace OpenMagnetics
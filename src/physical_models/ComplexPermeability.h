@@ -1,5 +1,6 @@
 #pragma once
 #include <MAS.hpp>
+#include <span>
 #include "spline.h"
 
 using namespace MAS;
@@ -17,8 +18,20 @@ inline thread_local std::map<std::string, tk::spline> complexPermeabilityImagina
 inline thread_local std::map<std::string, std::pair<double, double>> complexPermeabilityRealFrequencySpans;
 inline thread_local std::map<std::string, std::pair<double, double>> complexPermeabilityImaginaryFrequencySpans;
 
+// The two interpolators of one material, resolved from the caches above, and
+// the measured span each is clamped to. The pointers stay valid until the
+// caches are cleared (std::map never moves its nodes).
+struct ComplexPermeabilityInterpolators {
+    const tk::spline* real;
+    const tk::spline* imaginary;
+    std::pair<double, double> realFrequencySpan;
+    std::pair<double, double> imaginaryFrequencySpan;
+};
+
 class ComplexPermeability {
     private:
+        ComplexPermeabilityInterpolators resolve_interpolators(const CoreMaterial& coreMaterial);
+        static std::pair<double, double> evaluate_interpolators(const ComplexPermeabilityInterpolators& interpolators, double frequency);
         // Mueller et al., "Novel Complex Permeability Model of Powder Magnetic
         // Materials" (PCIM 2024), Fig 1 — maps ΔF_{L,95-90} (eq 13) to F_µ
         // (the base-material / pressed-core permeability ratio). Inverse
@@ -28,7 +41,12 @@ class ComplexPermeability {
     protected:
     public:
         std::pair<double, double> get_complex_permeability(std::string coreMaterialName, double frequency);
-        std::pair<double, double> get_complex_permeability(CoreMaterial coreMaterial, double frequency);
+        std::pair<double, double> get_complex_permeability(const CoreMaterial& coreMaterial, double frequency);
+        // Batched form for sweeps over one material (impedance curves, adviser
+        // rankings): the interpolators are resolved once, then every frequency
+        // is evaluated in one pass into the caller's arrays, which must have
+        // the same length as frequencies.
+        void get_complex_permeability(const CoreMaterial& coreMaterial, std::span<const double> frequencies, std::span<double> realParts, std::span<double> imaginaryParts);
         ComplexPermeabilityData calculate_complex_permeability_from_frequency_dependent_initial_permeability(CoreMaterial coreMaterial);
         ComplexPermeabilityData calculate_complex_permeability_from_frequency_dependent_initial_permeability(std::string coreMaterialName);
 };
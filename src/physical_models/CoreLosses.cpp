@@ -10,7 +10,10 @@
 #include "physical_models/MagneticField.h"
 #include "support/Exceptions.h"
 #include "support/Logger.h"
+#include "support/WorkCounters.h"
 
+#include <algorithm>
+#include <array>
 #include <cmath>
 #include <cfloat>
 #include <complex>
@@ -20,6 +23,8 @@
 #include <fstream>
 #include <iomanip>
 #include <iostream>
+#include <limits>
+#include <magic_enum.hpp>
 #include "spline.h"
 #include <numbers>
 #include <streambuf>
@@ -810,6 +815,7 @@ std::pair<std::vector<SteinmetzCoreLossesMethodRangeDatum>, std::vector<double>>
 CoreLossesOutput CoreLossesSteinmetzModel::get_core_losses(const Core& core,
                                                   OperatingPointExcitation excitation,
                                                   double temperature) {
+    count_work(WorkCounter::CORE_LOSSES_EVALUATION);
     auto magneticFluxDensity = excitation.get_magnetic_flux_density().value();
     double effectiveVolume = core.get_processed_description().value().get_effective_parameters().get_effective_volume();
     auto material = core.resolve_material();
@@ -918,7 +924,7 @@ double CoreLossesModel::get_core_losses_series_resistance(Core core,
     double effectiveArea = core.get_processed_description().value().get_effective_parameters().get_effective_area();
 
     double initialPermeability = InitialPermeability::get_initial_permeability(coreMaterial, temperature);
-    auto reluctanceModel = ReluctanceModel::factory();
+    ReluctanceModelHandle reluctanceModel;
     auto reluctance = reluctanceModel->get_core_reluctance(core, initialPermeability).get_core_reluctance();
 
     int64_t numberTurnsPrimary = sqrt(magnetizingInductance * reluctance);
@@ -975,6 +981,82 @@ double CoreLossesIGSEModel::get_ki(SteinmetzCoreLossesMethodRangeDatum steinmetz
     return ki;
 }
 
+namespace {
+
+// A sampled B waveform as runs of constant slope. Converter waveforms are
+// piecewise linear, so their thousands of samples collapse to a handful of
+// segments, and every |dB/dt|-based integral needs one term per segment
+// (Eq. 14 of the iGSE paper) instead of one per sample. Arbitrary waveforms
+// get one segment per sample pair and the same result as before.
+//
+// Samples are merged when their slopes agree to 1e-9, so the merged sum moves
+// by far less than that. The buffers are reused between calls of a thread.
+struct LinearSegments {
+    std::vector<double> absoluteSlopes;
+    std::vector<double> durations;
+    std::vector<size_t> numberSamples;
+};
+
+const LinearSegments& split_into_linear_segments(const std::vector<double>& data,
+                                                 const std::optional<std::vector<double>>& time,
+                                                 size_t numberPoints,
+                                                 double uniformTimeStep) {
+    static thread_local LinearSegments segments;
+    segments.absoluteSlopes.clear();
+    segments.durations.clear();
+    segments.numberSamples.clear();
+
+    constexpr double sameSlopeRelativeTolerance = 1e-9;
+    double runSlope = 0;
+    double runDelta = 0;
+    double runDuration = 0;
+    size_t runNumberSamples = 0;
+    auto close_run = [&]() {
+        segments.absoluteSlopes.push_back(fabs(runDelta / runDuration));
+        segments.durations.push_back(runDuration);
+        segments.numberSamples.push_back(runNumberSamples);
+    };
+
+    for (size_t i = 0; i + 1 < numberPoints; ++i) {
+        double timeDifference = time ? time.value()[i + 1] - time.value()[i] : uniformTimeStep;
+        double delta = data[i + 1] - data[i];
+        double slope = delta / timeDifference;
+        if (runNumberSamples > 0 &&
+            fabs(slope - runSlope) <= sameSlopeRelativeTolerance * std::max(fabs(slope), fabs(runSlope))) {
+            runDelta += delta;
+            runDuration += timeDifference;
+            runNumberSamples++;
+            continue;
+        }
+        if (runNumberSamples > 0) {
+            close_run();
+        }
+        runSlope = slope;
+        runDelta = delta;
+        runDuration = timeDifference;
+        runNumberSamples = 1;
+    }
+    if (runNumberSamples > 0) {
+        close_run();
+    }
+    return segments;
+}
+
+// Sum of |dB/dt|^alpha * dt over the segments. A plain loop over contiguous
+// arrays, which the compiler can vectorize where the math library allows.
+double integrate_absolute_slope_power(const LinearSegments& segments, double alpha) {
+    const double* absoluteSlopes = segments.absoluteSlopes.data();
+    const double* durations = segments.durations.data();
+    size_t numberSegments = segments.durations.size();
+    double integral = 0;
+    for (size_t i = 0; i < numberSegments; ++i) {
+        integral += pow(absoluteSlopes[i], alpha) * durations[i];
+    }
+    return integral;
+}
+
+} // namespace
+
 /**
  * @brief Calculates core volumetric losses using the improved Generalized Steinmetz Equation (iGSE).
  * 
@@ -1018,12 +1100,10 @@ double CoreLossesIGSEModel::get_core_volumetric_losses(CoreMaterial coreMaterial
     double frequency = Inputs::get_switching_frequency(excitation);
     double magneticFluxDensityAcPeakToPeak = Inputs::get_magnetic_flux_density_peak_to_peak(excitation, frequency);
 
-    magneticFluxDensity = Inputs::standardize_waveform(magneticFluxDensity, excitation.get_frequency());
-    auto magneticFluxDensityWaveform = magneticFluxDensity.get_waveform().value().get_data();
-    std::vector<double> magneticFluxDensityTime;
-    if (magneticFluxDensity.get_waveform().value().get_time()) {
-        magneticFluxDensityTime = magneticFluxDensity.get_waveform().value().get_time().value();
-    }
+    // One copy of the standardized waveform; data and time are read through it.
+    auto magneticFluxDensityWaveform = Inputs::standardize_waveform(magneticFluxDensity, excitation.get_frequency()).get_waveform().value();
+    const auto& magneticFluxDensityData = magneticFluxDensityWaveform.get_data();
+    auto magneticFluxDensityTime = magneticFluxDensityWaveform.get_time();
 
     SteinmetzCoreLossesMethodRangeDatum steinmetzDatum;
     if (is_steinmetz_datum_loaded()) {
@@ -1037,9 +1117,7 @@ double CoreLossesIGSEModel::get_core_volumetric_losses(CoreMaterial coreMaterial
     double beta = steinmetzDatum.get_beta();
     double ki = get_ki(steinmetzDatum);
 
-    double volumetricLossesSum = 0;
-    double timeDifference;
-    size_t numberPoints = magneticFluxDensityWaveform.size();
+    size_t numberPoints = magneticFluxDensityData.size();
 
     if (frequency / excitation.get_frequency() > 1) {
         // Clamp: a large frequency ratio (e.g. HF switching harmonic on a line-frequency
@@ -1051,8 +1129,8 @@ double CoreLossesIGSEModel::get_core_volumetric_losses(CoreMaterial coreMaterial
     // When the waveform has explicit time data, check if it spans more than one
     // switching period (e.g. a SPICE waveform covering many cycles). If so, limit
     // the integration to one switching period worth of points.
-    if (!magneticFluxDensityTime.empty() && numberPoints > 1) {
-        double waveformDuration = magneticFluxDensityTime[numberPoints - 1] - magneticFluxDensityTime[0];
+    if (magneticFluxDensityTime && numberPoints > 1) {
+        double waveformDuration = magneticFluxDensityTime.value()[numberPoints - 1] - magneticFluxDensityTime.value()[0];
         double switchingPeriod = 1.0 / frequency;
         if (waveformDuration > 1.5 * switchingPeriod) {
             double numCycles = waveformDuration * frequency;
@@ -1060,17 +1138,9 @@ double CoreLossesIGSEModel::get_core_volumetric_losses(CoreMaterial coreMaterial
         }
     }
 
-    for (size_t i = 0; i < numberPoints - 1; ++i) {
-        if (magneticFluxDensity.get_waveform().value().get_time()) {
-            timeDifference = magneticFluxDensityTime[i + 1] - magneticFluxDensityTime[i];
-        }
-        else {
-            timeDifference = 1 / frequency / settings.get_inputs_number_points_sampled_waveforms();
-        }
-        volumetricLossesSum +=
-            pow(fabs((magneticFluxDensityWaveform[i + 1] - magneticFluxDensityWaveform[i]) / timeDifference), alpha) *
-            timeDifference;
-    }
+    auto& segments = split_into_linear_segments(magneticFluxDensityData, magneticFluxDensityTime, numberPoints,
+                                                1 / frequency / settings.get_inputs_number_points_sampled_waveforms());
+    double volumetricLossesSum = integrate_absolute_slope_power(segments, alpha);
 
     // double volumetricLosses = ki * pow(mainHarmonicMagneticFluxDensityPeakToPeak, beta - alpha) * frequency * volumetricLossesSum;
     double volumetricLosses = ki * pow(magneticFluxDensityAcPeakToPeak, beta - alpha) * frequency * volumetricLossesSum;
@@ -1292,16 +1362,12 @@ double CoreLossesciGSEModel::get_core_volumetric_losses(CoreMaterial coreMateria
     double frequency = Inputs::get_switching_frequency(excitation);
     double magneticFluxDensityAcPeakToPeak = Inputs::get_magnetic_flux_density_peak_to_peak(excitation, frequency);
     
-    magneticFluxDensity = Inputs::standardize_waveform(magneticFluxDensity, frequency);
-    auto magneticFluxDensityWaveform = magneticFluxDensity.get_waveform().value().get_data();
-    
-    std::vector<double> magneticFluxDensityTime;
-    if (magneticFluxDensity.get_waveform().value().get_time()) {
-        magneticFluxDensityTime = magneticFluxDensity.get_waveform().value().get_time().value();
-    }
+    auto magneticFluxDensityWaveform = Inputs::standardize_waveform(magneticFluxDensity, frequency).get_waveform().value();
+    const auto& magneticFluxDensityData = magneticFluxDensityWaveform.get_data();
+    auto magneticFluxDensityTime = magneticFluxDensityWaveform.get_time();
     
     double period = 1.0 / frequency;
-    size_t numberPoints = magneticFluxDensityWaveform.size();
+    size_t numberPoints = magneticFluxDensityData.size();
     
     if (frequency / excitation.get_frequency() > 1) {
         // Clamp: a large frequency ratio (e.g. HF switching harmonic on a line-frequency
@@ -1314,26 +1380,18 @@ double CoreLossesciGSEModel::get_core_volumetric_losses(CoreMaterial coreMateria
     // Calculate losses for each segment of the waveform separately,
     // then sum them weighted by their duty cycle (time fraction)
     double totalVolumetricLosses = 0.0;
+    auto& segments = split_into_linear_segments(magneticFluxDensityData, magneticFluxDensityTime, numberPoints,
+                                                period / settings.get_inputs_number_points_sampled_waveforms());
     
-    for (size_t i = 0; i < numberPoints - 1; ++i) {
-        double timeDifference;
-        if (magneticFluxDensity.get_waveform().value().get_time()) {
-            timeDifference = magneticFluxDensityTime[i + 1] - magneticFluxDensityTime[i];
-        }
-        else {
-            timeDifference = period / settings.get_inputs_number_points_sampled_waveforms();
-        }
-        
-        // Calculate |dB/dt| for this segment
-        double deltaB_segment = fabs(magneticFluxDensityWaveform[i + 1] - magneticFluxDensityWaveform[i]);
+    for (size_t i = 0; i < segments.durations.size(); ++i) {
+        double dBdt = segments.absoluteSlopes[i];
+        double timeDifference = segments.durations[i];
         
-        // Skip segments with negligible change
-        if (deltaB_segment < 1e-12) {
+        // Skip segments with negligible change per sample
+        if (dBdt * timeDifference < 1e-12 * segments.numberSamples[i]) {
             continue;
         }
         
-        double dBdt = deltaB_segment / timeDifference;
-        
         // The duty cycle for this segment
         double dutyCycle = timeDifference / period;
         
@@ -1840,6 +1898,7 @@ double CoreLossesBargModel::get_core_volumetric_losses(CoreMaterial coreMaterial
 CoreLossesOutput CoreLossesRoshenModel::get_core_losses(const Core& core,
                                                         OperatingPointExcitation excitation,
                                                         double temperature) {
+    count_work(WorkCounter::CORE_LOSSES_EVALUATION);
     auto magneticFluxDensity = excitation.get_magnetic_flux_density().value();
     double effectiveVolume = core.get_processed_description().value().get_effective_parameters().get_effective_volume();
     auto parameters = get_roshen_parameters(core, excitation, temperature);
@@ -1936,7 +1995,7 @@ std::map<std::string, double> CoreLossesRoshenModel::get_roshen_parameters(Core
         roshenParameters["resistivity"] = resistivity;
     }
     else {
-        auto resistivityModel = ResistivityModel::factory(ResistivityModels::CORE_MATERIAL);
+        auto& resistivityModel = ResistivityModel::get_shared(ResistivityModels::CORE_MATERIAL);
         auto resistivity = (*resistivityModel).get_resistivity(materialData, temperature);
         roshenParameters["resistivity"] = resistivity;
     }
@@ -2621,7 +2680,7 @@ double CoreLossesLossFactorModel::calculate_magnetizing_inductance_from_excitati
     double effectiveArea = core.get_processed_description().value().get_effective_parameters().get_effective_area();
 
     double initialPermeability = InitialPermeability::get_initial_permeability(coreMaterial, temperature);
-    auto reluctanceModel = ReluctanceModel::factory();
+    ReluctanceModelHandle reluctanceModel;
     auto reluctance = reluctanceModel->get_core_reluctance(core, initialPermeability).get_core_reluctance();
     int64_t numberTurns = round(ceilFloat(magneticFluxDensityPeak / currentPeak * reluctance * effectiveArea, 0));
 
@@ -2632,6 +2691,7 @@ double CoreLossesLossFactorModel::calculate_magnetizing_inductance_from_excitati
 CoreLossesOutput CoreLossesLossFactorModel::get_core_losses(const Core& core,
                                                         OperatingPointExcitation excitation,
                                                         double temperature) {
+    count_work(WorkCounter::CORE_LOSSES_EVALUATION);
     if (!excitation.get_magnetizing_current()) {
         throw InvalidInputException("Missing magnetizing current in excitation");
     }
@@ -2898,4 +2958,310 @@ SignalDescriptor CoreLossesModel::_get_magnetic_flux_density_from_core_losses(Co
 // unresolved physics issues (double temperature correction, linear-in-B minor-loop
 // scaling). Removed in the July 2026 health pass; recover from git history if needed.
 
+namespace {
+
+// Tabulation grid of CoreLossesTabulatedModel: nodes at regular steps of each
+// axis. Frequency and flux density are tabulated in log10, where the Steinmetz
+// family is (piecewise) linear.
+struct TabulationAxis {
+    double origin;
+    double step;
+    size_t numberNodes;
+};
+
+constexpr std::array<TabulationAxis, 4> tabulationAxes{{
+    {0.0, 1.0 / 16, 129},   // log10 f: 1 Hz to 100 MHz
+    {-5.0, 1.0 / 16, 97},   // log10 AC peak B: 10 uT to 10 T
+    {-60.0, 10.0, 33},      // temperature: -60 to 260 C
+    {0.05, 0.05, 19},       // duty cycle: 0.05 to 0.95
+}};
+
+struct TabulationQuery {
+    std::string surfaceKey;
+    std::vector<double> coordinates;
+    WaveformLabel label;
+    double offset;
+    double peakShift;
+};
+
+// The excitation as a point of a surface, or nullopt when the exact model could
+// depend on something the surface does not capture.
+std::optional<TabulationQuery> get_tabulation_query(const std::string& materialName, const OperatingPointExcitation& excitation, double temperature) {
+    if (excitation.get_current() || excitation.get_voltage() || excitation.get_magnetizing_current() ||
+        excitation.get_magnetic_field_strength() || !excitation.get_magnetic_flux_density()) {
+        return std::nullopt;
+    }
+    auto& magneticFluxDensity = excitation.get_magnetic_flux_density().value();
+    if (magneticFluxDensity.get_waveform() || magneticFluxDensity.get_harmonics() || !magneticFluxDensity.get_processed()) {
+        return std::nullopt;
+    }
+    auto processed = magneticFluxDensity.get_processed().value();
+    if (!processed.get_peak() || !processed.get_peak_to_peak() || processed.get_peak_to_peak().value() <= 0) {
+        return std::nullopt;
+    }
+    std::optional<double> dutyCycle = processed.get_duty_cycle();
+    WaveformLabel label = processed.get_label();
+    double offset = processed.get_offset();
+    double acPeak = processed.get_peak_to_peak().value() / 2;
+    double peakShift = processed.get_peak().value() - offset - acPeak;
+
+    // Nothing but the fields above may be set: the exact model would read them.
+    processed.set_label(WaveformLabel::CUSTOM);
+    processed.set_offset(0);
+    processed.set_peak(std::nullopt);
+    processed.set_peak_to_peak(std::nullopt);
+    processed.set_duty_cycle(std::nullopt);
+    json remainder;
+    to_json(remainder, processed);
+    for (auto& [field, value] : remainder.items()) {
+        if (!value.is_null() && field != "label" && field != "offset") {
+            return std::nullopt;
+        }
+    }
+
+    TabulationQuery query;
+    query.label = label;
+    query.offset = offset;
+    query.peakShift = peakShift;
+    query.coordinates = {std::log10(excitation.get_frequency()), std::log10(acPeak), temperature};
+    if (dutyCycle) {
+        query.coordinates.push_back(dutyCycle.value());
+    }
+    char numbers[64];
+    std::snprintf(numbers, sizeof(numbers), "%a|%a|%d", offset, peakShift, dutyCycle ? 1 : 0);
+    query.surfaceKey = materialName + "|" + std::string(magic_enum::enum_name(label)) + "|" + numbers;
+    return query;
+}
+
+OperatingPointExcitation get_tabulation_node_excitation(const TabulationQuery& query, const std::vector<double>& coordinates) {
+    double acPeak = std::pow(10, coordinates[1]);
+    ProcessedWaveform processed;
+    processed.set_label(query.label);
+    processed.set_offset(query.offset);
+    processed.set_peak(query.offset + acPeak + query.peakShift);
+    processed.set_peak_to_peak(2 * acPeak);
+    if (coordinates.size() > 3) {
+        processed.set_duty_cycle(coordinates[3]);
+    }
+    SignalDescriptor magneticFluxDensity;
+    magneticFluxDensity.set_processed(processed);
+    OperatingPointExcitation excitation;
+    excitation.set_magnetic_flux_density(magneticFluxDensity);
+    excitation.set_frequency(std::pow(10, coordinates[0]));
+    return excitation;
+}
+
+uint64_t pack_tabulation_indexes(const std::vector<size_t>& indexes) {
+    uint64_t key = 0;
+    for (size_t axisIndex = 0; axisIndex < indexes.size(); ++axisIndex) {
+        key |= static_cast<uint64_t>(indexes[axisIndex]) << (8 * axisIndex);
+    }
+    return key;
+}
+
+double interpolate_multilinear(const std::vector<double>& cornerValues, const std::vector<double>& fractions) {
+    double value = 0;
+    for (size_t corner = 0; corner < cornerValues.size(); ++corner) {
+        double weight = 1;
+        for (size_t axisIndex = 0; axisIndex < fractions.size(); ++axisIndex) {
+            weight *= (corner >> axisIndex) & 1 ? fractions[axisIndex] : 1 - fractions[axisIndex];
+        }
+        value += weight * cornerValues[corner];
+    }
+    return value;
+}
+
+} // namespace
+
+CoreLossesTabulatedModel::CoreLossesTabulatedModel(std::shared_ptr<CoreLossesModel> exactModel) {
+    if (!exactModel) {
+        throw InvalidInputException(ErrorCode::INVALID_INPUT, "Tabulated core losses need an exact model");
+    }
+    _exactModel = exactModel;
+    _modelName = exactModel->get_model_name();
+    _databasesGeneration = get_databases_generation();
+}
+
+std::shared_ptr<CoreLossesModel> CoreLossesTabulatedModel::wrap_if_enabled(std::shared_ptr<CoreLossesModel> model) {
+    if (!settings.get_core_losses_tabulated() || !model || std::dynamic_pointer_cast<CoreLossesTabulatedModel>(model)) {
+        return model;
+    }
+    return std::make_shared<CoreLossesTabulatedModel>(model);
+}
+
+std::shared_ptr<CoreLossesModel> CoreLossesTabulatedModel::get_shared(CoreLossesModels modelName) {
+    if (!settings.get_core_losses_tabulated()) {
+        return factory(modelName);
+    }
+    struct SharedModels {
+        std::string settingsFingerprint;
+        uint64_t databasesGeneration = 0;
+        std::map<CoreLossesModels, std::shared_ptr<CoreLossesModel>> models;
+    };
+    thread_local SharedModels sharedModels;
+    auto settingsFingerprint = Settings::GetInstance().get_fingerprint();
+    auto databasesGeneration = get_databases_generation();
+    if (settingsFingerprint != sharedModels.settingsFingerprint || databasesGeneration != sharedModels.databasesGeneration) {
+        sharedModels.models.clear();
+        sharedModels.settingsFingerprint = settingsFingerprint;
+        sharedModels.databasesGeneration = databasesGeneration;
+    }
+    auto& model = sharedModels.models[modelName];
+    if (!model) {
+        model = std::make_shared<CoreLossesTabulatedModel>(factory(modelName));
+    }
+    return model;
+}
+
+void CoreLossesTabulatedModel::clear() {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _surfaces.clear();
+}
+
+double CoreLossesTabulatedModel::evaluate_exact(CoreMaterial& coreMaterial, OperatingPointExcitation& excitation, double temperature) {
+    _numberExactEvaluations++;
+    return _exactModel->get_core_volumetric_losses(coreMaterial, excitation, temperature);
+}
+
+double CoreLossesTabulatedModel::get_core_volumetric_losses(CoreMaterial coreMaterial,
+                                                            OperatingPointExcitation excitation,
+                                                            double temperature) {
+    auto query = get_tabulation_query(coreMaterial.get_name(), excitation, temperature);
+    if (!query) {
+        return evaluate_exact(coreMaterial, excitation, temperature);
+    }
+
+    size_t numberAxes = query->coordinates.size();
+    std::vector<size_t> cellIndexes(numberAxes);
+    std::vector<double> fractions(numberAxes);
+    for (size_t axisIndex = 0; axisIndex < numberAxes; ++axisIndex) {
+        auto& axis = tabulationAxes[axisIndex];
+        double position = (query->coordinates[axisIndex] - axis.origin) / axis.step;
+        if (!std::isfinite(position) || position < 0 || position > static_cast<double>(axis.numberNodes - 1)) {
+            return evaluate_exact(coreMaterial, excitation, temperature);
+        }
+        cellIndexes[axisIndex] = std::min(static_cast<size_t>(position), axis.numberNodes - 2);
+        fractions[axisIndex] = position - static_cast<double>(cellIndexes[axisIndex]);
+    }
+
+    size_t numberCorners = size_t{1} << numberAxes;
+    std::vector<uint64_t> cornerKeys(numberCorners);
+    std::vector<double> cornerValues(numberCorners, std::numeric_limits<double>::quiet_NaN());
+    std::vector<bool> cornerKnown(numberCorners, false);
+    for (size_t corner = 0; corner < numberCorners; ++corner) {
+        std::vector<size_t> nodeIndexes(cellIndexes);
+        for (size_t axisIndex = 0; axisIndex < numberAxes; ++axisIndex) {
+            nodeIndexes[axisIndex] += (corner >> axisIndex) & 1;
+        }
+        cornerKeys[corner] = pack_tabulation_indexes(nodeIndexes);
+    }
+    uint64_t cellKey = pack_tabulation_indexes(cellIndexes);
+
+    std::optional<bool> cellSmooth;
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        auto databasesGeneration = get_databases_generation();
+        if (databasesGeneration != _databasesGeneration) {
+            _surfaces.clear();
+            _databasesGeneration = databasesGeneration;
+        }
+        auto& surface = _surfaces[query->surfaceKey];
+        auto smooth = surface.smoothPerCell.find(cellKey);
+        if (smooth != surface.smoothPerCell.end()) {
+            cellSmooth = smooth->second;
+        }
+        for (size_t corner = 0; corner < numberCorners; ++corner) {
+            auto node = surface.logLossesPerNode.find(cornerKeys[corner]);
+            if (node != surface.logLossesPerNode.end()) {
+                cornerValues[corner] = node->second;
+                cornerKnown[corner] = true;
+            }
+        }
+    }
+    if (cellSmooth && !cellSmooth.value()) {
+        return evaluate_exact(coreMaterial, excitation, temperature);
+    }
+
+    // First use of this cell: evaluate the missing nodes and check the centre,
+    // outside the lock (these are the expensive calls).
+    auto evaluate_at = [&](const std::vector<double>& coordinates) {
+        auto nodeExcitation = get_tabulation_node_excitation(query.value(), coordinates);
+        try {
+            double volumetricLosses = evaluate_exact(coreMaterial, nodeExcitation, coordinates[2]);
+            if (std::isfinite(volumetricLosses) && volumetricLosses > 0) {
+                return volumetricLosses;
+            }
+        }
+        catch (const std::exception&) {
+        }
+        return std::numeric_limits<double>::quiet_NaN();
+    };
+    for (size_t corner = 0; corner < numberCorners; ++corner) {
+        if (cornerKnown[corner]) {
+            continue;
+        }
+        std::vector<double> coordinates(numberAxes);
+        for (size_t axisIndex = 0; axisIndex < numberAxes; ++axisIndex) {
+            auto& axis = tabulationAxes[axisIndex];
+            coordinates[axisIndex] = axis.origin + axis.step * static_cast<double>(cellIndexes[axisIndex] + ((corner >> axisIndex) & 1));
+        }
+        cornerValues[corner] = std::log10(evaluate_at(coordinates));
+    }
+    if (!cellSmooth) {
+        bool smooth = std::all_of(cornerValues.begin(), cornerValues.end(), [](double value) { return std::isfinite(value); });
+        if (smooth) {
+            std::vector<double> centre(numberAxes);
+            for (size_t axisIndex = 0; axisIndex < numberAxes; ++axisIndex) {
+                auto& axis = tabulationAxes[axisIndex];
+                centre[axisIndex] = axis.origin + axis.step * (static_cast<double>(cellIndexes[axisIndex]) + 0.5);
+            }
+            double exactAtCentre = evaluate_at(centre);
+            double tabulatedAtCentre = std::pow(10, interpolate_multilinear(cornerValues, std::vector<double>(numberAxes, 0.5)));
+            smooth = std::isfinite(exactAtCentre) &&
+                     std::abs(tabulatedAtCentre - exactAtCentre) <= settings.get_core_losses_tabulated_tolerance() * exactAtCentre;
+        }
+        cellSmooth = smooth;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        auto& surface = _surfaces[query->surfaceKey];
+        for (size_t corner = 0; corner < numberCorners; ++corner) {
+            surface.logLossesPerNode.emplace(cornerKeys[corner], cornerValues[corner]);
+        }
+        surface.smoothPerCell.emplace(cellKey, cellSmooth.value());
+    }
+    if (!cellSmooth.value()) {
+        return evaluate_exact(coreMaterial, excitation, temperature);
+    }
+    _numberInterpolatedQueries++;
+    return std::pow(10, interpolate_multilinear(cornerValues, fractions));
+}
+
+CoreLossesOutput CoreLossesTabulatedModel::get_core_losses(const Core& core,
+                                                           OperatingPointExcitation excitation,
+                                                           double temperature) {
+    return _exactModel->get_core_losses(core, excitation, temperature);
+}
+
+double CoreLossesTabulatedModel::get_core_mass_losses(CoreMaterial coreMaterial,
+                                                      OperatingPointExcitation excitation,
+                                                      double temperature) {
+    return _exactModel->get_core_mass_losses(coreMaterial, excitation, temperature);
+}
+
+double CoreLossesTabulatedModel::get_frequency_from_core_losses(Core core,
+                                                                SignalDescriptor magneticFluxDensity,
+                                                                double temperature,
+                                                                double coreLosses) {
+    return _exactModel->get_frequency_from_core_losses(core, magneticFluxDensity, temperature, coreLosses);
+}
+
+SignalDescriptor CoreLossesTabulatedModel::get_magnetic_flux_density_from_core_losses(Core core,
+                                                                                      double frequency,
+                                                                                      double temperature,
+                                                                                      double coreLosses) {
+    return _exactModel->get_magnetic_flux_density_from_core_losses(core, frequency, temperature, coreLosses);
+}
+
 } // namespace OpenMagnetics
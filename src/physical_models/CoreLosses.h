@@ -13,7 +13,11 @@
 #include <map>
 #include <numbers>
 #include <streambuf>
+#include <atomic>
 #include <functional>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
 #include <vector>
 #include "support/Exceptions.h"
 
@@ -564,6 +568,82 @@ class CoreLossesLossFactorModel : public CoreLossesModel {
 
 };
 
+// Opt-in tabulated front of another model (Settings::get_core_losses_tabulated()),
+// for loops that price the same few materials over and over at nearby points,
+// like the core adviser's material ranking.
+//
+// Only excitations described by their summary alone are tabulated: a magnetic
+// flux density with processed data (label, offset, peak, peak to peak, optional
+// duty cycle) and no waveform or harmonics, and no current, voltage or field.
+// Anything else, and any point off the grid, goes to the exact model; so do
+// get_core_losses() and the inverse queries.
+//
+// SURFACE: one per (material, label, offset, peak shift, duty present), holding
+// log10 of the volumetric losses over a fixed grid in log10 f, log10 of the AC
+// peak flux density, temperature and (when present) duty cycle. Nodes are exact
+// evaluations made on first use. A query interpolates multilinearly in its
+// cell, so the surface is continuous and keeps the monotonicity of the node
+// data along every axis. Each cell is checked once against the exact model at
+// its centre; a cell that misses by more than
+// Settings::get_core_losses_tabulated_tolerance() (a Steinmetz frequency-range
+// boundary, a Roshen knee) is answered exactly from then on.
+//
+// Surfaces live in the instance, are guarded by a mutex and are dropped when
+// the database generation changes. get_shared() keeps one instance per model
+// and thread alive across calls, so a surface is built once per (model,
+// material) rather than once per caller; the store is rebuilt when the settings
+// fingerprint or the database generation changes.
+class CoreLossesTabulatedModel : public CoreLossesModel {
+  public:
+    explicit CoreLossesTabulatedModel(std::shared_ptr<CoreLossesModel> exactModel);
+
+    CoreLossesOutput get_core_losses(const Core& core,
+                                     OperatingPointExcitation excitation,
+                                     double temperature) override;
+    double get_core_volumetric_losses(CoreMaterial coreMaterial,
+                                      OperatingPointExcitation excitation,
+                                      double temperature) override;
+    double get_core_mass_losses(CoreMaterial coreMaterial,
+                                OperatingPointExcitation excitation,
+                                double temperature) override;
+    double get_frequency_from_core_losses(Core core,
+                                          SignalDescriptor magneticFluxDensity,
+                                          double temperature,
+                                          double coreLosses) override;
+    SignalDescriptor get_magnetic_flux_density_from_core_losses(Core core,
+                                                                double frequency,
+                                                                double temperature,
+                                                                double coreLosses) override;
+
+    std::shared_ptr<CoreLossesModel> get_exact_model() const { return _exactModel; }
+    // Calls made to the exact model (nodes, cell checks and fallbacks) so far.
+    size_t get_number_exact_evaluations() const { return _numberExactEvaluations; }
+    // Queries answered by interpolation so far.
+    size_t get_number_interpolated_queries() const { return _numberInterpolatedQueries; }
+    void clear();
+
+    // Wraps `model` when Settings::get_core_losses_tabulated() is set.
+    static std::shared_ptr<CoreLossesModel> wrap_if_enabled(std::shared_ptr<CoreLossesModel> model);
+    // The persistent tabulated instance of `modelName` for this thread when
+    // Settings::get_core_losses_tabulated() is set, a fresh exact model otherwise.
+    static std::shared_ptr<CoreLossesModel> get_shared(CoreLossesModels modelName);
+
+  private:
+    struct Surface {
+        std::unordered_map<uint64_t, double> logLossesPerNode;
+        std::unordered_map<uint64_t, bool> smoothPerCell;
+    };
+
+    std::shared_ptr<CoreLossesModel> _exactModel;
+    std::mutex _mutex;
+    uint64_t _databasesGeneration = 0;
+    std::map<std::string, Surface> _surfaces;
+    std::atomic<size_t> _numberExactEvaluations{0};
+    std::atomic<size_t> _numberInterpolatedQueries{0};
+
+    double evaluate_exact(CoreMaterial& coreMaterial, OperatingPointExcitation& excitation, double temperature);
+};
+
 class CoreLosses {
     private:
         std::vector<std::pair<CoreLossesModels, std::shared_ptr<CoreLossesModel>>> _coreLossesModels;
@@ -262,6 +262,29 @@ std::complex<double> Impedance::core_dimensional_attenuation(const CoreMaterial&
 }
 
 std::complex<double> Impedance::impedance_from_model(const WidebandImpedanceModel& model, double frequency) {
+    std::pair<double, double> complexPermeability{1.0, 0.0};
+    if (model.coreMaterial) {
+        complexPermeability = OpenMagnetics::ComplexPermeability().get_complex_permeability(model.coreMaterial.value(), frequency);
+    }
+    return impedance_from_model(model, frequency, complexPermeability);
+}
+
+std::vector<std::complex<double>> Impedance::impedance_from_model(const WidebandImpedanceModel& model, std::span<const double> frequencies) {
+    // µ(f) for the whole sweep in one batched pass: the material's interpolators
+    // are resolved once instead of once per point.
+    std::vector<double> complexPermeabilityRealParts(frequencies.size(), 1.0);
+    std::vector<double> complexPermeabilityImaginaryParts(frequencies.size(), 0.0);
+    if (model.coreMaterial) {
+        OpenMagnetics::ComplexPermeability().get_complex_permeability(model.coreMaterial.value(), frequencies, complexPermeabilityRealParts, complexPermeabilityImaginaryParts);
+    }
+    std::vector<std::complex<double>> impedances(frequencies.size());
+    for (size_t index = 0; index < frequencies.size(); ++index) {
+        impedances[index] = impedance_from_model(model, frequencies[index], {complexPermeabilityRealParts[index], complexPermeabilityImaginaryParts[index]});
+    }
+    return impedances;
+}
+
+std::complex<double> Impedance::impedance_from_model(const WidebandImpedanceModel& model, double frequency, std::pair<double, double> complexPermeability) {
     auto angularFrequency = 2 * std::numbers::pi * frequency;
 
     // Core complex permeability for the magnetizing tank, evaluated once.
@@ -270,7 +293,7 @@ std::complex<double> Impedance::impedance_from_model(const WidebandImpedanceMode
     double complexPermeabilityRealPart = 1.0;
     double complexPermeabilityImaginaryPart = 0.0;
     if (model.coreMaterial) {
-        auto [muReal, muImag] = OpenMagnetics::ComplexPermeability().get_complex_permeability(model.coreMaterial.value(), frequency);
+        auto [muReal, muImag] = complexPermeability;
         // ABT #848: dimensional / eddy-dielectric attenuation across the core cross-section.
         // Complex multiply in e^{jwt}: (mu' - j mu'') * factor, then read back mu', mu''.
         auto factor = core_dimensional_attenuation(model.coreMaterial.value(), frequency, std::complex<double>(muReal, muImag), model.coreCrossSectionDimensions);
@@ -9,6 +9,8 @@
 #include <MAS.hpp>
 #include <complex>
 #include <optional>
+#include <span>
+#include <utility>
 #include <vector>
 
 using namespace MAS;
@@ -81,6 +83,9 @@ class Impedance {
         // The magnetizing tank (air-cored inductance ∥ winding self-capacitance),
         // the first resonance shared by calculate_impedance and the wideband model.
         ImpedanceTank build_magnetizing_tank(Core& core, Coil& coil);
+        // impedance_from_model() with µ(f) already evaluated (ignored when the
+        // model has no core material).
+        std::complex<double> impedance_from_model(const WidebandImpedanceModel& model, double frequency, std::pair<double, double> complexPermeability);
     protected:
     public:
     // DEFAULT: the FULL energy-based StrayCapacitance model (owner decision, 2026-08-23): per-pair
@@ -137,6 +142,8 @@ class Impedance {
     // leakage spike that measured CM curves do not show (ABT #167).
     WidebandImpedanceModel build_common_mode_impedance_model(Magnetic magnetic, double temperature = Defaults().ambientTemperature);
     std::complex<double> impedance_from_model(const WidebandImpedanceModel& model, double frequency);
+    // The same over a whole sweep, with µ(f) evaluated in one batched pass.
+    std::vector<std::complex<double>> impedance_from_model(const WidebandImpedanceModel& model, std::span<const double> frequencies);
     double calculate_q_factor(Magnetic magnetic, double frequency, double temperature = Defaults().ambientTemperature);
     double calculate_q_factor(Core core, Coil coil, double frequency, double temperature = Defaults().ambientTemperature);
     double calculate_self_resonant_frequency(Magnetic magnetic, double temperature = Defaults().ambientTemperature);
@@ -74,9 +74,6 @@ std::pair<ComplexField, double> LeakageInductance::calculate_magnetic_field(Oper
         }
     double dA = meshResult.second;
 
-    // Use dedicated leakage inductance H-field model (default: BINNS_LAWRENSON, which works best for air-only calculations)
-    MagneticField magneticField(settings.get_leakage_inductance_magnetic_field_strength_model(), settings.get_magnetic_field_strength_fringing_effect_model());
-
     std::vector<int8_t> currentDirectionPerWinding;
     for (size_t windingIndex = 0; windingIndex < magnetic.get_coil().get_functional_description().size(); ++windingIndex) {
         if (windingIndex == sourceIndex) {
@@ -90,6 +87,15 @@ std::pair<ComplexField, double> LeakageInductance::calculate_magnetic_field(Oper
         }
     }
 
+    ComplexField field = calculate_field_on_mesh(operatingPoint, magnetic, inducedField, customCurrentDirectionPerWinding);
+
+    return {field, dA};
+}
+
+ComplexField LeakageInductance::calculate_field_on_mesh(OperatingPoint& operatingPoint, Magnetic magnetic, Field& inducedField, std::optional<std::vector<int8_t>> customCurrentDirectionPerWinding) {
+    // Use dedicated leakage inductance H-field model (default: BINNS_LAWRENSON, which works best for air-only calculations)
+    MagneticField magneticField(settings.get_leakage_inductance_magnetic_field_strength_model(), settings.get_magnetic_field_strength_fringing_effect_model());
+
     ComplexField field;
     {
         CoilMesherModels modelToUse = select_mesh_model(magnetic);
@@ -124,7 +130,7 @@ std::pair<ComplexField, double> LeakageInductance::calculate_magnetic_field(Oper
         }
     }
 
-    return {field, dA};
+    return field;
 }
 
 LeakageInductanceOutput LeakageInductance::calculate_leakage_inductance(Magnetic magnetic, double frequency, size_t sourceIndex, size_t destinationIndex, size_t harmonicIndex) {
@@ -254,7 +260,7 @@ LeakageInductanceOutput LeakageInductance::calculate_leakage_inductance_all_wind
     return leakageInductanceOutput;
 }
 
-double LeakageInductance::integrate_leakage_energy(Magnetic& magnetic, ComplexField& field, double dA) {
+std::vector<double> LeakageInductance::calculate_integration_lengths(Magnetic& magnetic, ComplexField& field) {
     auto bobbin = magnetic.get_mutable_coil().resolve_bobbin();
     double bobbinColumnWidth = bobbin.get_processed_description()->get_column_width().value();
     double bobbinColumnDepth = bobbin.get_processed_description()->get_column_depth();
@@ -267,10 +273,9 @@ double LeakageInductance::integrate_leakage_energy(Magnetic& magnetic, ComplexFi
         windingWindowRadialHeight = windingWindows[0].get_radial_height().value();
     }
 
-    double vacuumPermeability = Constants().vacuumPermeability;
-
-    double energy = 0;
-    for (auto datum : field.get_data()){
+    std::vector<double> lengths;
+    lengths.reserve(field.get_data().size());
+    for (auto& datum : field.get_data()){
         double length = 0;
 
         if (bobbinWindingWindowShape == WindingWindowShape::RECTANGULAR) {
@@ -292,20 +297,42 @@ double LeakageInductance::integrate_leakage_energy(Magnetic& magnetic, ComplexFi
                 length = std::numbers::pi * (radialHeightFromCenter - bobbinColumnWidth) + 2 * bobbinColumnWidth + 2 * bobbinColumnDepth;
             }
         }
+        lengths.push_back(length);
+    }
+    return lengths;
+}
+
+double LeakageInductance::integrate_leakage_energy(Magnetic& magnetic, ComplexField& field, double dA) {
+    auto lengths = calculate_integration_lengths(magnetic, field);
+    double vacuumPermeability = Constants().vacuumPermeability;
 
+    double energy = 0;
+    for (size_t pointIndex = 0; pointIndex < field.get_data().size(); ++pointIndex) {
+        auto& datum = field.get_data()[pointIndex];
         double magneticFieldStrengthSquared = pow(datum.get_real(), 2) + pow(datum.get_imaginary(), 2);
-        energy += 0.5 * vacuumPermeability * magneticFieldStrengthSquared * dA * length;
+        energy += 0.5 * vacuumPermeability * magneticFieldStrengthSquared * dA * lengths[pointIndex];
     }
 
     return energy;
 }
 
-double LeakageInductance::calculate_leakage_field_energy(Magnetic magnetic, const std::vector<double>& currentsRmsSigned, double frequency, size_t harmonicIndex) {
+void LeakageInductance::check_leakage_field_prerequisites(Magnetic& magnetic, const std::string& calculationName) {
     if (!magnetic.get_core().get_processed_description()) {
         throw CoreNotProcessedException(
-            "Cannot calculate leakage field energy: the core has no processed description "
+            "Cannot calculate " + calculationName + ": the core has no processed description "
             "(effective parameters/shape unresolved). Run magnetic autocomplete / process the core first.");
     }
+    auto bobbin = magnetic.get_mutable_coil().resolve_bobbin();
+    if (!bobbin.get_processed_description()){
+        throw CoilNotProcessedException("Cannot calculate " + calculationName + ": bobbin description has not been processed");
+    }
+    if (!bobbin.get_processed_description()->get_column_width()){
+        throw InvalidInputException(ErrorCode::INVALID_BOBBIN_DATA, "Cannot calculate " + calculationName + ": bobbin column width is not defined");
+    }
+}
+
+double LeakageInductance::calculate_leakage_field_energy(Magnetic magnetic, const std::vector<double>& currentsRmsSigned, double frequency, size_t harmonicIndex) {
+    check_leakage_field_prerequisites(magnetic, "leakage field energy");
     size_t numberWindings = magnetic.get_coil().get_functional_description().size();
     if (currentsRmsSigned.size() != numberWindings) {
         throw InvalidInputException(ErrorCode::COIL_INVALID_TURNS,
@@ -316,14 +343,6 @@ double LeakageInductance::calculate_leakage_field_energy(Magnetic magnetic, cons
     // RAII guard (see calculate_leakage_inductance above).
     SettingsGuard<bool> fringingGuard(settings, &Settings::get_magnetic_field_include_fringing, &Settings::set_magnetic_field_include_fringing, false);
 
-    auto bobbin = magnetic.get_mutable_coil().resolve_bobbin();
-    if (!bobbin.get_processed_description()){
-        throw CoilNotProcessedException("Cannot calculate leakage field energy: bobbin description has not been processed");
-    }
-    if (!bobbin.get_processed_description()->get_column_width()){
-        throw InvalidInputException(ErrorCode::INVALID_BOBBIN_DATA, "Cannot calculate leakage field energy: bobbin column width is not defined");
-    }
-
     // Split the signed RMS current vector into magnitudes (operating point) and directions
     // (sign vector passed to the field model, which scales each winding's turn currents).
     std::vector<int8_t> directions;
@@ -343,37 +362,105 @@ double LeakageInductance::calculate_leakage_field_energy(Magnetic magnetic, cons
     return energy;
 }
 
-std::vector<std::vector<double>> LeakageInductance::calculate_leakage_inductance_matrix(Magnetic magnetic, double frequency, size_t harmonicIndex) {
+double LeakageInductance::calculate_leakage_field_energy(const LeakageFieldBasis& basis, const std::vector<double>& currentsRmsSigned) {
+    size_t numberWindings = basis.fieldPerWinding.size();
+    if (currentsRmsSigned.size() != numberWindings) {
+        throw InvalidInputException(ErrorCode::COIL_INVALID_TURNS,
+            "Cannot calculate leakage field energy: current vector size (" + std::to_string(currentsRmsSigned.size()) +
+            ") does not match number of windings in the field basis (" + std::to_string(numberWindings) + ")");
+    }
+
+    double energy = 0;
+    for (size_t pointIndex = 0; pointIndex < basis.weightPerPoint.size(); ++pointIndex) {
+        double real = 0;
+        double imaginary = 0;
+        for (size_t windingIndex = 0; windingIndex < numberWindings; ++windingIndex) {
+            auto& datum = basis.fieldPerWinding[windingIndex].get_data()[pointIndex];
+            real += currentsRmsSigned[windingIndex] * datum.get_real();
+            imaginary += currentsRmsSigned[windingIndex] * datum.get_imaginary();
+        }
+        energy += basis.weightPerPoint[pointIndex] * (real * real + imaginary * imaginary);
+    }
+    return energy;
+}
+
+LeakageFieldBasis LeakageInductance::calculate_leakage_field_basis(Magnetic magnetic, double frequency, size_t harmonicIndex) {
     size_t numberWindings = magnetic.get_coil().get_functional_description().size();
     if (numberWindings == 0) {
         throw InvalidInputException(ErrorCode::COIL_INVALID_TURNS,
-            "Cannot calculate leakage inductance matrix: no windings defined");
+            "Cannot calculate leakage field basis: no windings defined");
+    }
+    check_leakage_field_prerequisites(magnetic, "leakage field basis");
+    if (!magnetic.get_coil_mesh_cache()) {
+        magnetic.set_coil_mesh_cache(std::make_shared<CoilMeshCache>());
     }
 
-    // Self-leakage energies W(e_a): excite a single winding with the unit reference current.
-    std::vector<double> selfEnergy(numberWindings);
-    for (size_t a = 0; a < numberWindings; ++a) {
+    // RAII guard (see calculate_leakage_inductance above).
+    SettingsGuard<bool> fringingGuard(settings, &Settings::get_magnetic_field_include_fringing, &Settings::set_magnetic_field_include_fringing, false);
+
+    std::vector<OperatingPoint> unitOperatingPoints;
+    for (size_t windingIndex = 0; windingIndex < numberWindings; ++windingIndex) {
         std::vector<double> currents(numberWindings, 0.0);
-        currents[a] = 1.0;
-        selfEnergy[a] = calculate_leakage_field_energy(magnetic, currents, frequency, harmonicIndex);
+        currents[windingIndex] = 1.0;
+        unitOperatingPoints.push_back(create_excitation_operating_point(magnetic, currents, frequency));
     }
 
-    std::vector<std::vector<double>> leakageMatrix(numberWindings, std::vector<double>(numberWindings, 0.0));
-    // Diagonal: Λ_aa = 4·W(e_a). The factor 4 = 2/I_rms² with the unit reference current's
-    // RMS of 1/sqrt(2), matching calculate_leakage_inductance's 2·energy/I_rms² convention.
-    for (size_t a = 0; a < numberWindings; ++a) {
-        leakageMatrix[a][a] = 4.0 * selfEnergy[a];
+    // The mesh depends on the geometry and the harmonic frequency only, so every winding's
+    // field lands on the same points and can be superposed point by point.
+    auto harmonics = unitOperatingPoints[0].get_excitations_per_winding()[0].get_current()->get_harmonics().value();
+    auto harmonicFrequency = harmonics.get_frequencies()[harmonicIndex];
+    auto [numberPointsX, numberPointsY] = calculate_grid_points(magnetic, harmonicFrequency);
+    auto meshResult = CoilMesher::generate_mesh_induced_grid(magnetic, harmonicFrequency, numberPointsX, numberPointsY);
+    Field inducedField = meshResult.first;
+    if (inducedField.get_data().size() == 0) {
+        throw CalculationException(ErrorCode::CALCULATION_ERROR, "Mesh generation failed: induced field data is empty");
     }
-    // Off-diagonal via polarization: Λ_ab = 2·[W(e_a+e_b) − W(e_a) − W(e_b)].
+    double dA = meshResult.second;
+
+    LeakageFieldBasis basis;
+    std::vector<int8_t> directions(numberWindings, 1);
+    for (size_t windingIndex = 0; windingIndex < numberWindings; ++windingIndex) {
+        basis.fieldPerWinding.push_back(calculate_field_on_mesh(unitOperatingPoints[windingIndex], magnetic, inducedField, directions));
+    }
+
+    double vacuumPermeability = Constants().vacuumPermeability;
+    auto lengths = calculate_integration_lengths(magnetic, basis.fieldPerWinding[0]);
+    basis.weightPerPoint.reserve(lengths.size());
+    for (auto length : lengths) {
+        basis.weightPerPoint.push_back(0.5 * vacuumPermeability * dA * length);
+    }
+    return basis;
+}
+
+std::vector<std::vector<double>> LeakageInductance::calculate_leakage_inductance_matrix(Magnetic magnetic, double frequency, size_t harmonicIndex) {
+    size_t numberWindings = magnetic.get_coil().get_functional_description().size();
+    if (numberWindings == 0) {
+        throw InvalidInputException(ErrorCode::COIL_INVALID_TURNS,
+            "Cannot calculate leakage inductance matrix: no windings defined");
+    }
+
+    return calculate_leakage_inductance_matrix(calculate_leakage_field_basis(magnetic, frequency, harmonicIndex));
+}
+
+std::vector<std::vector<double>> LeakageInductance::calculate_leakage_inductance_matrix(const LeakageFieldBasis& basis) {
+    size_t numberWindings = basis.fieldPerWinding.size();
+
+    // Gram matrix of the basis under the energy weights. Its diagonal is W(e_a), and by
+    // polarization W(e_a+e_b) − W(e_a) − W(e_b) = 2·Σ_p w_p·Re(H_a·conj(H_b)). The factor 4
+    // = 2/I_rms² with the unit reference current's RMS of 1/sqrt(2), matching
+    // calculate_leakage_inductance's 2·energy/I_rms² convention, so Λ = 4·G.
+    std::vector<std::vector<double>> leakageMatrix(numberWindings, std::vector<double>(numberWindings, 0.0));
     for (size_t a = 0; a < numberWindings; ++a) {
-        for (size_t b = a + 1; b < numberWindings; ++b) {
-            std::vector<double> currents(numberWindings, 0.0);
-            currents[a] = 1.0;
-            currents[b] = 1.0;
-            double pairEnergy = calculate_leakage_field_energy(magnetic, currents, frequency, harmonicIndex);
-            double mutualLeakage = 2.0 * (pairEnergy - selfEnergy[a] - selfEnergy[b]);
-            leakageMatrix[a][b] = mutualLeakage;
-            leakageMatrix[b][a] = mutualLeakage;
+        auto& fieldA = basis.fieldPerWinding[a].get_data();
+        for (size_t b = a; b < numberWindings; ++b) {
+            auto& fieldB = basis.fieldPerWinding[b].get_data();
+            double gram = 0;
+            for (size_t pointIndex = 0; pointIndex < basis.weightPerPoint.size(); ++pointIndex) {
+                gram += basis.weightPerPoint[pointIndex] * (fieldA[pointIndex].get_real() * fieldB[pointIndex].get_real() +
+                                                            fieldA[pointIndex].get_imaginary() * fieldB[pointIndex].get_imaginary());
+            }
+            leakageMatrix[a][b] = 4.0 * gram;
+            leakageMatrix[b][a] = 4.0 * gram;
         }
     }
 
@@ -9,6 +9,16 @@ using namespace MAS;
 
 namespace OpenMagnetics {
 
+// Leakage field of each winding driven alone with the unit reference current, sampled on
+// one shared induced grid. The field is linear in the winding currents, so the window
+// energy of any signed current vector is a quadratic form over this basis and needs no
+// further field solves. Built by LeakageInductance::calculate_leakage_field_basis.
+struct LeakageFieldBasis {
+    std::vector<ComplexField> fieldPerWinding;
+    // Integration weight of each grid point: 0.5·mu0·dA·(turn length through the point).
+    std::vector<double> weightPerPoint;
+};
+
 class LeakageInductance{
     public:
 
@@ -30,6 +40,12 @@ class LeakageInductance{
     // inductance matrix; fringing is disabled internally (leakage field only), matching
     // calculate_leakage_inductance.
     double calculate_leakage_field_energy(Magnetic magnetic, const std::vector<double>& currentsRmsSigned, double frequency, size_t harmonicIndex = 1);
+    // Same energy by superposition over a precomputed basis: Σ_p w_p·|Σ_a I_a·H_a(p)|².
+    static double calculate_leakage_field_energy(const LeakageFieldBasis& basis, const std::vector<double>& currentsRmsSigned);
+
+    // One field solve per winding (unit current, all others off), all on the same mesh.
+    // Reuse the result for as many current vectors as needed.
+    LeakageFieldBasis calculate_leakage_field_basis(Magnetic magnetic, double frequency, size_t harmonicIndex = 1);
 
     // Full symmetric N×N leakage inductance matrix Λ (henries), in the per-winding physical
     // current basis, assembled from the energy quadratic form via polarization:
@@ -37,8 +53,10 @@ class LeakageInductance{
     // It is well-conditioned (contains NO magnetizing term — the core flux is excluded from
     // the window-energy integral). The diagonal Λ_aa is the self-leakage of winding a, the
     // off-diagonal Λ_ab the mutual leakage. For an ampere-turn-balanced pair it reproduces
-    // calculate_leakage_inductance exactly. Cost: N + N(N−1)/2 field solves.
+    // calculate_leakage_inductance exactly. Cost: N field solves (one basis), the pair
+    // energies come from superposition: Λ_ab = 4·Σ_p w_p·Re(H_a(p)·conj(H_b(p))).
     std::vector<std::vector<double>> calculate_leakage_inductance_matrix(Magnetic magnetic, double frequency, size_t harmonicIndex = 1);
+    static std::vector<std::vector<double>> calculate_leakage_inductance_matrix(const LeakageFieldBasis& basis);
 
     private:
         static constexpr double NEGLIGIBLE_CURRENT = 1e-9;
@@ -56,6 +74,13 @@ class LeakageInductance{
         // Integrate the leakage magnetic-field energy over the winding window from a computed
         // field. Extracted from calculate_leakage_inductance so the energy core is reusable.
         double integrate_leakage_energy(Magnetic& magnetic, ComplexField& field, double dA);
+        // Turn length (m) through every point of the field, the geometric part of the
+        // energy integrand shared by integrate_leakage_energy and the field basis.
+        std::vector<double> calculate_integration_lengths(Magnetic& magnetic, ComplexField& field);
+        // Field of one excitation on an already generated mesh, including the toroid
+        // outer-half stitching. The magnetic is taken by value as the stitching rewrites turns.
+        ComplexField calculate_field_on_mesh(OperatingPoint& operatingPoint, Magnetic magnetic, Field& inducedField, std::optional<std::vector<int8_t>> customCurrentDirectionPerWinding);
+        void check_leakage_field_prerequisites(Magnetic& magnetic, const std::string& calculationName);
         CoilMesherModels select_mesh_model(Magnetic& magnetic);
         std::pair<size_t, size_t> calculate_grid_points(Magnetic& magnetic, double frequency);
 
@@ -63,11 +63,7 @@ double MagneticEnergy::get_gap_maximum_magnetic_energy(CoreGap gapInfo, double m
         fringingFactorValue = fringingFactor.value();
     }
     else {
-        ReluctanceModels reluctanceModelEnum;
-        from_json(_models["gapReluctance"], reluctanceModelEnum);
-        auto reluctanceModel = OpenMagnetics::ReluctanceModel::factory(reluctanceModelEnum);
-
-        fringingFactorValue = reluctanceModel->get_gap_reluctance(gapInfo).get_fringing_factor();
+        fringingFactorValue = _reluctanceModel.get_gap_reluctance(gapInfo).get_fringing_factor();
     }
 
     // E = 0.5 * Phi^2 * R_gap with Phi = Bsat * A and R_gap = lg / (mu0 * A * F):
@@ -84,11 +80,7 @@ double MagneticEnergy::calculate_gap_length_by_magnetic_energy(CoreGap gapInfo,
     auto constants = Constants();
     auto gapArea = *(gapInfo.get_area());
 
-    ReluctanceModels reluctanceModelEnum;
-    from_json(_models["gapReluctance"], reluctanceModelEnum);
-    auto reluctanceModel = OpenMagnetics::ReluctanceModel::factory(reluctanceModelEnum);
-
-    double fringingFactor = reluctanceModel->get_gap_reluctance(gapInfo).get_fringing_factor();
+    double fringingFactor = _reluctanceModel.get_gap_reluctance(gapInfo).get_fringing_factor();
 
     // Inverse of calculate_gap_maximum_storable_magnetic_energy:
     // E = B^2 * A * lg / (2 * mu0 * F)  =>  lg = 2 * E * mu0 * F / (B^2 * A)
@@ -103,11 +95,7 @@ double MagneticEnergy::calculate_gap_length_by_saturation_constraint(CoreGap gap
     auto constants = Constants();
     auto gapArea = *(gapInfo.get_area());
 
-    ReluctanceModels reluctanceModelEnum;
-    from_json(_models["gapReluctance"], reluctanceModelEnum);
-    auto reluctanceModel = OpenMagnetics::ReluctanceModel::factory(reluctanceModelEnum);
-
-    double fringingFactor = reluctanceModel->get_gap_reluctance(gapInfo).get_fringing_factor();
+    double fringingFactor = _reluctanceModel.get_gap_reluctance(gapInfo).get_fringing_factor();
 
     // Get core effective area
     double effectiveArea = core.get_effective_area();
@@ -23,6 +23,7 @@ namespace OpenMagnetics {
 class MagneticEnergy {
 private:
     std::map<std::string, std::string> _models;
+    ReluctanceModelHandle _reluctanceModel;
 protected:
 public:
     MagneticEnergy(std::map<std::string, std::string> models) {
@@ -31,10 +32,12 @@ public:
         if (models.find("gapReluctance") == models.end()) {
             _models["gapReluctance"] = to_string(defaults.reluctanceModelDefault);
         }
+        _reluctanceModel = ReluctanceModelHandle(_models);
     }
     MagneticEnergy() {
         auto defaults = OpenMagnetics::Defaults();
         _models["gapReluctance"] = to_string(defaults.reluctanceModelDefault);
+        _reluctanceModel = ReluctanceModelHandle(_models);
     }
     static double get_ungapped_core_maximum_magnetic_energy(Core core, std::optional<OperatingPoint> operatingPoint = std::nullopt, bool saturationProportion = true);
     static double get_ungapped_core_maximum_magnetic_energy(Core core, double temperature, std::optional<double> frequency = std::nullopt, bool saturationProportion = true);
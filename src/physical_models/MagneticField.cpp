@@ -9,6 +9,7 @@
 #include "physical_models/InitialPermeability.h"
 #include "support/Settings.h"
 #include "support/Utils.h"
+#include "support/WorkCounters.h"
 
 #include <algorithm>
 #include <cmath>
@@ -219,7 +220,7 @@ bool is_inside_core(FieldPoint inducedFieldPoint, double coreColumnWidth, double
 
 double get_magnetic_field_strength_gap(OperatingPoint& operatingPoint, Magnetic magnetic, double frequency) {
     auto numberTurns = magnetic.get_mutable_coil().get_number_turns(0);
-    auto reluctanceModel = OpenMagnetics::ReluctanceModel::factory();
+    ReluctanceModelHandle reluctanceModel;
     OpenMagnetics::InitialPermeability initial_permeability;
     double initialPermeability = initial_permeability.get_initial_permeability(magnetic.get_mutable_core().resolve_material(), std::nullopt, std::nullopt, frequency);
     double reluctance = reluctanceModel->get_core_reluctance(magnetic.get_core(), initialPermeability).get_core_reluctance();
@@ -269,6 +270,7 @@ double get_magnetic_field_strength_gap(OperatingPoint& operatingPoint, Magnetic
 }
 
 WindingWindowMagneticStrengthFieldOutput MagneticField::calculate_magnetic_field_strength_field(OperatingPoint operatingPoint, Magnetic magnetic, std::optional<Field> externalInducedField, std::optional<std::vector<int8_t>> customCurrentDirectionPerWinding, std::optional<CoilMesherModels> coilMesherModel) {
+    count_work(WorkCounter::MAGNETIC_FIELD_EVALUATION);
     auto& settings = OpenMagnetics::Settings::GetInstance();
     auto includeFringing = settings.get_magnetic_field_include_fringing();
 
@@ -213,7 +213,7 @@ double MagnetizingInductance::calculate_drum_ring_magnetizing_inductance(Core co
     double vacuumPermeability = Constants().vacuumPermeability;
     double ferriteReluctance = (drumC1 / drumPermeability + ringC1 / ringPermeability) / vacuumPermeability;
 
-    auto reluctanceModelForGaps = ReluctanceModel::factory(Defaults().reluctanceModelDefault);
+    ReluctanceModelHandle reluctanceModelForGaps(Defaults().reluctanceModelDefault);
     double clearanceReluctance = reluctanceModelForGaps->get_gapping_reluctance(core).get_gapping_reluctance().value();
 
     return pow(numberTurns, 2) / (ferriteReluctance + clearanceReluctance);
@@ -242,7 +242,74 @@ static SignalDescriptor calculate_flux_density_for_family_model(double magnetizi
     return OpenMagnetics::MagneticField::calculate_magnetic_flux_density(magneticFlux, fluxCarryingArea);
 }
 
+namespace {
+
+struct SolveMemoEntry {
+    std::pair<MagnetizingInductanceOutput, SignalDescriptor> result;
+    std::optional<OperatingPoint> operatingPoint;
+};
+
+// Per thread, like the other model memos (ABT #113): no locking, and a worker
+// never sees an entry computed under another thread's Settings.
+thread_local std::map<std::string, SolveMemoEntry> solveMemo;
+
+std::string get_solve_memo_key(const std::string& model, Core& core, Coil& coil, OperatingPoint* operatingPoint) {
+    json key;
+    key["model"] = model;
+    key["settings"] = Settings::GetInstance().get_fingerprint();
+    key["databasesGeneration"] = get_databases_generation();
+    key["core"]["functionalDescription"] = core.get_functional_description();
+    if (core.get_processed_description()) {
+        key["core"]["processedDescription"] = core.get_processed_description().value();
+    }
+    key["coil"]["functionalDescription"] = coil.get_functional_description();
+    if (coil.get_sections_description()) {
+        key["coil"]["sectionsDescription"] = coil.get_sections_description().value();
+    }
+    if (operatingPoint) {
+        key["operatingPoint"] = *operatingPoint;
+    }
+    return key.dump();
+}
+
+} // namespace
+
+size_t MagnetizingInductance::get_memo_size() {
+    return solveMemo.size();
+}
+
+void MagnetizingInductance::clear_memo() {
+    solveMemo.clear();
+}
+
 std::pair<MagnetizingInductanceOutput, SignalDescriptor> MagnetizingInductance::calculate_inductance_and_magnetic_flux_density(Core core, Coil coil, OperatingPoint* operatingPoint) {
+    size_t memoSize = Settings::GetInstance().get_magnetizing_inductance_memo_size();
+    if (memoSize == 0) {
+        return solve_inductance_and_magnetic_flux_density(core, coil, operatingPoint);
+    }
+
+    auto key = get_solve_memo_key(_models["gapReluctance"], core, coil, operatingPoint);
+    auto hit = solveMemo.find(key);
+    if (hit != solveMemo.end()) {
+        if (operatingPoint) {
+            *operatingPoint = hit->second.operatingPoint.value();
+        }
+        return hit->second.result;
+    }
+
+    auto result = solve_inductance_and_magnetic_flux_density(core, coil, operatingPoint);
+    if (solveMemo.size() >= memoSize) {
+        solveMemo.clear();
+    }
+    SolveMemoEntry entry{result, std::nullopt};
+    if (operatingPoint) {
+        entry.operatingPoint = *operatingPoint;
+    }
+    solveMemo.emplace(std::move(key), std::move(entry));
+    return result;
+}
+
+std::pair<MagnetizingInductanceOutput, SignalDescriptor> MagnetizingInductance::solve_inductance_and_magnetic_flux_density(Core core, Coil coil, OperatingPoint* operatingPoint) {
 
     // ABT #417: a drumRing core's two structural annular-clearance gaps are DERIVED
     // (Core::process_gap synthesizes them from A/K/D/F — nothing is ever hand-authored
@@ -368,9 +435,7 @@ std::pair<MagnetizingInductanceOutput, SignalDescriptor> MagnetizingInductance::
     OpenMagnetics::InitialPermeability initialPermeability;
     double currentInitialPermeability;
 
-    ReluctanceModels reluctanceModelEnum;
-    from_json(_models["gapReluctance"], reluctanceModelEnum);
-    auto reluctanceModel = OpenMagnetics::ReluctanceModel::factory(reluctanceModelEnum);
+    auto& reluctanceModel = _reluctanceModel;
     double currentTotalReluctance;
     double modifiedTotalReluctance = 0;
     double modifiedMagnetizingInductance = 5e-3;
@@ -638,9 +703,7 @@ double MagnetizingInductance::calculate_inductance_air_solenoid(Magnetic magneti
 double MagnetizingInductance::calculate_inductance_air_solenoid(Core core, Coil coil) {
     double numberTurnsPrimary = coil.get_functional_description()[0].get_number_turns();
 
-    ReluctanceModels reluctanceModelEnum;
-    from_json(_models["gapReluctance"], reluctanceModelEnum);
-    auto reluctanceModel = OpenMagnetics::ReluctanceModel::factory(reluctanceModelEnum);
+    auto& reluctanceModel = _reluctanceModel;
     double airCoreReluctance = reluctanceModel->get_air_cored_reluctance(coil.resolve_bobbin());
     auto modifiedMagnetizingInductance = pow(numberTurnsPrimary, 2) / airCoreReluctance;
     return modifiedMagnetizingInductance;
@@ -658,7 +721,8 @@ MagnetizingInductanceOutput MagnetizingInductance::calculate_inductance_from_num
     return inductance_and_magnetic_flux_density.first;
 }
 
-int MagnetizingInductance::calculate_number_turns_from_gapping_and_inductance(Core core, Coil coil, Inputs* inputs, DimensionalValues preferredValue) {
+int MagnetizingInductance::calculate_number_turns_from_gapping_and_inductance(Core core, Coil coil, Inputs* inputs, DimensionalValues preferredValue,
+                                                                          MagnetizingInductanceSolverState* solverState) {
     // Single source of truth for "turns for a target inductance": the EXACT
     // inverse of calculate_inductance_from_number_turns_and_gapping (the model
     // the inductance filter uses), so the two can never disagree. The previous
@@ -694,23 +758,45 @@ int MagnetizingInductance::calculate_number_turns_from_gapping_and_inductance(Co
 
     // Unbiased reluctance seed: N0 = round(sqrt(L * R_core(mu_initial))).
     OpenMagnetics::InitialPermeability initialPermeability;
-    ReluctanceModels reluctanceModelEnum;
-    from_json(_models["gapReluctance"], reluctanceModelEnum);
-    auto reluctanceModel = OpenMagnetics::ReluctanceModel::factory(reluctanceModelEnum);
+    auto& reluctanceModel = _reluctanceModel;
     double initialMu = initialPermeability.get_initial_permeability(core.resolve_material(), temperature, std::nullopt, frequency);
     double seedReluctance = reluctanceModel->get_core_reluctance(core, initialMu).get_core_reluctance();
     int numberTurnsPrimary = std::max(1, static_cast<int>(std::round(std::sqrt(desiredMagnetizingInductance * seedReluctance))));
 
+    if (solverState) {
+        solverState->numberInductanceEvaluations = 0;
+        solverState->numberReluctanceEvaluations = 0;
+    }
+
     if (operatingPointPtr == nullptr) {
         // No operating point: the unbiased seed is the exact answer.
         return numberTurnsPrimary;
     }
 
+    // Warm start: one Newton step from the neighbouring solution, whose
+    // inductance already includes the bias rolloff the unbiased seed ignores.
+    if (solverState && solverState->numberTurns && solverState->magnetizingInductance &&
+        solverState->numberTurns.value() > 0 && solverState->magnetizingInductance.value() > 0) {
+        double previousTurns = static_cast<double>(solverState->numberTurns.value());
+        numberTurnsPrimary = std::max(1, static_cast<int>(std::round(previousTurns * std::sqrt(desiredMagnetizingInductance / solverState->magnetizingInductance.value()))));
+    }
+
     // Evaluate the canonical operating-point inductance at a trial turn count.
+    // Every trial starts from the caller's operating point (the solve rewrites
+    // it), so an evaluation depends on n alone and can be reused between the
+    // Newton loop and the neighbour pick.
+    std::map<int, double> inductancePerTurns;
     auto inductanceAtTurns = [&](int n) -> double {
+        auto known = inductancePerTurns.find(n);
+        if (known != inductancePerTurns.end()) {
+            return known->second;
+        }
         coil.get_mutable_functional_description()[0].set_number_turns(static_cast<int64_t>(n));
-        auto out = calculate_inductance_from_number_turns_and_gapping(core, coil, operatingPointPtr);
-        return resolve_dimensional_values(out.get_magnetizing_inductance());
+        auto trialOperatingPoint = operatingPoint;
+        auto out = calculate_inductance_from_number_turns_and_gapping(core, coil, &trialOperatingPoint);
+        double inductance = resolve_dimensional_values(out.get_magnetizing_inductance());
+        inductancePerTurns[n] = inductance;
+        return inductance;
     };
 
     // Newton on L proportional to N^2: corrects the seed up or down.
@@ -756,7 +842,16 @@ int MagnetizingInductance::calculate_number_turns_from_gapping_and_inductance(Co
         numberTurnsPrimary = bestTurns;
     }
 
-    return std::max(1, numberTurnsPrimary);
+    numberTurnsPrimary = std::max(1, numberTurnsPrimary);
+    if (solverState) {
+        solverState->numberInductanceEvaluations = inductancePerTurns.size();
+        double inductance = inductanceAtTurns(numberTurnsPrimary);
+        if (inductance > 0) {
+            solverState->numberTurns = numberTurnsPrimary;
+            solverState->magnetizingInductance = inductance;
+        }
+    }
+    return numberTurnsPrimary;
 }
 
 int MagnetizingInductance::calculate_number_turns_from_gapping_and_inductance(Core core, Inputs* inputs, DimensionalValues preferredValue) {
@@ -789,9 +884,7 @@ double MagnetizingInductance::calculate_gap_from_saturation_constraint(Core core
     double desiredMagnetizingInductance = resolve_dimensional_values(inputs->get_design_requirements().get_magnetizing_inductance(), DimensionalValues::NOMINAL);
     double effectiveArea = core.get_processed_description()->get_effective_parameters().get_effective_area();
     
-    ReluctanceModels reluctanceModelEnum;
-    from_json(_models["gapReluctance"], reluctanceModelEnum);
-    auto reluctanceModel = OpenMagnetics::ReluctanceModel::factory(reluctanceModelEnum);
+    auto& reluctanceModel = _reluctanceModel;
     
     // Start with energy-based gap as initial guess:
     // 0.5*L*I^2 = B^2/(2*mu0) * A * g  =>  g = mu0*L*I^2 / (A*B^2)
@@ -923,7 +1016,8 @@ std::vector<CoreGap> MagnetizingInductance::calculate_gapping_from_number_turns_
                                                                                                Coil coil,
                                                                                                Inputs* inputs,
                                                                                                GappingType gappingType,
-                                                                                               size_t decimals) {
+                                                                                               size_t decimals,
+                                                                                               MagnetizingInductanceSolverState* solverState) {
     double frequency = Defaults().coreAdviserFrequencyReference;
     double temperature = Defaults().ambientTemperature;
     OperatingPointExcitation excitation;
@@ -956,9 +1050,7 @@ std::vector<CoreGap> MagnetizingInductance::calculate_gapping_from_number_turns_
     double modifiedInitialPermeability;
     double currentInitialPermeability;
 
-    ReluctanceModels reluctanceModelEnum;
-    from_json(_models["gapReluctance"], reluctanceModelEnum);
-    auto reluctanceModel = OpenMagnetics::ReluctanceModel::factory(reluctanceModelEnum);
+    auto& reluctanceModel = _reluctanceModel;
     double neededTotalReluctance = pow(numberTurnsPrimary, 2) / desiredMagnetizingInductance;
 
     currentInitialPermeability = initialPermeability.get_initial_permeability(core.resolve_material(), temperature, std::nullopt, frequency);
@@ -997,8 +1089,26 @@ std::vector<CoreGap> MagnetizingInductance::calculate_gapping_from_number_turns_
     bool increasingGap = true;
     double fringingFactorOneGap = 0;
 
+    // Warm start from a neighbouring solution (usually the same core one turn
+    // away): start at its gap with a small step that doubles until the target
+    // is bracketed, then bisect exactly as the cold search does. Distributed
+    // gapping re-balances its number of gaps while searching, so it stays cold.
+    bool warmStart = solverState && solverState->gapLength && solverState->gapLength.value() > constants.residualGap &&
+                     gappingType != GappingType::DISTRIBUTED;
+    bool bracketed = false;
+    bool firstProbe = true;
+    if (warmStart) {
+        gapLength = solverState->gapLength.value();
+        gapLengthModification = std::max(gapLength * 0.05, constants.residualGap);
+    }
+    if (solverState) {
+        solverState->numberInductanceEvaluations = 0;
+        solverState->numberReluctanceEvaluations = 0;
+    }
+
     double reluctance = 0;
     size_t numberDistributedGaps = 3;
+    bool converged = false;
     timeout = 100;
     Core gappedCore;
 
@@ -1017,7 +1127,7 @@ std::vector<CoreGap> MagnetizingInductance::calculate_gapping_from_number_turns_
             case GappingType::DISTRIBUTED:
                 while (numberDistributedGaps > 3) {
                     gappedCore = get_core_with_distributed_gapping(core, gapLength, numberDistributedGaps);
-                    fringingFactorOneGap = reluctanceModel->get_gap_reluctance(gappedCore.get_gapping()[0]).get_fringing_factor();
+                    fringingFactorOneGap = reluctanceModel.get_gap_reluctance(gappedCore.get_gapping()[0]).get_fringing_factor();
                     if (fringingFactorOneGap < constants.minimumDistributedFringingFactor &&
                         numberDistributedGaps > 1) {
                         gapLength *= numberDistributedGaps;
@@ -1030,7 +1140,7 @@ std::vector<CoreGap> MagnetizingInductance::calculate_gapping_from_number_turns_
                 }
                 while (true) {
                     gappedCore = get_core_with_distributed_gapping(core, gapLength, numberDistributedGaps);
-                    fringingFactorOneGap = reluctanceModel->get_gap_reluctance(gappedCore.get_gapping()[0]).get_fringing_factor();
+                    fringingFactorOneGap = reluctanceModel.get_gap_reluctance(gappedCore.get_gapping()[0]).get_fringing_factor();
                     if (fringingFactorOneGap > constants.maximumDistributedFringingFactor) {
                         gapLength *= numberDistributedGaps;
                         numberDistributedGaps += 2;
@@ -1047,19 +1157,38 @@ std::vector<CoreGap> MagnetizingInductance::calculate_gapping_from_number_turns_
 
         auto magnetizingInductanceOutput = reluctanceModel->get_core_reluctance(gappedCore, currentInitialPermeability);
         reluctance = magnetizingInductanceOutput.get_core_reluctance();
+        if (solverState) {
+            solverState->numberReluctanceEvaluations++;
+        }
 
-        if (fabs(neededTotalReluctance - reluctance) / neededTotalReluctance < 0.001 || timeout == 0) {
+        converged = fabs(neededTotalReluctance - reluctance) / neededTotalReluctance < 0.001;
+        if (converged || timeout == 0) {
             break;
         }
         else {
-            if (neededTotalReluctance < reluctance && increasingGap) {
-                increasingGap = false;
-                gapLengthModification = std::max(gapLengthModification / 2., constants.residualGap);
+            if (warmStart && firstProbe) {
+                increasingGap = neededTotalReluctance > reluctance;
             }
-            if (neededTotalReluctance > reluctance && !increasingGap) {
-                increasingGap = true;
-                gapLengthModification = std::max(gapLengthModification / 2., constants.residualGap);
+            else {
+                bool wasIncreasingGap = increasingGap;
+                if (neededTotalReluctance < reluctance && increasingGap) {
+                    increasingGap = false;
+                    gapLengthModification = std::max(gapLengthModification / 2., constants.residualGap);
+                }
+                if (neededTotalReluctance > reluctance && !increasingGap) {
+                    increasingGap = true;
+                    gapLengthModification = std::max(gapLengthModification / 2., constants.residualGap);
+                }
+                if (warmStart && !bracketed) {
+                    if (increasingGap == wasIncreasingGap) {
+                        gapLengthModification *= 2;
+                    }
+                    else {
+                        bracketed = true;
+                    }
+                }
             }
+            firstProbe = false;
             if (increasingGap) {
                 gapLength += gapLengthModification;
             }
@@ -1071,6 +1200,15 @@ std::vector<CoreGap> MagnetizingInductance::calculate_gapping_from_number_turns_
         }
     }
 
+    // A search that ran out of steps is not a solution to seed the next one from.
+    if (solverState) {
+        if (converged) {
+            solverState->gapLength = gapLength;
+        }
+        else {
+            solverState->gapLength = std::nullopt;
+        }
+    }
     gapLength = std::max(constants.residualGap, roundFloat(gapLength, decimals));
 
     switch (gappingType) {
@@ -1096,9 +1234,7 @@ double MagnetizingInductance::calculate_turns_for_gap(
     double frequency) 
 {
     OpenMagnetics::InitialPermeability initialPermeability;
-    ReluctanceModels reluctanceModelEnum;
-    from_json(_models["gapReluctance"], reluctanceModelEnum);
-    auto reluctanceModel = OpenMagnetics::ReluctanceModel::factory(reluctanceModelEnum);
+    auto& reluctanceModel = _reluctanceModel;
     
     double currentInitialPermeability = initialPermeability.get_initial_permeability(
         core.resolve_material(), temperature, std::nullopt, frequency);
@@ -1118,9 +1254,7 @@ double MagnetizingInductance::calculate_flux_density_peak(
     double frequency) 
 {
     OpenMagnetics::InitialPermeability initialPermeability;
-    ReluctanceModels reluctanceModelEnum;
-    from_json(_models["gapReluctance"], reluctanceModelEnum);
-    auto reluctanceModel = OpenMagnetics::ReluctanceModel::factory(reluctanceModelEnum);
+    auto& reluctanceModel = _reluctanceModel;
     
     double currentInitialPermeability = initialPermeability.get_initial_permeability(
         core.resolve_material(), temperature, std::nullopt, frequency);
@@ -1242,9 +1376,7 @@ std::pair<double, double> MagnetizingInductance::calculate_optimal_gap_and_turns
     
     // Step 3: Get core reluctance (ungapped) to determine needed gap reluctance
     OpenMagnetics::InitialPermeability initialPermeability;
-    ReluctanceModels reluctanceModelEnum;
-    from_json(_models["gapReluctance"], reluctanceModelEnum);
-    auto reluctanceModel = OpenMagnetics::ReluctanceModel::factory(reluctanceModelEnum);
+    auto& reluctanceModel = _reluctanceModel;
     
     double currentInitialPermeability = initialPermeability.get_initial_permeability(
         tempCore.resolve_material(), temperature, std::nullopt, frequency);
@@ -8,12 +8,14 @@
 #include "constructive_models/Magnetic.h"
 #include <MAS.hpp>
 #include "constructive_models/Coil.h"
+#include "physical_models/Reluctance.h"
 #include <cmath>
 #include <filesystem>
 #include <fstream>
 #include <iostream>
 #include <map>
 #include <numbers>
+#include <optional>
 #include <streambuf>
 #include <vector>
 
@@ -21,22 +23,46 @@ using namespace MAS;
 
 namespace OpenMagnetics {
 
+// Carries the converged point of one turns or gap search into the next one.
+// Callers sweeping a neighbourhood (N, N+1, ...; one core after a re-gap) keep
+// a single instance alive across calls: the search seeds from the stored
+// solution instead of from the unbiased reluctance / the residual gap, and
+// lands on the same answer in fewer evaluations. A default-constructed state
+// is a cold start. The counters report the work done by the LAST call only.
+struct MagnetizingInductanceSolverState {
+    std::optional<int64_t> numberTurns;
+    std::optional<double> magnetizingInductance;
+    std::optional<double> gapLength;  // converged length per gap, before rounding; unset after a timed-out search
+    size_t numberInductanceEvaluations = 0;
+    size_t numberReluctanceEvaluations = 0;
+};
+
 class MagnetizingInductance {
   private:
     std::map<std::string, std::string> _models;
+    // Resolved from _models once per instance and reused by every solve.
+    ReluctanceModelHandle _reluctanceModel;
+
+    std::pair<MagnetizingInductanceOutput, SignalDescriptor> solve_inductance_and_magnetic_flux_density(
+        Core core,
+        Coil coil,
+        OperatingPoint* operatingPoint);
 
   protected:
   public:
     MagnetizingInductance() {
         _models["gapReluctance"] = to_string(Defaults().reluctanceModelDefault);
+        _reluctanceModel = ReluctanceModelHandle(_models);
     }
 
     MagnetizingInductance(ReluctanceModels model) {
         _models["gapReluctance"] = to_string(model);
+        _reluctanceModel = ReluctanceModelHandle(_models);
     }
 
     MagnetizingInductance(std::string model) {
         _models["gapReluctance"] = model;
+        _reluctanceModel = ReluctanceModelHandle(_models);
     }
     MagnetizingInductanceOutput calculate_inductance_from_number_turns_and_gapping(Core core,
                                                                                    Coil coil,
@@ -49,9 +75,11 @@ class MagnetizingInductance {
                                                                       Coil coil,
                                                                       Inputs* inputs,
                                                                       GappingType gappingType,
-                                                                      size_t decimals = 4);
+                                                                      size_t decimals = 4,
+                                                                      MagnetizingInductanceSolverState* solverState = nullptr);
 
-    int calculate_number_turns_from_gapping_and_inductance(Core core, Coil coil, Inputs* inputs, DimensionalValues preferredValue = DimensionalValues::NOMINAL);
+    int calculate_number_turns_from_gapping_and_inductance(Core core, Coil coil, Inputs* inputs, DimensionalValues preferredValue = DimensionalValues::NOMINAL,
+                                                           MagnetizingInductanceSolverState* solverState = nullptr);
 
     // Legacy 3-argument entry point (the pre-coil signature). Kept ONLY for
     // binding backward-compatibility (PyOM / WASM callers that never passed a
@@ -99,6 +127,12 @@ class MagnetizingInductance {
     static double calculate_drum_ring_magnetizing_inductance(Core core, CoreMaterial ringMaterial,
                                                              double numberTurns, double temperature);
 
+    // Memoised per thread when Settings::get_magnetizing_inductance_memo_size()
+    // is non-zero. The key covers the model, the result-affecting settings, the
+    // database generation, the core and coil descriptions and the full
+    // operating point; a hit also restores the operating point exactly as the
+    // solve would have left it (standardised waveforms, magnetizing current,
+    // induced voltage).
     std::pair<MagnetizingInductanceOutput, SignalDescriptor> calculate_inductance_and_magnetic_flux_density(
         Core core,
         Coil coil,
@@ -108,6 +142,10 @@ class MagnetizingInductance {
         Magnetic magnetic,
         OperatingPoint* operatingPoint = nullptr);
 
+    // Entries held by the calling thread's memo, and a way to drop them.
+    static size_t get_memo_size();
+    static void clear_memo();
+
     double calculate_inductance_air_solenoid(
         Magnetic magnetic);
 
@@ -918,6 +918,31 @@ std::shared_ptr<ReluctanceModel> ReluctanceModel::factory() {
     return factory(defaults.reluctanceModelDefault);
 }
 
+ReluctanceModelHandle::ReluctanceModelHandle() : ReluctanceModelHandle(defaults.reluctanceModelDefault) {}
+
+ReluctanceModelHandle::ReluctanceModelHandle(std::map<std::string, std::string> models)
+    : ReluctanceModelHandle([&models]() {
+          ReluctanceModels reluctanceModelEnum;
+          from_json(models["gapReluctance"], reluctanceModelEnum);
+          return reluctanceModelEnum;
+      }()) {}
+
+ReluctanceModelHandle::ReluctanceModelHandle(ReluctanceModels modelName) : _modelName(modelName) {
+    switch (modelName) {
+        case ReluctanceModels::ZHANG: _model.emplace<ReluctanceZhangModel>(); break;
+        case ReluctanceModels::PARTRIDGE: _model.emplace<ReluctancePartridgeModel>(); break;
+        case ReluctanceModels::EFFECTIVE_AREA: _model.emplace<ReluctanceEffectiveAreaModel>(); break;
+        case ReluctanceModels::EFFECTIVE_LENGTH: _model.emplace<ReluctanceEffectiveLengthModel>(); break;
+        case ReluctanceModels::MUEHLETHALER: _model.emplace<ReluctanceMuehlethalerModel>(); break;
+        case ReluctanceModels::STENGLEIN: _model.emplace<ReluctanceStengleinModel>(); break;
+        case ReluctanceModels::BALAKRISHNAN: _model.emplace<ReluctanceBalakrishnanModel>(); break;
+        case ReluctanceModels::CLASSIC: _model.emplace<ReluctanceClassicModel>(); break;
+        default:
+            throw ModelNotAvailableException("Unknown Reluctance mode, available options are: {ZHANG, PARTRIDGE, EFFECTIVE_AREA, "
+                                             "EFFECTIVE_LENGTH, MUEHLETHALER, STENGLEIN, BALAKRISHNAN, CLASSIC}");
+    }
+}
+
 double ReluctanceModel::get_gapping_by_fringing_factor(Core core, double fringingFactor) {
     auto centralColumns = core.find_columns_by_type(ColumnType::CENTRAL);
     if (centralColumns.size() == 0) {
@@ -13,6 +13,7 @@
 #include <map>
 #include <numbers>
 #include <streambuf>
+#include <variant>
 #include <vector>
 
 using namespace MAS;
@@ -134,7 +135,7 @@ class ReluctanceModel {
 
 // Based on Improved Calculation Method for Inductance Value of the Air-Gap Inductor by Xinsheng Zhang
 // https://sci-hub.wf/https://ieeexplore.ieee.org/document/9332553
-class ReluctanceZhangModel : public ReluctanceModel {
+class ReluctanceZhangModel final : public ReluctanceModel {
   public:
     std::string methodName = "Zhang";
     AirGapReluctanceOutput get_gap_reluctance(CoreGap gapInfo);
@@ -142,7 +143,7 @@ class ReluctanceZhangModel : public ReluctanceModel {
 
 // Based on A Novel Approach for 3D Air Gap Reluctance Calculations by Jonas Mühlethaler
 // https://www.pes-publications.ee.ethz.ch/uploads/tx_ethpublications/10_A_Novel_Approach_ECCEAsia2011_01.pdf
-class ReluctanceMuehlethalerModel : public ReluctanceModel {
+class ReluctanceMuehlethalerModel final : public ReluctanceModel {
   public:
     std::string methodName = "Muehlethaler";
     AirGapReluctanceOutput get_gap_reluctance(CoreGap gapInfo);
@@ -151,25 +152,25 @@ class ReluctanceMuehlethalerModel : public ReluctanceModel {
     double get_reluctance_type_1(double l, double w, double h);
 };
 
-class ReluctanceEffectiveAreaModel : public ReluctanceModel {
+class ReluctanceEffectiveAreaModel final : public ReluctanceModel {
   public:
     std::string methodName = "EffectiveArea";
     AirGapReluctanceOutput get_gap_reluctance(CoreGap gapInfo);
 };
 
-class ReluctanceEffectiveLengthModel : public ReluctanceModel {
+class ReluctanceEffectiveLengthModel final : public ReluctanceModel {
   public:
     std::string methodName = "EffectiveLength";
     AirGapReluctanceOutput get_gap_reluctance(CoreGap gapInfo);
 };
 
-class ReluctancePartridgeModel : public ReluctanceModel {
+class ReluctancePartridgeModel final : public ReluctanceModel {
   public:
     std::string methodName = "Partridge";
     AirGapReluctanceOutput get_gap_reluctance(CoreGap gapInfo);
 };
 
-class ReluctanceClassicModel : public ReluctanceModel {
+class ReluctanceClassicModel final : public ReluctanceModel {
   public:
     std::string methodName = "Classic";
     AirGapReluctanceOutput get_gap_reluctance(CoreGap gapInfo);
@@ -177,7 +178,7 @@ class ReluctanceClassicModel : public ReluctanceModel {
 
 // Based on Air-gap reluctance and inductance calculations for magnetic circuits using a Schwarz-Christoffel
 // transformation by A. Balakrishnan https://sci-hub.wf/https://ieeexplore.ieee.org/document/602560
-class ReluctanceBalakrishnanModel : public ReluctanceModel {
+class ReluctanceBalakrishnanModel final : public ReluctanceModel {
   public:
     std::string methodName = "Balakrishnan";
     AirGapReluctanceOutput get_gap_reluctance(CoreGap gapInfo);
@@ -185,7 +186,7 @@ class ReluctanceBalakrishnanModel : public ReluctanceModel {
 
 // Based on The Reluctance of Large Air Gaps in Ferrite Cores by Erika Stenglein
 // https://sci-hub.wf/10.1109/EPE.2016.7695271
-class ReluctanceStengleinModel : public ReluctanceModel {
+class ReluctanceStengleinModel final : public ReluctanceModel {
   public:
     std::string methodName = "Stenglein";
     AirGapReluctanceOutput get_gap_reluctance(CoreGap gapInfo);
@@ -201,4 +202,35 @@ class ReluctanceStengleinModel : public ReluctanceModel {
     }
 };
 
+// Value-semantic counterpart of ReluctanceModel::factory() for code that prices
+// many gaps or cores with one model. It is resolved once (from the enum or the
+// "gapReluctance" entry of a models map) and then reused: no heap allocation or
+// shared_ptr per request, and get_gap_reluctance() goes through std::visit to
+// the concrete (final) model, so the call is direct and can be inlined. The
+// rest of the ReluctanceModel interface is reached through operator->.
+class ReluctanceModelHandle {
+  public:
+    using Model = std::variant<ReluctanceZhangModel, ReluctancePartridgeModel, ReluctanceEffectiveAreaModel,
+                               ReluctanceEffectiveLengthModel, ReluctanceMuehlethalerModel, ReluctanceStengleinModel,
+                               ReluctanceBalakrishnanModel, ReluctanceClassicModel>;
+
+    ReluctanceModelHandle();
+    explicit ReluctanceModelHandle(ReluctanceModels modelName);
+    explicit ReluctanceModelHandle(std::map<std::string, std::string> models);
+
+    AirGapReluctanceOutput get_gap_reluctance(const CoreGap& gapInfo) {
+        return std::visit([&gapInfo](auto& model) { return model.get_gap_reluctance(gapInfo); }, _model);
+    }
+
+    ReluctanceModel* operator->() {
+        return std::visit([](auto& model) -> ReluctanceModel* { return &model; }, _model);
+    }
+    ReluctanceModel& get() { return *operator->(); }
+    ReluctanceModels get_model_name() const { return _modelName; }
+
+  private:
+    ReluctanceModels _modelName;
+    Model _model;
+};
+
 } // namespace OpenMagnetics
\ No newline at end of file
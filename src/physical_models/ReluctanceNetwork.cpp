@@ -71,6 +71,7 @@ ReluctanceNetwork::ReluctanceNetwork(Core core, double ungappedCoreReluctance, s
         std::vector<double> savedColumnReluctances = _columnReluctances;
         _columnReluctances = relativeLegReluctances;
         _yokeSegmentReluctances = relativeYokeReluctances;
+        factorize_mesh();
         std::vector<double> unitMagnetomotiveForce(columns.size(), 0);
         unitMagnetomotiveForce[_mainColumnIndex] = 1.0;
         double relativeDrivingReluctance = 1.0 / solve_column_fluxes_for_magnetomotive_forces(unitMagnetomotiveForce)[_mainColumnIndex];
@@ -104,6 +105,7 @@ ReluctanceNetwork::ReluctanceNetwork(Core core, double ungappedCoreReluctance, s
         auto columnIndex = _core.find_closest_column_index_by_coordinates(gapping[gapIndex].get_coordinates().value());
         _columnReluctances[static_cast<size_t>(columnIndex)] += reluctancePerGap[gapIndex].get_reluctance();
     }
+    factorize_mesh();
 }
 
 // Placement precedence mirrors the winder: winding-level windingWindow wins,
@@ -230,10 +232,13 @@ bool ReluctanceNetwork::has_non_main_placement(Magnetic magnetic) {
     return false;
 }
 
-std::vector<double> ReluctanceNetwork::solve_column_fluxes_for_magnetomotive_forces(const std::vector<double>& columnMagnetomotiveForces) const {
+void ReluctanceNetwork::factorize_mesh() {
     size_t numberColumns = _columnReluctances.size();
-    if (numberColumns == 1) {
-        return {columnMagnetomotiveForces[0] / _columnReluctances[0]};
+    _meshUpper.clear();
+    _meshMultipliers.clear();
+    _meshPivotRows.clear();
+    if (numberColumns <= 1) {
+        return;
     }
 
     // Mesh analysis over the leg chain (legs x-ordered, all oriented the same way):
@@ -242,82 +247,119 @@ std::vector<double> ReluctanceNetwork::solve_column_fluxes_for_magnetomotive_for
     // rhs[k] = MMF_k − MMF_{k+1}; leg flux = φ_k − φ_{k−1}.
     size_t numberLoops = numberColumns - 1;
     std::vector<double> orderedLegReluctances(numberColumns);
-    std::vector<double> orderedMagnetomotiveForces(numberColumns);
     for (size_t position = 0; position < numberColumns; ++position) {
         orderedLegReluctances[position] = _columnReluctances[_orderedColumnIndexes[position]];
-        orderedMagnetomotiveForces[position] = columnMagnetomotiveForces[_orderedColumnIndexes[position]];
     }
 
-    std::vector<std::vector<double>> meshMatrix(numberLoops, std::vector<double>(numberLoops, 0));
-    std::vector<double> rightHandSide(numberLoops, 0);
+    _meshUpper.assign(numberLoops, std::vector<double>(numberLoops, 0));
     for (size_t loopIndex = 0; loopIndex < numberLoops; ++loopIndex) {
-        meshMatrix[loopIndex][loopIndex] = orderedLegReluctances[loopIndex] + orderedLegReluctances[loopIndex + 1] +
+        _meshUpper[loopIndex][loopIndex] = orderedLegReluctances[loopIndex] + orderedLegReluctances[loopIndex + 1] +
                                            _yokeSegmentReluctances[loopIndex];
         if (loopIndex > 0) {
-            meshMatrix[loopIndex][loopIndex - 1] = -orderedLegReluctances[loopIndex];
+            _meshUpper[loopIndex][loopIndex - 1] = -orderedLegReluctances[loopIndex];
         }
         if (loopIndex + 1 < numberLoops) {
-            meshMatrix[loopIndex][loopIndex + 1] = -orderedLegReluctances[loopIndex + 1];
+            _meshUpper[loopIndex][loopIndex + 1] = -orderedLegReluctances[loopIndex + 1];
         }
-        rightHandSide[loopIndex] = orderedMagnetomotiveForces[loopIndex] - orderedMagnetomotiveForces[loopIndex + 1];
     }
 
-    // Gaussian elimination with partial pivoting (the system is tiny: n-1 loops).
-    std::vector<double> loopFluxes(numberLoops, 0);
+    // Gaussian elimination with partial pivoting (the system is tiny: n-1 loops),
+    // recording the row swaps and multipliers so that every right-hand side later
+    // replays exactly the arithmetic of a one-shot elimination.
+    _meshMultipliers.assign(numberLoops, std::vector<double>(numberLoops, 0));
+    _meshPivotRows.assign(numberLoops, 0);
     for (size_t pivotIndex = 0; pivotIndex < numberLoops; ++pivotIndex) {
         size_t bestRow = pivotIndex;
         for (size_t row = pivotIndex + 1; row < numberLoops; ++row) {
-            if (std::abs(meshMatrix[row][pivotIndex]) > std::abs(meshMatrix[bestRow][pivotIndex])) {
+            if (std::abs(_meshUpper[row][pivotIndex]) > std::abs(_meshUpper[bestRow][pivotIndex])) {
                 bestRow = row;
             }
         }
-        std::swap(meshMatrix[pivotIndex], meshMatrix[bestRow]);
-        std::swap(rightHandSide[pivotIndex], rightHandSide[bestRow]);
-        if (meshMatrix[pivotIndex][pivotIndex] == 0) {
+        std::swap(_meshUpper[pivotIndex], _meshUpper[bestRow]);
+        _meshPivotRows[pivotIndex] = bestRow;
+        if (_meshUpper[pivotIndex][pivotIndex] == 0) {
             throw CalculationException(ErrorCode::CALCULATION_INVALID_RESULT, "Singular reluctance network");
         }
         for (size_t row = pivotIndex + 1; row < numberLoops; ++row) {
-            double factor = meshMatrix[row][pivotIndex] / meshMatrix[pivotIndex][pivotIndex];
+            double factor = _meshUpper[row][pivotIndex] / _meshUpper[pivotIndex][pivotIndex];
             for (size_t column = pivotIndex; column < numberLoops; ++column) {
-                meshMatrix[row][column] -= factor * meshMatrix[pivotIndex][column];
+                _meshUpper[row][column] -= factor * _meshUpper[pivotIndex][column];
             }
-            rightHandSide[row] -= factor * rightHandSide[pivotIndex];
+            _meshMultipliers[row][pivotIndex] = factor;
         }
     }
-    for (size_t rowPlusOne = numberLoops; rowPlusOne > 0; --rowPlusOne) {
-        size_t row = rowPlusOne - 1;
-        double accumulated = rightHandSide[row];
-        for (size_t column = row + 1; column < numberLoops; ++column) {
-            accumulated -= meshMatrix[row][column] * loopFluxes[column];
+}
+
+std::vector<double> ReluctanceNetwork::solve_column_fluxes_for_magnetomotive_forces(const std::vector<double>& columnMagnetomotiveForces) const {
+    return solve_column_fluxes_for_magnetomotive_forces(std::vector<std::vector<double>>{columnMagnetomotiveForces})[0];
+}
+
+std::vector<std::vector<double>> ReluctanceNetwork::solve_column_fluxes_for_magnetomotive_forces(const std::vector<std::vector<double>>& columnMagnetomotiveForcesPerCase) const {
+    size_t numberColumns = _columnReluctances.size();
+    std::vector<std::vector<double>> columnFluxesPerCase(columnMagnetomotiveForcesPerCase.size(), std::vector<double>(numberColumns, 0));
+    if (numberColumns == 1) {
+        for (size_t caseIndex = 0; caseIndex < columnMagnetomotiveForcesPerCase.size(); ++caseIndex) {
+            columnFluxesPerCase[caseIndex][0] = columnMagnetomotiveForcesPerCase[caseIndex][0] / _columnReluctances[0];
         }
-        loopFluxes[row] = accumulated / meshMatrix[row][row];
+        return columnFluxesPerCase;
     }
 
-    std::vector<double> columnFluxes(numberColumns, 0);
-    for (size_t position = 0; position < numberColumns; ++position) {
-        double flux = 0;
-        if (position < numberLoops) {
-            flux += loopFluxes[position];
+    // Back-substitution against the factors of factorize_mesh(), one right-hand
+    // side per case.
+    size_t numberLoops = numberColumns - 1;
+    std::vector<double> rightHandSide(numberLoops);
+    std::vector<double> loopFluxes(numberLoops);
+    for (size_t caseIndex = 0; caseIndex < columnMagnetomotiveForcesPerCase.size(); ++caseIndex) {
+        auto& columnMagnetomotiveForces = columnMagnetomotiveForcesPerCase[caseIndex];
+        for (size_t loopIndex = 0; loopIndex < numberLoops; ++loopIndex) {
+            rightHandSide[loopIndex] = columnMagnetomotiveForces[_orderedColumnIndexes[loopIndex]] -
+                                       columnMagnetomotiveForces[_orderedColumnIndexes[loopIndex + 1]];
         }
-        if (position > 0) {
-            flux -= loopFluxes[position - 1];
+        for (size_t pivotIndex = 0; pivotIndex < numberLoops; ++pivotIndex) {
+            std::swap(rightHandSide[pivotIndex], rightHandSide[_meshPivotRows[pivotIndex]]);
+            for (size_t row = pivotIndex + 1; row < numberLoops; ++row) {
+                rightHandSide[row] -= _meshMultipliers[row][pivotIndex] * rightHandSide[pivotIndex];
+            }
+        }
+        for (size_t rowPlusOne = numberLoops; rowPlusOne > 0; --rowPlusOne) {
+            size_t row = rowPlusOne - 1;
+            double accumulated = rightHandSide[row];
+            for (size_t column = row + 1; column < numberLoops; ++column) {
+                accumulated -= _meshUpper[row][column] * loopFluxes[column];
+            }
+            loopFluxes[row] = accumulated / _meshUpper[row][row];
+        }
+
+        auto& columnFluxes = columnFluxesPerCase[caseIndex];
+        for (size_t position = 0; position < numberColumns; ++position) {
+            double flux = 0;
+            if (position < numberLoops) {
+                flux += loopFluxes[position];
+            }
+            if (position > 0) {
+                flux -= loopFluxes[position - 1];
+            }
+            columnFluxes[_orderedColumnIndexes[position]] = flux;
         }
-        columnFluxes[_orderedColumnIndexes[position]] = flux;
     }
-    return columnFluxes;
+    return columnFluxesPerCase;
 }
 
 std::vector<std::vector<double>> ReluctanceNetwork::calculate_magnetizing_inductance_matrix(Magnetic magnetic) const {
     auto columnIndexPerWinding = resolve_winding_column_indexes(magnetic);
     auto windings = magnetic.get_coil().get_functional_description();
 
+    // One right-hand side per driven winding, solved as a single batch.
+    std::vector<std::vector<double>> columnMagnetomotiveForcesPerWinding(windings.size(), std::vector<double>(_columnReluctances.size(), 0));
+    for (size_t j = 0; j < windings.size(); ++j) {
+        columnMagnetomotiveForcesPerWinding[j][columnIndexPerWinding[j]] = static_cast<double>(windings[j].get_number_turns());
+    }
+    auto columnFluxesPerWinding = solve_column_fluxes_for_magnetomotive_forces(columnMagnetomotiveForcesPerWinding);
+
     std::vector<std::vector<double>> inductanceMatrix(windings.size(), std::vector<double>(windings.size(), 0));
     for (size_t j = 0; j < windings.size(); ++j) {
-        std::vector<double> columnMagnetomotiveForces(_columnReluctances.size(), 0);
-        columnMagnetomotiveForces[columnIndexPerWinding[j]] = static_cast<double>(windings[j].get_number_turns());
-        auto columnFluxes = solve_column_fluxes_for_magnetomotive_forces(columnMagnetomotiveForces);
         for (size_t i = 0; i < windings.size(); ++i) {
-            inductanceMatrix[i][j] = static_cast<double>(windings[i].get_number_turns()) * columnFluxes[columnIndexPerWinding[i]];
+            inductanceMatrix[i][j] = static_cast<double>(windings[i].get_number_turns()) * columnFluxesPerWinding[j][columnIndexPerWinding[i]];
         }
     }
     return inductanceMatrix;
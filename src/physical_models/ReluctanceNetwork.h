@@ -41,9 +41,20 @@ class ReluctanceNetwork {
     std::vector<size_t> _orderedColumnIndexes;
     size_t _mainColumnIndex = 0;
 
+    // Pivoted elimination of the leg-chain mesh matrix, computed once per network
+    // (the reluctances are fixed at construction): upper factor, multipliers and
+    // the pivot row chosen at each step.
+    std::vector<std::vector<double>> _meshUpper;
+    std::vector<std::vector<double>> _meshMultipliers;
+    std::vector<size_t> _meshPivotRows;
+
+    void factorize_mesh();
+
     // Mesh solve of the leg chain: per-ORIGINAL-column-index magnetomotive forces in,
     // per-original-column-index fluxes out (positive along the common leg direction).
+    // The batched form reuses the factorization for every right-hand side.
     std::vector<double> solve_column_fluxes_for_magnetomotive_forces(const std::vector<double>& columnMagnetomotiveForces) const;
+    std::vector<std::vector<double>> solve_column_fluxes_for_magnetomotive_forces(const std::vector<std::vector<double>>& columnMagnetomotiveForcesPerCase) const;
 
   public:
     /**
@@ -54,4 +54,17 @@ std::shared_ptr<ResistivityModel> ResistivityModel::factory(ResistivityModels mo
     else
         throw ModelNotAvailableException("Unknown Resistivity model, available options are: {CORE_MATERIAL, WIRE_MATERIAL}");
 }
+
+const std::shared_ptr<ResistivityModel>& ResistivityModel::get_shared(ResistivityModels modelName) {
+    static const std::shared_ptr<ResistivityModel> coreMaterialModel = factory(ResistivityModels::CORE_MATERIAL);
+    static const std::shared_ptr<ResistivityModel> wireMaterialModel = factory(ResistivityModels::WIRE_MATERIAL);
+    if (modelName == ResistivityModels::CORE_MATERIAL) {
+        return coreMaterialModel;
+    }
+    else if (modelName == ResistivityModels::WIRE_MATERIAL) {
+        return wireMaterialModel;
+    }
+    else
+        throw ModelNotAvailableException("Unknown Resistivity model, available options are: {CORE_MATERIAL, WIRE_MATERIAL}");
+}
 } // namespace OpenMagnetics
@@ -30,6 +30,9 @@ class ResistivityModel {
     virtual ~ResistivityModel() = default;
     virtual double get_resistivity(ResistivityMaterial materialData, double temperature) = 0;
     static std::shared_ptr<ResistivityModel> factory(ResistivityModels modelName);
+    // The models are stateless: one instance per model serves every caller
+    // and thread, so hot paths skip the factory's allocation.
+    static const std::shared_ptr<ResistivityModel>& get_shared(ResistivityModels modelName);
 };
 
 class ResistivityCoreMaterialModel : public ResistivityModel {
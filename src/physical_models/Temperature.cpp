@@ -4,6 +4,7 @@
 #include "StrayCapacitance.h"
 #include "support/Painter.h"
 #include "support/Utils.h"
+#include "support/WorkCounters.h"
 #include "Constants.h"
 #include <filesystem>
 #include <fstream>
@@ -79,6 +80,37 @@ public:
         return x;
     }
 };
+
+// Total loss of every turn (ohmic + skin + proximity, all harmonics), in the
+// order of the coil's turns description. Empty when the output carries no
+// per-turn breakdown.
+std::vector<double> losses_per_turn(const WindingLossesOutput& windingLossesOutput) {
+    std::vector<double> turnLosses;
+    auto lossesPerTurn = windingLossesOutput.get_winding_losses_per_turn();
+    if (!lossesPerTurn) {
+        return turnLosses;
+    }
+    for (const auto& elem : *lossesPerTurn) {
+        double loss = 0.0;
+        if (elem.get_ohmic_losses()) {
+            loss += elem.get_ohmic_losses()->get_losses();
+        }
+        if (elem.get_skin_effect_losses()) {
+            auto harmonics = elem.get_skin_effect_losses()->get_losses_per_harmonic();
+            for (double h : harmonics) {
+                loss += h;
+            }
+        }
+        if (elem.get_proximity_effect_losses()) {
+            auto harmonics = elem.get_proximity_effect_losses()->get_losses_per_harmonic();
+            for (double h : harmonics) {
+                loss += h;
+            }
+        }
+        turnLosses.push_back(loss);
+    }
+    return turnLosses;
+}
 } // anonymous namespace
 
 // ============================================================================
@@ -250,6 +282,7 @@ double Temperature::getBobbinThermalConductivity() const {
 // ============================================================================
 
 ThermalResult Temperature::calculateTemperatures() {
+    count_work(WorkCounter::TEMPERATURE_SOLVE);
     if (THERMAL_DEBUG) {
     }
     
@@ -260,6 +293,11 @@ ThermalResult Temperature::calculateTemperatures() {
 
     // Step 2: Create thermal nodes (core, turns, bobbin)
     createThermalNodes();
+    _networkCoreLosses = _config.coreLosses;
+    _networkTurnLosses.clear();
+    if (!_config.coreOnly && _config.windingLossesOutput) {
+        _networkTurnLosses = losses_per_turn(_config.windingLossesOutput.value());
+    }
 
     // Step 3: Create thermal resistances between nodes
     createThermalResistances();
@@ -1444,29 +1482,8 @@ void Temperature::createTurnNodes() {
     bool hasPerTurnLosses = false;
     
     if (_config.windingLossesOutput) {
-        auto lossesPerTurn = _config.windingLossesOutput->get_winding_losses_per_turn();
-        if (lossesPerTurn && !lossesPerTurn->empty()) {
-            hasPerTurnLosses = true;
-            for (const auto& elem : *lossesPerTurn) {
-                double loss = 0.0;
-                if (elem.get_ohmic_losses()) {
-                    loss += elem.get_ohmic_losses()->get_losses();
-                }
-                if (elem.get_skin_effect_losses()) {
-                    auto harmonics = elem.get_skin_effect_losses()->get_losses_per_harmonic();
-                    for (double h : harmonics) {
-                        loss += h;
-                    }
-                }
-                if (elem.get_proximity_effect_losses()) {
-                    auto harmonics = elem.get_proximity_effect_losses()->get_losses_per_harmonic();
-                    for (double h : harmonics) {
-                        loss += h;
-                    }
-                }
-                turnLosses.push_back(loss);
-            }
-        }
+        turnLosses = losses_per_turn(_config.windingLossesOutput.value());
+        hasPerTurnLosses = !turnLosses.empty();
     } else if (_config.windingLosses <= 0.0) {
         // When total winding losses are zero, all turns have zero losses
         // No windingLossesOutput needed - this is an explicit zero, not a fallback
@@ -4993,7 +5010,82 @@ void Temperature::recalculateConvectionResistances(const std::vector<double>& te
     }
 }
 
-ThermalResult Temperature::solveThermalCircuit() {
+ThermalResult Temperature::recalculateTemperatures(double coreLosses,
+                                                   const std::optional<WindingLossesOutput>& windingLossesOutput,
+                                                   double windingLossesScale) {
+    _config.coreLosses = coreLosses;
+    _config.windingLossesOutput = windingLossesOutput;
+    if (_nodes.empty()) {
+        return calculateTemperatures();
+    }
+
+    std::vector<double> turnLosses;
+    if (!_config.coreOnly && windingLossesOutput) {
+        turnLosses = losses_per_turn(windingLossesOutput.value());
+        for (auto& loss : turnLosses) {
+            loss *= windingLossesScale;
+        }
+    }
+
+    // Map each turn node back to its position in the turns description, the
+    // same (winding, index-within-winding) numbering createTurnNodes() uses.
+    std::map<std::pair<size_t, size_t>, size_t> turnPositions;
+    if (!_config.coreOnly) {
+        auto coil = _magnetic.get_coil();
+        auto turns = coil.get_turns_description();
+        if (!turns || turns->size() != turnLosses.size() || turnLosses.size() != _networkTurnLosses.size()) {
+            return calculateTemperatures();
+        }
+        std::map<size_t, size_t> windingTurnCounter;
+        for (size_t t = 0; t < turns->size(); ++t) {
+            size_t windingIndex = coil.get_winding_index_by_name((*turns)[t].get_winding());
+            turnPositions[{windingIndex, windingTurnCounter[windingIndex]++}] = t;
+        }
+    }
+
+    // Every non-turn node's power is a share of the core losses; every turn
+    // node's a share of its turn's losses. Rescale in place, or rebuild when a
+    // share cannot be recovered (its reference loss was zero). Factors are
+    // collected first so a rebuild never starts from half-scaled nodes.
+    if (_networkCoreLosses == 0 && coreLosses != 0) {
+        return calculateTemperatures();
+    }
+    std::vector<double> factors(_nodes.size(), 1.0);
+    for (size_t i = 0; i < _nodes.size(); ++i) {
+        const auto& node = _nodes[i];
+        if (node.part == ThermalNodePartType::AMBIENT || node.isFixedTemperature) {
+            continue;
+        }
+        if (node.part == ThermalNodePartType::TURN) {
+            if (!node.windingIndex || !node.turnIndex) {
+                return calculateTemperatures();
+            }
+            auto it = turnPositions.find({node.windingIndex.value(), node.turnIndex.value()});
+            if (it == turnPositions.end()) {
+                return calculateTemperatures();
+            }
+            double previousLoss = _networkTurnLosses[it->second];
+            if (previousLoss > 0) {
+                factors[i] = turnLosses[it->second] / previousLoss;
+            }
+            else if (turnLosses[it->second] != 0) {
+                return calculateTemperatures();
+            }
+        }
+        else if (node.powerDissipation != 0) {
+            factors[i] = coreLosses / _networkCoreLosses;
+        }
+    }
+    for (size_t i = 0; i < _nodes.size(); ++i) {
+        _nodes[i].powerDissipation *= factors[i];
+    }
+    _networkCoreLosses = coreLosses;
+    _networkTurnLosses = turnLosses;
+
+    return solveThermalCircuit(true);
+}
+
+ThermalResult Temperature::solveThermalCircuit(bool warmStart) {
     size_t n = _nodes.size();
     if (n == 0) {
         throw std::runtime_error("Temperature::solveThermalCircuit: Thermal network has zero nodes. "
@@ -5010,6 +5102,11 @@ ThermalResult Temperature::solveThermalCircuit() {
     }
     
     std::vector<double> temperatures(n, _config.ambientTemperature);
+    if (warmStart) {
+        for (size_t i = 0; i < n; ++i) {
+            temperatures[i] = _nodes[i].temperature;
+        }
+    }
     std::vector<double> powerInputs(n, 0.0);
     
     for (size_t i = 0; i < n; ++i) {
@@ -5022,7 +5119,7 @@ ThermalResult Temperature::solveThermalCircuit() {
     
     while (iteration < _config.maxIterations && !converged) {
         // IMP-5
-        if (iteration > 0) { recalculateConvectionResistances(temperatures); }
+        if (iteration > 0 || warmStart) { recalculateConvectionResistances(temperatures); }
 
         SimpleMatrix G(n, n, 0.0);
 
@@ -5270,6 +5367,7 @@ ThermalResult Temperature::solveThermalCircuit() {
     
     double coreTempSum = 0.0;
     size_t coreCount = 0;
+    double coreTempMax = _config.ambientTemperature;
     double coilTempSum = 0.0;
     size_t coilCount = 0;
     
@@ -5280,6 +5378,7 @@ ThermalResult Temperature::solveThermalCircuit() {
             _nodes[i].part == ThermalNodePartType::CORE_TOP_YOKE ||
             _nodes[i].part == ThermalNodePartType::CORE_BOTTOM_YOKE) {
             coreTempSum += temperatures[i];
+            coreTempMax = coreCount == 0 ? temperatures[i] : std::max(coreTempMax, temperatures[i]);
             coreCount++;
         } else if (_nodes[i].part == ThermalNodePartType::TURN) {
             coilTempSum += temperatures[i];
@@ -5288,6 +5387,7 @@ ThermalResult Temperature::solveThermalCircuit() {
     }
     
     result.averageCoreTemperature = coreCount > 0 ? coreTempSum / coreCount : _config.ambientTemperature;
+    result.maximumCoreTemperature = coreTempMax;
     result.averageCoilTemperature = coilCount > 0 ? coilTempSum / coilCount : _config.ambientTemperature;
     result.methodUsed = "Quadrant-based Thermal Equivalent Circuit";
     
@@ -201,6 +201,7 @@ struct ThermalResult {
     std::string methodUsed;
     double maximumTemperature;
     double averageCoreTemperature;
+    double maximumCoreTemperature;  // hottest core node; ambient when the network has none
     double averageCoilTemperature;
     std::map<std::string, double> nodeTemperatures;
     double totalThermalResistance;
@@ -333,6 +334,11 @@ private:
         std::optional<InsulationWireCoating> wireCoating;
     };
     std::map<size_t, WindingWireProperties> _perWindingWireProps;
+
+    // Losses the current node powers were built from, so recalculateTemperatures()
+    // can rescale them instead of rebuilding the network.
+    double _networkCoreLosses = 0.0;
+    std::vector<double> _networkTurnLosses;
     
     double getMinimumDistanceForConduction() const {
         // Threshold for conduction: accounts for actual gap between surfaces
@@ -374,6 +380,24 @@ public:
      * @return Temperature calculation result
      */
     ThermalResult calculateTemperatures();
+
+    /**
+     * @brief Re-solve the assembled network for new losses (coupled thermal-EM loops).
+     *
+     * The nodes and resistances depend only on geometry, so after a first
+     * calculateTemperatures() they are reused as-is: core node powers are
+     * rescaled to `coreLosses`, turn node powers to the per-turn losses of
+     * `windingLossesOutput` times `windingLossesScale`, and the solver starts
+     * from the previous solution instead of ambient. Rebuilds from scratch
+     * when nothing was built yet or a node had no loss to rescale.
+     *
+     * @param coreLosses Total core losses in W
+     * @param windingLossesOutput Per-turn winding losses (ignored in coreOnly mode)
+     * @param windingLossesScale Factor applied to every per-turn loss (e.g. a resistivity ratio)
+     */
+    ThermalResult recalculateTemperatures(double coreLosses,
+                                          const std::optional<WindingLossesOutput>& windingLossesOutput,
+                                          double windingLossesScale = 1.0);
     
     /**
      * @brief Get the list of thermal nodes
@@ -714,7 +738,9 @@ private:
     void recalculateConvectionResistances(const std::vector<double>& temperatures); // IMP-5
     void calculateSchematicScaling();
     void plotSchematic();
-    ThermalResult solveThermalCircuit();
+    // warmStart: start from the current node temperatures (and their
+    // convection coefficients) instead of ambient.
+    ThermalResult solveThermalCircuit(bool warmStart = false);
     
     bool hasBobbinNodes() const;
     
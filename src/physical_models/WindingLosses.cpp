@@ -4,6 +4,7 @@
 #include "MAS.hpp"
 #include "physical_models/MagnetizingInductance.h"
 #include "support/Exceptions.h"
+#include "support/WorkCounters.h"
 
 namespace OpenMagnetics {
 
@@ -167,6 +168,7 @@ double WindingLosses::calculate_effective_resistance_of_winding(Magnetic magneti
 
 
 WindingLossesOutput WindingLosses::calculate_losses(Magnetic magnetic, OperatingPoint operatingPoint, double temperature) {
+    count_work(WorkCounter::WINDING_LOSSES_EVALUATION);
     auto& settings = OpenMagnetics::Settings::GetInstance();
 
     // Normalise under-specified excitations the same way core losses does
@@ -282,7 +282,7 @@ WindingLossesOutput WindingLossesPeec2D::calculate_losses(Magnetic magnetic, Ope
     }
 
     // ---- Resistivity and skin depth bounds. ----
-    auto resistivityModel = ResistivityModel::factory(ResistivityModels::WIRE_MATERIAL);
+    auto& resistivityModel = ResistivityModel::get_shared(ResistivityModels::WIRE_MATERIAL);
     double highestFrequency = 0;
     for (auto harmonicIndex : commonHarmonicIndexes) {
         double frequency = primaryHarmonics.get_frequencies()[harmonicIndex];
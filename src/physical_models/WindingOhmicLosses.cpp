@@ -155,7 +155,7 @@ double WindingOhmicLosses::calculate_dc_resistance_per_meter(Wire wire, double t
 
     WireMaterial wireMaterial = wire.resolve_material();
 
-    auto resistivityModel = ResistivityModel::factory(ResistivityModels::WIRE_MATERIAL);
+    auto& resistivityModel = ResistivityModel::get_shared(ResistivityModels::WIRE_MATERIAL);
     auto resistivity = (*resistivityModel).get_resistivity(wireMaterial, temperature);
 
     double wireConductingArea = wire.calculate_conducting_area();
@@ -174,7 +174,7 @@ double WindingOhmicLosses::calculate_dc_resistance_per_meter(Wire wire, double t
 double WindingOhmicLosses::calculate_effective_resistance_per_meter(Wire wire, double frequency, double temperature) {
     WireMaterial wireMaterial = wire.resolve_material();
 
-    auto resistivityModel = ResistivityModel::factory(ResistivityModels::WIRE_MATERIAL);
+    auto& resistivityModel = ResistivityModel::get_shared(ResistivityModels::WIRE_MATERIAL);
     auto resistivity = (*resistivityModel).get_resistivity(wireMaterial, temperature);
 
     double wireEffectiveConductingArea = wire.calculate_effective_conducting_area(frequency, temperature);
@@ -2,6 +2,7 @@
 #include "WindingProximityEffectLosses.h"
 #include "physical_models/WindingOhmicLosses.h"
 #include "physical_models/Resistivity.h"
+#include "support/BesselKernels.h"
 #include "Defaults.h"
 
 #include <algorithm>
@@ -21,16 +22,8 @@ namespace OpenMagnetics {
 
 
 // PERF-003: Cached ResistivityModel to avoid repeated factory() calls
-inline std::shared_ptr<ResistivityModel>& get_cached_resistivity_model() {
-    static std::shared_ptr<ResistivityModel> m = ResistivityModel::factory(ResistivityModels::WIRE_MATERIAL);
-    return m;
-}
-// PERF-002: Composite hash to avoid collisions when wire has no name
-inline std::size_t hash_combine_wire(int64_t n, double w, double h) {
-    std::size_t seed = std::hash<int64_t>{}(n);
-    seed ^= std::hash<double>{}(w) + 0x9e3779b9 + (seed << 6) + (seed >> 2);
-    seed ^= std::hash<double>{}(h) + 0x9e3779b9 + (seed << 6) + (seed >> 2);
-    return seed;
+inline const std::shared_ptr<ResistivityModel>& get_cached_resistivity_model() {
+    return ResistivityModel::get_shared(ResistivityModels::WIRE_MATERIAL);
 }
 
 std::shared_ptr<WindingProximityEffectLossesModel>  WindingProximityEffectLossesModel::factory(WindingProximityEffectLossesModels modelName){
@@ -108,16 +101,7 @@ std::shared_ptr<WindingProximityEffectLossesModel> WindingProximityEffectLosses:
 }
 
 std::optional<double> WindingProximityEffectLossesModel::try_get_proximity_factor(Wire wire, double frequency, double temperature) {
-    if (!wire.get_number_conductors()) {
-        wire.set_number_conductors(1);
-    }
-    std::size_t hash;
-    if (!wire.get_name()) {
-        hash = hash_combine_wire(wire.get_number_conductors().value(), wire.get_maximum_outer_width(), wire.get_maximum_outer_height());
-    }
-    else {
-        hash = std::hash<std::string>{}(wire.get_name().value());
-    }
+    auto hash = WireFrequencyResponseTable::get_wire_key(wire);
 
     if (_proximityFactorPerWirePerFrequencyPerTemperature.contains(hash)) {
         if (_proximityFactorPerWirePerFrequencyPerTemperature[hash].contains(frequency)) {
@@ -131,21 +115,27 @@ std::optional<double> WindingProximityEffectLossesModel::try_get_proximity_facto
 }
 
 void WindingProximityEffectLossesModel::set_proximity_factor(Wire wire,  double frequency, double temperature, double proximityFactor) {
-    if (!wire.get_number_conductors()) {
-        wire.set_number_conductors(1);
-    }
-    std::size_t hash;
-    if (!wire.get_name()) {
-        hash = hash_combine_wire(wire.get_number_conductors().value(), wire.get_maximum_outer_width(), wire.get_maximum_outer_height());
-    }
-    else {
-        hash = std::hash<std::string>{}(wire.get_name().value());
-    }
+    auto hash = WireFrequencyResponseTable::get_wire_key(wire);
 
     _proximityFactorPerWirePerFrequencyPerTemperature[hash][frequency][temperature] = proximityFactor;
 
 }
 
+double WindingProximityEffectLossesModel::get_proximity_factor(Wire wire, double frequency, double temperature, const WireFrequencyResponseTable::ExactResponse& calculateProximityFactor) {
+    if (settings.get_winding_losses_tabulated()) {
+        auto hash = WireFrequencyResponseTable::get_wire_key(wire);
+        return _proximityFactorTable.get(hash, frequency, temperature, calculateProximityFactor);
+    }
+
+    auto optionalProximityFactor = try_get_proximity_factor(wire, frequency, temperature);
+    if (optionalProximityFactor) {
+        return optionalProximityFactor.value();
+    }
+    double proximityFactor = calculateProximityFactor(frequency, temperature);
+    set_proximity_factor(wire, frequency, temperature, proximityFactor);
+    return proximityFactor;
+}
+
 std::pair<double, std::vector<std::pair<double, double>>> WindingProximityEffectLosses::calculate_proximity_effect_losses_per_meter(Wire wire, double temperature, std::vector<ComplexField> fields, std::optional<WindingProximityEffectLossesModels> modelOverride) {
     auto model = get_model(wire.get_type(), modelOverride);
     if (!wire.get_number_conductors()) {
@@ -404,16 +394,9 @@ double WindingProximityEffectLossesRossmanithModel::calculate_proximity_factor(W
 }
 
 double WindingProximityEffectLossesRossmanithModel::calculate_turn_losses(Wire wire, double frequency, std::vector<ComplexFieldPoint> data, double temperature) {
-    double proximityFactor;
-    auto optionalproximityFactor = try_get_proximity_factor(wire, frequency, temperature);
-
-    if (optionalproximityFactor) {
-        proximityFactor = optionalproximityFactor.value();
-    }
-    else {
-        proximityFactor = calculate_proximity_factor(wire, frequency, temperature);
-        set_proximity_factor(wire, frequency, temperature, proximityFactor);
-    }
+    double proximityFactor = get_proximity_factor(wire, frequency, temperature, [&](double nodeFrequency, double nodeTemperature) {
+        return calculate_proximity_factor(wire, nodeFrequency, nodeTemperature);
+    });
 
     auto& resistivityModel = get_cached_resistivity_model(); // PERF-003: cached
     auto resistivity = (*resistivityModel).get_resistivity(wire.resolve_material(), temperature);
@@ -749,7 +732,9 @@ double WindingProximityEffectLossesFerreiraModel::calculate_proximity_factor(Wir
         // Eq. A8: G = -2*PI*gamma * [...] — the pi was missing, underestimating
         // round/litz proximity losses by exactly pi (numerically verified against
         // the modified-Bessel form 2*pi*rho*Re[alpha*I1(alpha)/I0(alpha)])
-        factor = - 2 * std::numbers::pi * gamma * resistivity * (kelvin_function_real(2, gamma) * derivative_kelvin_function_real(0, gamma) + kelvin_function_imaginary(2, gamma) * derivative_kelvin_function_imaginary(0, gamma)) / (pow(kelvin_function_real(0, gamma), 2) + pow(kelvin_function_imaginary(0, gamma), 2));
+        auto kelvinOrder0 = kelvin_functions(0, gamma);
+        auto kelvinOrder2 = kelvin_functions(2, gamma);
+        factor = - 2 * std::numbers::pi * gamma * resistivity * (kelvinOrder2.ber * kelvinOrder0.derivativeBer + kelvinOrder2.bei * kelvinOrder0.derivativeBei) / (pow(kelvinOrder0.ber, 2) + pow(kelvinOrder0.bei, 2));
 
 
     }
@@ -761,16 +746,9 @@ double WindingProximityEffectLossesFerreiraModel::calculate_proximity_factor(Wir
 }
 
 double WindingProximityEffectLossesFerreiraModel::calculate_turn_losses(Wire wire, double frequency, std::vector<ComplexFieldPoint> data, double temperature) {
-    double proximityFactor;
-    auto optionalproximityFactor = try_get_proximity_factor(wire, frequency, temperature);
-
-    if (optionalproximityFactor) {
-        proximityFactor = optionalproximityFactor.value();
-    }
-    else {
-        proximityFactor = calculate_proximity_factor(wire, frequency, temperature);
-        set_proximity_factor(wire, frequency, temperature, proximityFactor);
-    }
+    double proximityFactor = get_proximity_factor(wire, frequency, temperature, [&](double nodeFrequency, double nodeTemperature) {
+        return calculate_proximity_factor(wire, nodeFrequency, nodeTemperature);
+    });
     // BUG-002 convention (matches every other proximity model): mean of |H|^2
     // over the turn's field points; this model still used the PEAK field point.
     double He2_sum = 0;
@@ -984,16 +962,9 @@ double WindingProximityEffectLossesLammeranerModel::calculate_proximity_factor(W
 }
 
 double WindingProximityEffectLossesLammeranerModel::calculate_turn_losses(Wire wire, double frequency, std::vector<ComplexFieldPoint> data, double temperature) {
-    double proximityFactor;
-    auto optionalproximityFactor = try_get_proximity_factor(wire, frequency, temperature);
-
-    if (optionalproximityFactor) {
-        proximityFactor = optionalproximityFactor.value();
-    }
-    else {
-        proximityFactor = calculate_proximity_factor(wire, frequency, temperature);
-        set_proximity_factor(wire, frequency, temperature, proximityFactor);
-    }
+    double proximityFactor = get_proximity_factor(wire, frequency, temperature, [&](double nodeFrequency, double nodeTemperature) {
+        return calculate_proximity_factor(wire, nodeFrequency, nodeTemperature);
+    });
 
     // BUG-004 FIX: Use mean of |H|^2 instead of averaging components separately
     double He2_sum = 0;
@@ -1113,16 +1084,9 @@ double WindingProximityEffectLossesDowellModel::calculate_proximity_factor(Wire
 }
 
 double WindingProximityEffectLossesDowellModel::calculate_turn_losses(Wire wire, double frequency, std::vector<ComplexFieldPoint> data, double temperature) {
-    double proximityFactor;
-    auto optionalproximityFactor = try_get_proximity_factor(wire, frequency, temperature);
-
-    if (optionalproximityFactor) {
-        proximityFactor = optionalproximityFactor.value();
-    }
-    else {
-        proximityFactor = calculate_proximity_factor(wire, frequency, temperature);
-        set_proximity_factor(wire, frequency, temperature, proximityFactor);
-    }
+    double proximityFactor = get_proximity_factor(wire, frequency, temperature, [&](double nodeFrequency, double nodeTemperature) {
+        return calculate_proximity_factor(wire, nodeFrequency, nodeTemperature);
+    });
 
     // Use RMS of |H|² (consistent with Rossmanith, Albach, and Lammeraner models)
     double He2_sum = 0;
@@ -1202,13 +1166,9 @@ double WindingProximityEffectLossesNanModel::calculate_proximity_factor(Wire wir
 }
 
 double WindingProximityEffectLossesNanModel::calculate_turn_losses(Wire wire, double frequency, std::vector<ComplexFieldPoint> data, double temperature) {
-    double proximityFactor;
-    auto opt = try_get_proximity_factor(wire, frequency, temperature);
-    if (opt) { proximityFactor = opt.value(); }
-    else {
-        proximityFactor = calculate_proximity_factor(wire, frequency, temperature);
-        set_proximity_factor(wire, frequency, temperature, proximityFactor);
-    }
+    double proximityFactor = get_proximity_factor(wire, frequency, temperature, [&](double nodeFrequency, double nodeTemperature) {
+        return calculate_proximity_factor(wire, nodeFrequency, nodeTemperature);
+    });
     double He2_sum = 0;
     for (auto& d : data) {
         if (std::isnan(d.get_real()) || std::isnan(d.get_imaginary()))
@@ -1304,13 +1264,9 @@ double WindingProximityEffectLossesWojdaModel::calculate_proximity_factor(Wire w
 }
 
 double WindingProximityEffectLossesWojdaModel::calculate_turn_losses(Wire wire, double frequency, std::vector<ComplexFieldPoint> data, double temperature) {
-    double proximityFactor;
-    auto opt = try_get_proximity_factor(wire, frequency, temperature);
-    if (opt) { proximityFactor = opt.value(); }
-    else {
-        proximityFactor = calculate_proximity_factor(wire, frequency, temperature);
-        set_proximity_factor(wire, frequency, temperature, proximityFactor);
-    }
+    double proximityFactor = get_proximity_factor(wire, frequency, temperature, [&](double nodeFrequency, double nodeTemperature) {
+        return calculate_proximity_factor(wire, nodeFrequency, nodeTemperature);
+    });
     double He2_sum = 0;
     for (auto& d : data) {
         if (std::isnan(d.get_real()) || std::isnan(d.get_imaginary()))
@@ -1381,13 +1337,9 @@ double WindingProximityEffectLossesSullivanModel::calculate_proximity_factor(Wir
 }
 
 double WindingProximityEffectLossesSullivanModel::calculate_turn_losses(Wire wire, double frequency, std::vector<ComplexFieldPoint> data, double temperature) {
-    double proximityFactor;
-    auto opt = try_get_proximity_factor(wire, frequency, temperature);
-    if (opt) { proximityFactor = opt.value(); }
-    else {
-        proximityFactor = calculate_proximity_factor(wire, frequency, temperature);
-        set_proximity_factor(wire, frequency, temperature, proximityFactor);
-    }
+    double proximityFactor = get_proximity_factor(wire, frequency, temperature, [&](double nodeFrequency, double nodeTemperature) {
+        return calculate_proximity_factor(wire, nodeFrequency, nodeTemperature);
+    });
     double He2_sum = 0;
     for (auto& d : data) {
         if (std::isnan(d.get_real()) || std::isnan(d.get_imaginary()))
@@ -1488,13 +1440,9 @@ double WindingProximityEffectLossesBartoliModel::calculate_proximity_factor(Wire
 }
 
 double WindingProximityEffectLossesBartoliModel::calculate_turn_losses(Wire wire, double frequency, std::vector<ComplexFieldPoint> data, double temperature) {
-    double proximityFactor;
-    auto opt = try_get_proximity_factor(wire, frequency, temperature);
-    if (opt) { proximityFactor = opt.value(); }
-    else {
-        proximityFactor = calculate_proximity_factor(wire, frequency, temperature);
-        set_proximity_factor(wire, frequency, temperature, proximityFactor);
-    }
+    double proximityFactor = get_proximity_factor(wire, frequency, temperature, [&](double nodeFrequency, double nodeTemperature) {
+        return calculate_proximity_factor(wire, nodeFrequency, nodeTemperature);
+    });
     double He2_sum = 0;
     for (auto& d : data) {
         if (std::isnan(d.get_real()) || std::isnan(d.get_imaginary()))
@@ -1581,13 +1529,9 @@ double WindingProximityEffectLossesVandelacModel::calculate_proximity_factor(Wir
 }
 
 double WindingProximityEffectLossesVandelacModel::calculate_turn_losses(Wire wire, double frequency, std::vector<ComplexFieldPoint> data, double temperature) {
-    double proximityFactor;
-    auto opt = try_get_proximity_factor(wire, frequency, temperature);
-    if (opt) { proximityFactor = opt.value(); }
-    else {
-        proximityFactor = calculate_proximity_factor(wire, frequency, temperature);
-        set_proximity_factor(wire, frequency, temperature, proximityFactor);
-    }
+    double proximityFactor = get_proximity_factor(wire, frequency, temperature, [&](double nodeFrequency, double nodeTemperature) {
+        return calculate_proximity_factor(wire, nodeFrequency, nodeTemperature);
+    });
     double He2_sum = 0;
     for (auto& d : data) {
         if (std::isnan(d.get_real()) || std::isnan(d.get_imaginary()))
@@ -3,6 +3,7 @@
 #include "MAS.hpp"
 #include "constructive_models/Coil.h"
 #include "constructive_models/Wire.h"
+#include "physical_models/WireFrequencyResponseTable.h"
 #include "support/Utils.h"
 #include "Models.h"
 
@@ -24,6 +25,7 @@ class WindingProximityEffectLossesModel {
   private:
   protected:
     std::map<size_t, std::map<double, std::map<double, double>>> _proximityFactorPerWirePerFrequencyPerTemperature;
+    WireFrequencyResponseTable _proximityFactorTable;
   public:
     std::string methodName = "Default";
     virtual double calculate_turn_losses(Wire wire, double frequency, std::vector<ComplexFieldPoint> data, double temperature) = 0;
@@ -35,6 +37,10 @@ class WindingProximityEffectLossesModel {
     virtual ~WindingProximityEffectLossesModel() = default;
     std::optional<double> try_get_proximity_factor(Wire wire, double frequency, double temperature);
     void set_proximity_factor(Wire wire, double frequency, double temperature, double proximityFactor);
+    // Proximity factor of the wire from the per-wire table when
+    // Settings::get_winding_losses_tabulated() is set, otherwise from the
+    // exact-point cache, calling calculateProximityFactor(f, T) on a miss.
+    double get_proximity_factor(Wire wire, double frequency, double temperature, const WireFrequencyResponseTable::ExactResponse& calculateProximityFactor);
     static std::shared_ptr<WindingProximityEffectLossesModel> factory(WindingProximityEffectLossesModels modelName);
 };
 
@@ -36,16 +36,8 @@ inline double resolve_conducting_diameter(const Wire& wire) {
 }
 
 // PERF-003: Cached ResistivityModel to avoid repeated factory() calls
-inline std::shared_ptr<ResistivityModel>& get_cached_resistivity_model() {
-    static std::shared_ptr<ResistivityModel> m = ResistivityModel::factory(ResistivityModels::WIRE_MATERIAL);
-    return m;
-}
-// PERF-002: Composite hash to avoid collisions when wire has no name
-inline std::size_t hash_combine_wire(int64_t n, double w, double h) {
-    std::size_t seed = std::hash<int64_t>{}(n);
-    seed ^= std::hash<double>{}(w) + 0x9e3779b9 + (seed << 6) + (seed >> 2);
-    seed ^= std::hash<double>{}(h) + 0x9e3779b9 + (seed << 6) + (seed >> 2);
-    return seed;
+inline const std::shared_ptr<ResistivityModel>& get_cached_resistivity_model() {
+    return ResistivityModel::get_shared(ResistivityModels::WIRE_MATERIAL);
 }
 
 std::shared_ptr<WindingSkinEffectLossesModel> WindingSkinEffectLossesModel::factory(WindingSkinEffectLossesModels modelName){
@@ -344,16 +336,7 @@ WindingLossesOutput WindingSkinEffectLosses::calculate_skin_effect_losses(Coil c
 }
 
 std::optional<double> WindingSkinEffectLossesModel::try_get_skin_factor(Wire wire, double frequency, double temperature) {
-    if (!wire.get_number_conductors()) {
-        wire.set_number_conductors(1);
-    }
-    std::size_t hash;
-    if (!wire.get_name()) {
-        hash = hash_combine_wire(wire.get_number_conductors().value(), wire.get_maximum_outer_width(), wire.get_maximum_outer_height());
-    }
-    else {
-        hash = std::hash<std::string>{}(wire.get_name().value());
-    }
+    auto hash = WireFrequencyResponseTable::get_wire_key(wire);
 
     if (_skinFactorPerWirePerFrequencyPerTemperature.contains(hash)) {
         if (_skinFactorPerWirePerFrequencyPerTemperature[hash].contains(frequency)) {
@@ -368,21 +351,31 @@ std::optional<double> WindingSkinEffectLossesModel::try_get_skin_factor(Wire wir
 
 
 void WindingSkinEffectLossesModel::set_skin_factor(Wire wire,  double frequency, double temperature, double skinFactor) {
-    if (!wire.get_number_conductors()) {
-        wire.set_number_conductors(1);
-    }
-    std::size_t hash;
-    if (!wire.get_name()) {
-        hash = hash_combine_wire(wire.get_number_conductors().value(), wire.get_maximum_outer_width(), wire.get_maximum_outer_height());
-    }
-    else {
-        hash = std::hash<std::string>{}(wire.get_name().value());
-    }
+    auto hash = WireFrequencyResponseTable::get_wire_key(wire);
 
     _skinFactorPerWirePerFrequencyPerTemperature[hash][frequency][temperature] = skinFactor;
 
 }
 
+double WindingSkinEffectLossesModel::get_skin_factor(Wire wire, double frequency, double temperature, const WireFrequencyResponseTable::ExactResponse& calculateSkinFactor) {
+    if (settings.get_winding_losses_tabulated()) {
+        auto hash = WireFrequencyResponseTable::get_wire_key(wire);
+        // Tabulated as FR - 1, which vanishes at DC, so the log interpolation
+        // follows its f^2 onset instead of flattening it.
+        return 1 + _skinFactorTable.get(hash, frequency, temperature, [&](double nodeFrequency, double nodeTemperature) {
+            return calculateSkinFactor(nodeFrequency, nodeTemperature) - 1;
+        });
+    }
+
+    auto optionalSkinFactor = try_get_skin_factor(wire, frequency, temperature);
+    if (optionalSkinFactor) {
+        return optionalSkinFactor.value();
+    }
+    double skinFactor = calculateSkinFactor(frequency, temperature);
+    set_skin_factor(wire, frequency, temperature, skinFactor);
+    return skinFactor;
+}
+
 /**
  * @brief Calculates the penetration ratio for winding resistance calculation.
  * 
@@ -495,16 +488,9 @@ double WindingSkinEffectLossesWojdaModel::calculate_skin_factor(const Wire& wire
 }
 
 double WindingSkinEffectLossesWojdaModel::calculate_turn_losses(Wire wire, double dcLossTurn, double frequency, double temperature, [[maybe_unused]]double currentRms) {
-    double skinFactor;
-    auto optionalSkinFactor = try_get_skin_factor(wire, frequency, temperature);
-
-    if (optionalSkinFactor) {
-        skinFactor = optionalSkinFactor.value();
-    }
-    else {
-        skinFactor = calculate_skin_factor(wire, frequency, temperature);
-        set_skin_factor(wire, frequency, temperature, skinFactor);
-    }
+    double skinFactor = get_skin_factor(wire, frequency, temperature, [&](double nodeFrequency, double nodeTemperature) {
+        return calculate_skin_factor(wire, nodeFrequency, nodeTemperature);
+    });
 
     auto turnLosses = dcLossTurn * (skinFactor - 1);
     return turnLosses;
@@ -640,16 +626,9 @@ double WindingSkinEffectLossesAlbachModel::calculate_skin_factor(const Wire& wir
 
 
 double WindingSkinEffectLossesAlbachModel::calculate_turn_losses(Wire wire, double dcLossTurn, double frequency, double temperature, [[maybe_unused]]double currentRms) {
-    double skinFactor;
-    auto optionalSkinFactor = try_get_skin_factor(wire, frequency, temperature);
-
-    if (optionalSkinFactor) {
-        skinFactor = optionalSkinFactor.value();
-    }
-    else {
-        skinFactor = calculate_skin_factor(wire, frequency, temperature);
-        set_skin_factor(wire, frequency, temperature, skinFactor);
-    }
+    double skinFactor = get_skin_factor(wire, frequency, temperature, [&](double nodeFrequency, double nodeTemperature) {
+        return calculate_skin_factor(wire, nodeFrequency, nodeTemperature);
+    });
 
     auto turnLosses = dcLossTurn * (skinFactor - 1);
     return turnLosses;
@@ -788,16 +767,9 @@ double WindingSkinEffectLossesFerreiraModel::calculate_skin_factor(const Wire& w
 
 
 double WindingSkinEffectLossesFerreiraModel::calculate_turn_losses(Wire wire, double dcLossTurn, double frequency, double temperature, [[maybe_unused]]double currentRms) {
-    double skinFactor;
-    auto optionalSkinFactor = try_get_skin_factor(wire, frequency, temperature);
-
-    if (optionalSkinFactor) {
-        skinFactor = optionalSkinFactor.value();
-    }
-    else {
-        skinFactor = calculate_skin_factor(wire, frequency, temperature);
-        set_skin_factor(wire, frequency, temperature, skinFactor);
-    }
+    double skinFactor = get_skin_factor(wire, frequency, temperature, [&](double nodeFrequency, double nodeTemperature) {
+        return calculate_skin_factor(wire, nodeFrequency, nodeTemperature);
+    });
 
     // Return only the AC increment: the DC part is already accounted for by
     // WindingOhmicLosses on the full waveform RMS (matches every sibling model)
@@ -1022,14 +994,9 @@ double WindingSkinEffectLossesDowellModel::calculate_skin_factor(const Wire& wir
 }
 
 double WindingSkinEffectLossesDowellModel::calculate_turn_losses(Wire wire, double dcLossTurn, double frequency, double temperature, [[maybe_unused]] double currentRms) {
-    double skinFactor;
-    auto optionalSkinFactor = try_get_skin_factor(wire, frequency, temperature);
-    if (optionalSkinFactor) {
-        skinFactor = optionalSkinFactor.value();
-    } else {
-        skinFactor = calculate_skin_factor(wire, frequency, temperature);
-        set_skin_factor(wire, frequency, temperature, skinFactor);
-    }
+    double skinFactor = get_skin_factor(wire, frequency, temperature, [&](double nodeFrequency, double nodeTemperature) {
+        return calculate_skin_factor(wire, nodeFrequency, nodeTemperature);
+    });
     return dcLossTurn * (skinFactor - 1);
 }
 
@@ -1067,14 +1034,9 @@ double WindingSkinEffectLossesPerryModel::calculate_skin_factor(const Wire& wire
 }
 
 double WindingSkinEffectLossesPerryModel::calculate_turn_losses(Wire wire, double dcLossTurn, double frequency, double temperature, [[maybe_unused]] double currentRms) {
-    double skinFactor;
-    auto optionalSkinFactor = try_get_skin_factor(wire, frequency, temperature);
-    if (optionalSkinFactor) {
-        skinFactor = optionalSkinFactor.value();
-    } else {
-        skinFactor = calculate_skin_factor(wire, frequency, temperature);
-        set_skin_factor(wire, frequency, temperature, skinFactor);
-    }
+    double skinFactor = get_skin_factor(wire, frequency, temperature, [&](double nodeFrequency, double nodeTemperature) {
+        return calculate_skin_factor(wire, nodeFrequency, nodeTemperature);
+    });
     return dcLossTurn * (skinFactor - 1);
 }
 
@@ -1117,14 +1079,9 @@ double WindingSkinEffectLossesDimitrakakisModel::calculate_skin_factor(const Wir
 }
 
 double WindingSkinEffectLossesDimitrakakisModel::calculate_turn_losses(Wire wire, double dcLossTurn, double frequency, double temperature, [[maybe_unused]] double currentRms) {
-    double skinFactor;
-    auto optionalSkinFactor = try_get_skin_factor(wire, frequency, temperature);
-    if (optionalSkinFactor) {
-        skinFactor = optionalSkinFactor.value();
-    } else {
-        skinFactor = calculate_skin_factor(wire, frequency, temperature);
-        set_skin_factor(wire, frequency, temperature, skinFactor);
-    }
+    double skinFactor = get_skin_factor(wire, frequency, temperature, [&](double nodeFrequency, double nodeTemperature) {
+        return calculate_skin_factor(wire, nodeFrequency, nodeTemperature);
+    });
     return dcLossTurn * (skinFactor - 1);
 }
 
@@ -1177,14 +1134,9 @@ double WindingSkinEffectLossesMuehlethalerModel::calculate_skin_factor(const Wir
 }
 
 double WindingSkinEffectLossesMuehlethalerModel::calculate_turn_losses(Wire wire, double dcLossTurn, double frequency, double temperature, [[maybe_unused]] double currentRms) {
-    double skinFactor;
-    auto optionalSkinFactor = try_get_skin_factor(wire, frequency, temperature);
-    if (optionalSkinFactor) {
-        skinFactor = optionalSkinFactor.value();
-    } else {
-        skinFactor = calculate_skin_factor(wire, frequency, temperature);
-        set_skin_factor(wire, frequency, temperature, skinFactor);
-    }
+    double skinFactor = get_skin_factor(wire, frequency, temperature, [&](double nodeFrequency, double nodeTemperature) {
+        return calculate_skin_factor(wire, nodeFrequency, nodeTemperature);
+    });
     return dcLossTurn * (skinFactor - 1);
 }
 
@@ -1223,14 +1175,9 @@ double WindingSkinEffectLossesNanModel::calculate_skin_factor(const Wire& wire,
 }
 
 double WindingSkinEffectLossesNanModel::calculate_turn_losses(Wire wire, double dcLossTurn, double frequency, double temperature, [[maybe_unused]] double currentRms) {
-    double skinFactor;
-    auto optionalSkinFactor = try_get_skin_factor(wire, frequency, temperature);
-    if (optionalSkinFactor) {
-        skinFactor = optionalSkinFactor.value();
-    } else {
-        skinFactor = calculate_skin_factor(wire, frequency, temperature);
-        set_skin_factor(wire, frequency, temperature, skinFactor);
-    }
+    double skinFactor = get_skin_factor(wire, frequency, temperature, [&](double nodeFrequency, double nodeTemperature) {
+        return calculate_skin_factor(wire, nodeFrequency, nodeTemperature);
+    });
     return dcLossTurn * (skinFactor - 1);
 }
 
@@ -1268,14 +1215,9 @@ double WindingSkinEffectLossesKazimierczukModel::calculate_skin_factor(const Wir
 }
 
 double WindingSkinEffectLossesKazimierczukModel::calculate_turn_losses(Wire wire, double dcLossTurn, double frequency, double temperature, [[maybe_unused]] double currentRms) {
-    double skinFactor;
-    auto optionalSkinFactor = try_get_skin_factor(wire, frequency, temperature);
-    if (optionalSkinFactor) {
-        skinFactor = optionalSkinFactor.value();
-    } else {
-        skinFactor = calculate_skin_factor(wire, frequency, temperature);
-        set_skin_factor(wire, frequency, temperature, skinFactor);
-    }
+    double skinFactor = get_skin_factor(wire, frequency, temperature, [&](double nodeFrequency, double nodeTemperature) {
+        return calculate_skin_factor(wire, nodeFrequency, nodeTemperature);
+    });
     return dcLossTurn * (skinFactor - 1);
 }
 
@@ -1385,14 +1327,9 @@ double WindingSkinEffectLossesHolguinModel::calculate_skin_factor(const Wire& wi
 }
 
 double WindingSkinEffectLossesHolguinModel::calculate_turn_losses(Wire wire, double dcLossTurn, double frequency, double temperature, [[maybe_unused]] double currentRms) {
-    double skinFactor;
-    auto optionalSkinFactor = try_get_skin_factor(wire, frequency, temperature);
-    if (optionalSkinFactor) {
-        skinFactor = optionalSkinFactor.value();
-    } else {
-        skinFactor = calculate_skin_factor(wire, frequency, temperature);
-        set_skin_factor(wire, frequency, temperature, skinFactor);
-    }
+    double skinFactor = get_skin_factor(wire, frequency, temperature, [&](double nodeFrequency, double nodeTemperature) {
+        return calculate_skin_factor(wire, nodeFrequency, nodeTemperature);
+    });
     return dcLossTurn * (skinFactor - 1);
 }
 
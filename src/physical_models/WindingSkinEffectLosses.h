@@ -2,6 +2,7 @@
 #include "Constants.h"
 #include "MAS.hpp"
 #include "physical_models/Resistivity.h"
+#include "physical_models/WireFrequencyResponseTable.h"
 #include "constructive_models/Coil.h"
 #include "constructive_models/Wire.h"
 #include "support/Utils.h"
@@ -26,8 +27,13 @@ class WindingSkinEffectLossesModel {
  private:
  protected:
     std::map<size_t, std::map<double, std::map<double, double>>> _skinFactorPerWirePerFrequencyPerTemperature;
+    WireFrequencyResponseTable _skinFactorTable;
     std::optional<double> try_get_skin_factor(Wire wire, double frequency, double temperature);
     void set_skin_factor(Wire wire, double frequency, double temperature, double skinFactor);
+    // Skin factor of the wire from the per-wire table when
+    // Settings::get_winding_losses_tabulated() is set, otherwise from the
+    // exact-point cache above, calling calculateSkinFactor(f, T) on a miss.
+    double get_skin_factor(Wire wire, double frequency, double temperature, const WireFrequencyResponseTable::ExactResponse& calculateSkinFactor);
 
  public:
     std::string methodName = "Default";
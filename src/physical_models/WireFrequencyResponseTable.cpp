@@ -0,0 +1,150 @@
+#include "physical_models/WireFrequencyResponseTable.h"
+#include "constructive_models/Wire.h"
+#include "support/Settings.h"
+#include "support/Utils.h"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <exception>
+#include <functional>
+#include <limits>
+#include <string>
+
+namespace OpenMagnetics {
+
+namespace {
+
+constexpr double logFrequencyOrigin = 0;
+constexpr double logFrequencyStep = 1.0 / 32;
+constexpr size_t numberFrequencyNodes = 9 * 32 + 1;
+constexpr double temperatureOrigin = -50;
+constexpr double temperatureStep = 25;
+constexpr size_t numberTemperatureNodes = 13;
+
+uint32_t pack_node(size_t frequencyIndex, size_t temperatureIndex) {
+    return static_cast<uint32_t>(frequencyIndex) | (static_cast<uint32_t>(temperatureIndex) << 16);
+}
+
+double interpolate_bilinear(const std::array<double, 4>& corners, double frequencyFraction, double temperatureFraction) {
+    bool allPositive = true;
+    bool allNegative = true;
+    for (double corner : corners) {
+        allPositive = allPositive && corner > 0;
+        allNegative = allNegative && corner < 0;
+    }
+    auto blend = [&](const std::array<double, 4>& values) {
+        return (1 - frequencyFraction) * (1 - temperatureFraction) * values[0] + frequencyFraction * (1 - temperatureFraction) * values[1] +
+               (1 - frequencyFraction) * temperatureFraction * values[2] + frequencyFraction * temperatureFraction * values[3];
+    };
+    if (allPositive || allNegative) {
+        std::array<double, 4> logCorners;
+        for (size_t corner = 0; corner < 4; ++corner) {
+            logCorners[corner] = std::log(std::fabs(corners[corner]));
+        }
+        return (allPositive ? 1 : -1) * std::exp(blend(logCorners));
+    }
+    return blend(corners);
+}
+
+} // namespace
+
+// PERF-002: composite key so that unnamed wires do not collide.
+size_t WireFrequencyResponseTable::get_wire_key(Wire wire) {
+    if (wire.get_name()) {
+        return std::hash<std::string>{}(wire.get_name().value());
+    }
+    if (!wire.get_number_conductors()) {
+        wire.set_number_conductors(1);
+    }
+    std::size_t seed = std::hash<int64_t>{}(wire.get_number_conductors().value());
+    seed ^= std::hash<double>{}(wire.get_maximum_outer_width()) + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+    seed ^= std::hash<double>{}(wire.get_maximum_outer_height()) + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+    return seed;
+}
+
+void WireFrequencyResponseTable::clear() {
+    _tables.clear();
+}
+
+double WireFrequencyResponseTable::get(size_t wireKey, double frequency, double temperature, const ExactResponse& exactResponse) {
+    auto evaluate_exact = [&](double nodeFrequency, double nodeTemperature) {
+        _numberExactEvaluations++;
+        return exactResponse(nodeFrequency, nodeTemperature);
+    };
+
+    double frequencyPosition = (std::log10(frequency) - logFrequencyOrigin) / logFrequencyStep;
+    double temperaturePosition = (temperature - temperatureOrigin) / temperatureStep;
+    if (!std::isfinite(frequencyPosition) || !std::isfinite(temperaturePosition) ||
+        frequencyPosition < 0 || frequencyPosition > numberFrequencyNodes - 1 ||
+        temperaturePosition < 0 || temperaturePosition > numberTemperatureNodes - 1) {
+        return evaluate_exact(frequency, temperature);
+    }
+
+    double tolerance = settings.get_winding_losses_tabulated_tolerance();
+    auto databasesGeneration = get_databases_generation();
+    if (tolerance != _tolerance || databasesGeneration != _databasesGeneration) {
+        _tables.clear();
+        _tolerance = tolerance;
+        _databasesGeneration = databasesGeneration;
+    }
+
+    size_t frequencyIndex = std::min(static_cast<size_t>(frequencyPosition), numberFrequencyNodes - 2);
+    size_t temperatureIndex = std::min(static_cast<size_t>(temperaturePosition), numberTemperatureNodes - 2);
+    double frequencyFraction = frequencyPosition - frequencyIndex;
+    double temperatureFraction = temperaturePosition - temperatureIndex;
+    auto node_frequency = [&](size_t index) { return std::pow(10, logFrequencyOrigin + logFrequencyStep * index); };
+    auto node_temperature = [&](size_t index) { return temperatureOrigin + temperatureStep * index; };
+
+    auto& table = _tables[wireKey];
+    uint32_t cellKey = pack_node(frequencyIndex, temperatureIndex);
+    auto smooth = table.smoothPerCell.find(cellKey);
+    if (smooth != table.smoothPerCell.end() && !smooth->second) {
+        return evaluate_exact(frequency, temperature);
+    }
+
+    // Corners ordered (f, T), (f+1, T), (f, T+1), (f+1, T+1).
+    std::array<double, 4> corners;
+    bool cornersValid = true;
+    for (size_t corner = 0; corner < 4; ++corner) {
+        size_t nodeFrequencyIndex = frequencyIndex + (corner & 1);
+        size_t nodeTemperatureIndex = temperatureIndex + (corner >> 1);
+        uint32_t nodeKey = pack_node(nodeFrequencyIndex, nodeTemperatureIndex);
+        auto node = table.valuePerNode.find(nodeKey);
+        if (node == table.valuePerNode.end()) {
+            double value = std::numeric_limits<double>::quiet_NaN();
+            try {
+                value = evaluate_exact(node_frequency(nodeFrequencyIndex), node_temperature(nodeTemperatureIndex));
+            }
+            catch (const std::exception&) {
+            }
+            node = table.valuePerNode.emplace(nodeKey, value).first;
+        }
+        corners[corner] = node->second;
+        cornersValid = cornersValid && std::isfinite(corners[corner]);
+    }
+
+    if (smooth == table.smoothPerCell.end()) {
+        bool cellSmooth = cornersValid;
+        if (cellSmooth) {
+            try {
+                double centreFrequency = std::pow(10, logFrequencyOrigin + logFrequencyStep * (frequencyIndex + 0.5));
+                double centreTemperature = temperatureOrigin + temperatureStep * (temperatureIndex + 0.5);
+                double exactAtCentre = evaluate_exact(centreFrequency, centreTemperature);
+                double tabulatedAtCentre = interpolate_bilinear(corners, 0.5, 0.5);
+                cellSmooth = std::isfinite(exactAtCentre) &&
+                             std::fabs(tabulatedAtCentre - exactAtCentre) <= tolerance * std::fabs(exactAtCentre);
+            }
+            catch (const std::exception&) {
+                cellSmooth = false;
+            }
+        }
+        table.smoothPerCell.emplace(cellKey, cellSmooth);
+        if (!cellSmooth) {
+            return evaluate_exact(frequency, temperature);
+        }
+    }
+    return interpolate_bilinear(corners, frequencyFraction, temperatureFraction);
+}
+
+} // namespace OpenMagnetics
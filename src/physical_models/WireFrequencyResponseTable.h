@@ -0,0 +1,55 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <unordered_map>
+
+namespace OpenMagnetics {
+
+class Wire;
+
+// Skin factor (as FR - 1) or proximity factor of one wire over frequency and
+// temperature, built up while Settings::get_winding_losses_tabulated() is set.
+// A winding-loss sweep asks for the same catalogue wire at every harmonic of
+// every operating point and candidate; with the table, a wire costs one exact
+// evaluation per node and cell it actually touches.
+//
+// GRID: log10 f from 1 Hz to 1 GHz at 32 nodes per decade, temperature from
+// -50 to 250 C every 25 C. A query interpolates bilinearly in (log f, T), on
+// log|value| when the four corners share a sign (FR - 1 grows as f^2 at low
+// frequency, a straight line in log-log) and on the value itself otherwise.
+// Each cell is checked once against the exact response at its centre; a cell
+// that misses by more than Settings::get_winding_losses_tabulated_tolerance(),
+// or has a failing node, is answered exactly from then on. So is any point off
+// the grid.
+//
+// The skin and proximity models own one table each and are thread_local, so
+// there is no locking. Tables are dropped when the tolerance or the database
+// generation changes.
+class WireFrequencyResponseTable {
+    public:
+        using ExactResponse = std::function<double(double frequency, double temperature)>;
+
+        double get(size_t wireKey, double frequency, double temperature, const ExactResponse& exactResponse);
+
+        // Identifies a wire across calls: its name, or its number of conductors
+        // and outer dimensions when it has none.
+        static size_t get_wire_key(Wire wire);
+
+        // Calls made to exactResponse (nodes, cell checks and fallbacks) so far.
+        size_t get_number_exact_evaluations() const { return _numberExactEvaluations; }
+        void clear();
+
+    private:
+        struct Table {
+            std::unordered_map<uint32_t, double> valuePerNode;
+            std::unordered_map<uint32_t, bool> smoothPerCell;
+        };
+
+        std::unordered_map<size_t, Table> _tables;
+        double _tolerance = 0;
+        uint64_t _databasesGeneration = 0;
+        size_t _numberExactEvaluations = 0;
+};
+
+} // namespace OpenMagnetics
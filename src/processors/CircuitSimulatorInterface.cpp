@@ -11,6 +11,15 @@
 #include "support/Settings.h"
 #include <filesystem>
 #include <ctime>
+#include <array>
+#include <charconv>
+#include <cstring>
+#include <string_view>
+#include <functional>
+#include <iterator>
+#include <map>
+#include <mutex>
+#include <sstream>
 // levmar.h removed - using Eigen LevenbergMarquardt
 #include <float.h>
 #include "support/Exceptions.h"
@@ -120,10 +129,44 @@ void CircuitSimulatorExporter::analytical_func(double *p, double *x, int m, int
     }
 }
 
+void CircuitSimulatorExporter::analytical_jacobian(double *p, double *jac, int m, int n, void *data) {
+    double* frequencies = static_cast <double*> (data);
+    for (int i = 0; i < n; ++i) {
+        jac[i * m + 0] = 1;
+        jac[i * m + 1] = sqrt(frequencies[i]);
+        jac[i * m + 2] = frequencies[i];
+    }
+}
+
 std::complex<double> parallel(std::complex<double> z0, std::complex<double> z1) {
     return 1.0 / (1.0 / z0 + 1.0 / z1);
 }
 
+// d/dz0 and d/dz1 of parallel(z0, z1) = z0 z1 / (z0 + z1).
+static std::pair<std::complex<double>, std::complex<double>> parallel_derivatives(std::complex<double> z0, std::complex<double> z1) {
+    auto sumSquared = (z0 + z1) * (z0 + z1);
+    return {z1 * z1 / sumSquared, z0 * z0 / sumSquared};
+}
+
+// Gradient of Re(R0 + L1 || (R1 + L2 || (R2 + ... Ln || Rn))) over
+// x = [R1, L1, ..., Rn, Ln]. The nested impedances are built from the
+// innermost stage out, then differentiated from the outermost stage in.
+static void ladder_gradient(const double* x, int numberStages, double frequency, double* gradient) {
+    std::complex<double> jw(0, 2 * std::numbers::pi * frequency);
+    std::vector<std::complex<double>> inner(numberStages);
+    inner[numberStages - 1] = x[2 * (numberStages - 1)];
+    for (int k = numberStages - 1; k > 0; --k) {
+        inner[k - 1] = x[2 * (k - 1)] + parallel(jw * x[2 * k + 1], inner[k]);
+    }
+    std::complex<double> chain = 1.0;
+    for (int k = 0; k < numberStages; ++k) {
+        auto [byInductance, byInner] = parallel_derivatives(jw * x[2 * k + 1], inner[k]);
+        gradient[2 * k + 1] = (chain * byInductance * jw).real();
+        chain *= byInner;
+        gradient[2 * k] = chain.real();
+    }
+}
+
 double CircuitSimulatorExporter::ladder_model(double x[], double frequency, double dcResistance) {
     double w = 2 * std::numbers::pi * frequency;
     auto R0 = std::complex<double>(dcResistance);
@@ -175,6 +218,20 @@ void CircuitSimulatorExporter::ladder_func(double *p, double *x, int m, int n, v
         x[i]=ladder_model(p, dcResistanceAndFrequencies[i + 1], dcResistance);
 }
 
+void CircuitSimulatorExporter::ladder_jacobian(double *p, double *jac, int m, int n, void *data) {
+    double* dcResistanceAndFrequencies = static_cast <double*> (data);
+    double dcResistance = dcResistanceAndFrequencies[0];
+
+    for (int i = 0; i < n; ++i) {
+        double* row = jac + i * m;
+        if (ladder_model(p, dcResistanceAndFrequencies[i + 1], dcResistance) >= 1e30) {
+            std::fill(row, row + m, 0.0);
+            continue;
+        }
+        ladder_gradient(p, 5, dcResistanceAndFrequencies[i + 1], row);
+    }
+}
+
 
 double CircuitSimulatorExporter::core_ladder_model(double x[], double frequency, double dcResistance) {
     double w = 2 * std::numbers::pi * frequency;
@@ -204,6 +261,20 @@ void CircuitSimulatorExporter::core_ladder_func(double *p, double *x, int m, int
         x[i]=core_ladder_model(p, dcResistanceAndFrequencies[i + 1], dcResistance);
 }
 
+void CircuitSimulatorExporter::core_ladder_jacobian(double *p, double *jac, int m, int n, void *data) {
+    double* dcResistanceAndFrequencies = static_cast <double*> (data);
+    double dcResistance = dcResistanceAndFrequencies[0];
+
+    for (int i = 0; i < n; ++i) {
+        double* row = jac + i * m;
+        if (core_ladder_model(p, dcResistanceAndFrequencies[i + 1], dcResistance) >= 1e30) {
+            std::fill(row, row + m, 0.0);
+            continue;
+        }
+        ladder_gradient(p, 3, dcResistanceAndFrequencies[i + 1], row);
+    }
+}
+
 // Rosano model: R + (L||R) + (L||(R + 1/sC)) — three series stages
 // Stage 1 (R):   R1 — pure DC loss floor
 // Stage 2 (RL):  L1 || R2 — at DC L shorts→0, at high freq→R2
@@ -245,6 +316,33 @@ void CircuitSimulatorExporter::core_rosano_func(double *p, double *x, int m, int
     }
 }
 
+void CircuitSimulatorExporter::core_rosano_jacobian(double *p, double *jac, int m, int n, void *data) {
+    double* frequencies = static_cast<double*>(data);
+
+    for (int i = 0; i < n; ++i) {
+        double* row = jac + i * m;
+        std::fill(row, row + m, 0.0);
+        double val = core_rosano_model(p, frequencies[i]);
+        if (val <= 0 || val >= 1e30) {
+            continue;
+        }
+        double w = 2 * std::numbers::pi * frequencies[i];
+        std::complex<double> jw(0, w);
+        auto [byL1, byR2] = parallel_derivatives(jw * p[2], p[1]);
+        auto [byL2, byR3plusC] = parallel_derivatives(jw * p[4], std::complex<double>(p[3], -1.0 / (w * p[5])));
+        row[0] = 1;
+        row[1] = byR2.real();
+        row[2] = (byL1 * jw).real();
+        row[3] = byR3plusC.real();
+        row[4] = (byL2 * jw).real();
+        row[5] = (byR3plusC * std::complex<double>(0, 1.0 / (w * p[5] * p[5]))).real();
+        // d log(val) = d val / val
+        for (int j = 0; j < 6; ++j) {
+            row[j] /= val;
+        }
+    }
+}
+
 // Rosano winding model: Z = Rdc + sum_k(Rk || jwLk)
 // Each stage is a resistor in parallel with an inductor, chained in series.
 // At DC: all L short → Z = Rdc. At high freq: all L open → Z = Rdc + ΣRk.
@@ -275,6 +373,26 @@ void CircuitSimulatorExporter::winding_rosano_func(double *p, double *x, int m,
     }
 }
 
+void CircuitSimulatorExporter::winding_rosano_jacobian(double *p, double *jac, int m, int n, void *data) {
+    double* dcResistanceAndFrequencies = static_cast<double*>(data);
+    double dcResistance = dcResistanceAndFrequencies[0];
+    const int nStages = 6;
+    for (int i = 0; i < n; ++i) {
+        double* row = jac + i * m;
+        std::fill(row, row + m, 0.0);
+        double val = winding_rosano_model(p, dcResistanceAndFrequencies[i + 1], dcResistance);
+        if (val <= 0 || val >= 1e30) {
+            continue;
+        }
+        std::complex<double> jw(0, 2 * std::numbers::pi * dcResistanceAndFrequencies[i + 1]);
+        for (int k = 0; k < nStages; ++k) {
+            auto [byR, byL] = parallel_derivatives(p[2 * k], jw * p[2 * k + 1]);
+            row[2 * k] = byR.real() / val;
+            row[2 * k + 1] = (byL * jw).real() / val;
+        }
+    }
+}
+
 // Rosano RLC winding model: Z = Rdc + sum_{k=0}^{nRL-1}(Rk || jwLk) + (Rn || (jwLn + 1/(jwCn)))
 // Extended model with one RLC stage for better high-frequency fitting.
 // nStages: total number of stages
@@ -334,6 +452,75 @@ void CircuitSimulatorExporter::winding_rosano_rlc_func(double *p, double *x, int
     }
 }
 
+void CircuitSimulatorExporter::winding_rosano_rlc_jacobian(double *p, double *jac, int m, int n, void *data) {
+    auto* fitData = static_cast<WindingRosanoRLCFitData*>(data);
+    double dcResistance = fitData->dcResistanceAndFrequencies[0];
+    int nRLCStages = std::clamp(fitData->nRLCStages, 0, 1);
+    int nRLStages = fitData->nStages - nRLCStages;
+
+    for (int i = 0; i < n; ++i) {
+        double* row = jac + i * m;
+        std::fill(row, row + m, 0.0);
+        double frequency = fitData->dcResistanceAndFrequencies[i + 1];
+        double val = CircuitSimulatorExporter::winding_rosano_rlc_model(p, fitData->nStages, fitData->nRLCStages, frequency, dcResistance);
+        if (fitData->nStages < 1 || val <= 0 || val >= 1e30) {
+            continue;
+        }
+        double w = 2 * std::numbers::pi * frequency;
+        std::complex<double> jw(0, w);
+        for (int k = 0; k < nRLStages; ++k) {
+            auto [byR, byL] = parallel_derivatives(p[2 * k], jw * p[2 * k + 1]);
+            row[2 * k] = byR.real() / val;
+            row[2 * k + 1] = (byL * jw).real() / val;
+        }
+        if (nRLCStages > 0) {
+            int rlcBase = 2 * nRLStages;
+            double C_n = p[rlcBase + 2];
+            auto [byR, byLC] = parallel_derivatives(p[rlcBase], std::complex<double>(0, w * p[rlcBase + 1] - 1.0 / (w * C_n)));
+            row[rlcBase] = byR.real() / val;
+            row[rlcBase + 1] = (byLC * jw).real() / val;
+            row[rlcBase + 2] = (byLC * std::complex<double>(0, 1.0 / (w * C_n * C_n))).real() / val;
+        }
+    }
+}
+
+// Physically derived starting points for the nested R-L ladders of
+// ladder_model() and core_ladder_model(). Stage k opens at the k-th of
+// numberStages frequencies spread geometrically from where the swept
+// resistance first rises 5% above its low-frequency value to the top of the
+// sweep, and adds an equal share of the total rise. The layout is also tried
+// with the rise halved and doubled, and with the transitions shifted down
+// and up by about half a decade.
+static std::vector<std::vector<double>> get_ladder_starting_points(const std::vector<double>& frequencies, const std::vector<double>& resistances,
+                                                                   size_t numberStages, double minimumTransitionFrequency) {
+    double lowFrequencyResistance = resistances.front();
+    double maximumResistance = *std::max_element(resistances.begin(), resistances.end());
+    double rise = std::max(maximumResistance - lowFrequencyResistance, 0.1 * fabs(lowFrequencyResistance));
+    double riseFrequency = frequencies.back() / 10;
+    for (size_t index = 0; index < resistances.size(); ++index) {
+        if (resistances[index] > 1.05 * lowFrequencyResistance) {
+            riseFrequency = frequencies[index];
+            break;
+        }
+    }
+    double firstTransition = std::max(riseFrequency / 3, frequencies.front());
+    double lastTransition = std::max(frequencies.back(), 10 * firstTransition);
+
+    std::vector<std::vector<double>> startingPoints;
+    for (auto [rScale, fScale] : {std::pair{1.0, 1.0}, {0.5, 1.0}, {2.0, 1.0}, {1.0, 0.3}, {1.0, 3.0}}) {
+        std::vector<double> coefficients;
+        for (size_t k = 0; k < numberStages; ++k) {
+            double transition = fScale * firstTransition * std::pow(lastTransition / firstTransition, (k + 0.5) / numberStages);
+            transition = std::max(transition, minimumTransitionFrequency);
+            double stageResistance = rScale * rise / numberStages;
+            coefficients.push_back(stageResistance);
+            coefficients.push_back(stageResistance / (2 * std::numbers::pi * transition));
+        }
+        startingPoints.push_back(coefficients);
+    }
+    return startingPoints;
+}
+
 std::vector<std::vector<double>> calculate_ac_resistance_coefficients_per_winding_rosano(Magnetic magnetic, double temperature, bool useRLCStages) {
     const size_t nStages = 6;
     const size_t numberUnknownsRL = 2 * nStages;       // [R1,L1, R2,L2, ..., R6,L6]
@@ -399,8 +586,8 @@ std::vector<std::vector<double>> calculate_ac_resistance_coefficients_per_windin
 
                 double opts[5] = {1e-3, 1e-25, 1e-25, 1e-25, 1e-19};
                 double info[10];
-                eigen_levmar_dif(CircuitSimulatorExporter::winding_rosano_func, coefficients,
-                                 logAcResistances, numberUnknownsRL, numberElements,
+                eigen_levmar_der(CircuitSimulatorExporter::winding_rosano_func, CircuitSimulatorExporter::winding_rosano_jacobian,
+                                 coefficients, logAcResistances, numberUnknownsRL, numberElements,
                                  10000, opts, info, nullptr, nullptr,
                                  static_cast<void*>(&dcResistanceAndFrequencies));
 
@@ -460,8 +647,8 @@ std::vector<std::vector<double>> calculate_ac_resistance_coefficients_per_windin
 
                     double opts[5] = {1e-3, 1e-25, 1e-25, 1e-25, 1e-19};
                     double info[10];
-                    eigen_levmar_dif(CircuitSimulatorExporter::winding_rosano_rlc_func, coefficients,
-                                     logAcResistances, numberUnknownsRLC, numberElements,
+                    eigen_levmar_der(CircuitSimulatorExporter::winding_rosano_rlc_func, CircuitSimulatorExporter::winding_rosano_rlc_jacobian,
+                                     coefficients, logAcResistances, numberUnknownsRLC, numberElements,
                                      10000, opts, info, nullptr, nullptr,
                                      static_cast<void*>(&rlcFitData));
 
@@ -524,14 +711,24 @@ std::vector<std::vector<double>> calculate_ac_resistance_coefficients_per_windin
             acResistances[index] = valuePoints[index];
         }
 
-        double bestError = DBL_MAX;
+        // Physical starting points first (transitions at or above twice the
+        // settling bound in ladder_model(), 1e-4 s), then the historical
+        // uniform decade starts unless one of those already fits within 2%.
+        auto startingPoints = get_ladder_starting_points(frequenciesVector, valuePoints, numberUnknowns / 2, 2 / (2 * std::numbers::pi * 1e-4));
         double initialState = 10;
-        std::vector<double> bestAcResistanceCoefficientsThisWinding;
         for (size_t loopIndex = 0; loopIndex < loopIterations; ++loopIndex) {
+            std::vector<double> startingPoint(numberUnknowns, initialState);
+            startingPoint[1] = 1e-9;
+            startingPoints.push_back(startingPoint);
+            initialState /= 10;
+        }
+
+        double bestError = DBL_MAX;
+        std::vector<double> bestAcResistanceCoefficientsThisWinding;
+        for (auto& startingPoint : startingPoints) {
+            if (bestError < 0.02) break;
             double coefficients[numberUnknowns];
-            for (size_t index = 0; index < numberUnknowns; ++index) {
-                coefficients[index] = initialState;
-            }
+            std::copy(startingPoint.begin(), startingPoint.end(), coefficients);
             double opts[5], info[10];
 
             double lmInitMu = 1e-03;
@@ -546,13 +743,12 @@ std::vector<std::vector<double>> calculate_ac_resistance_coefficients_per_windin
 
             double dcResistanceAndfrequencies[numberElementsPlusOne];
             dcResistanceAndfrequencies[0] = acResistances[0];
-            coefficients[1] = 1e-9;
             size_t numFreqs = std::min(frequenciesVector.size(), numberElements);
             for (size_t index = 0; index < numFreqs; ++index) {
                 dcResistanceAndfrequencies[index + 1] = frequenciesVector[index];
             }
 
-            eigen_levmar_dif(CircuitSimulatorExporter::ladder_func, coefficients, acResistances, numberUnknowns, numberElements, 10000, opts, info, NULL, NULL, static_cast<void*>(&dcResistanceAndfrequencies));
+            eigen_levmar_der(CircuitSimulatorExporter::ladder_func, CircuitSimulatorExporter::ladder_jacobian, coefficients, acResistances, numberUnknowns, numberElements, 10000, opts, info, NULL, NULL, static_cast<void*>(&dcResistanceAndfrequencies));
 
             double errorAverage = 0;
             for (size_t index = 0; index < frequenciesVector.size(); ++index) {
@@ -562,7 +758,6 @@ std::vector<std::vector<double>> calculate_ac_resistance_coefficients_per_windin
             }
 
             errorAverage /= frequenciesVector.size();
-            initialState /= 10;
 
             if (errorAverage < bestError) {
                 bestError = errorAverage;
@@ -578,7 +773,62 @@ std::vector<std::vector<double>> calculate_ac_resistance_coefficients_per_windin
     return acResistanceCoefficientsPerWinding;
 }
 
+// Process-wide memo behind calculate_ac_resistance_coefficients_per_winding()
+// and calculate_core_resistance_coefficients(). Keys are canonical strings, so
+// there are no collisions; when full it is emptied, like CoilMeshCache.
+namespace {
+
+constexpr size_t maximumNumberCurveFittingEntries = 32;
+std::mutex curveFittingCacheMutex;
+std::map<std::string, std::vector<std::vector<double>>> curveFittingCache;
+
+std::string get_curve_fitting_cache_key(const std::string& fit, int mode, const Magnetic& magnetic, double temperature) {
+    json magneticJson;
+    to_json(magneticJson, magnetic);
+    std::ostringstream key;
+    key << fit << '|' << mode << '|' << std::hexfloat << temperature << '|'
+        << OpenMagnetics::Settings::GetInstance().get_fingerprint() << '|' << get_databases_generation() << '|' << magneticJson.dump();
+    return key.str();
+}
+
+std::vector<std::vector<double>> get_or_fit_curve(const std::string& key, const std::function<std::vector<std::vector<double>>()>& fit) {
+    {
+        std::lock_guard<std::mutex> lock(curveFittingCacheMutex);
+        auto entry = curveFittingCache.find(key);
+        if (entry != curveFittingCache.end()) {
+            return entry->second;
+        }
+    }
+    // Fitted outside the lock; a concurrent miss on the same key fits the
+    // same coefficients and the first insert wins.
+    auto coefficients = fit();
+    std::lock_guard<std::mutex> lock(curveFittingCacheMutex);
+    if (curveFittingCache.size() >= maximumNumberCurveFittingEntries) {
+        curveFittingCache.clear();
+    }
+    return curveFittingCache.emplace(key, coefficients).first->second;
+}
+
+} // namespace
+
+void CircuitSimulatorExporter::clear_curve_fitting_cache() {
+    std::lock_guard<std::mutex> lock(curveFittingCacheMutex);
+    curveFittingCache.clear();
+}
+
+size_t CircuitSimulatorExporter::get_curve_fitting_cache_size() {
+    std::lock_guard<std::mutex> lock(curveFittingCacheMutex);
+    return curveFittingCache.size();
+}
+
 std::vector<double> CircuitSimulatorExporter::calculate_core_resistance_coefficients(Magnetic magnetic, double temperature, CoreLossTopology topology) {
+    auto key = get_curve_fitting_cache_key("core", static_cast<int>(topology), magnetic, temperature);
+    return get_or_fit_curve(key, [&]() {
+        return std::vector<std::vector<double>>{fit_core_resistance_coefficients(magnetic, temperature, topology)};
+    }).front();
+}
+
+std::vector<double> CircuitSimulatorExporter::fit_core_resistance_coefficients(Magnetic magnetic, double temperature, CoreLossTopology topology) {
     const size_t numberUnknowns = 6;
 
     const size_t numberElements = 20;
@@ -665,7 +915,7 @@ std::vector<double> CircuitSimulatorExporter::calculate_core_resistance_coeffici
                 opts[3] = 1e-25;
                 opts[4] = 1e-19;
 
-                eigen_levmar_dif(CircuitSimulatorExporter::core_rosano_func, coefficients, logCoreResistances, numberUnknowns, numberElements, 10000, opts, info, NULL, NULL, static_cast<void*>(&frequencies));
+                eigen_levmar_der(CircuitSimulatorExporter::core_rosano_func, CircuitSimulatorExporter::core_rosano_jacobian, coefficients, logCoreResistances, numberUnknowns, numberElements, 10000, opts, info, NULL, NULL, static_cast<void*>(&frequencies));
 
                 // Check for negative values (invalid physically)
                 bool allPositive = true;
@@ -725,11 +975,17 @@ std::vector<double> CircuitSimulatorExporter::calculate_core_resistance_coeffici
         }
     } else {
         // Ridley model: R0 + L1 || (R1 + L2 || (R2 + L3 || R3))
+        // Physical starting points first, then the historical uniform decade
+        // starts unless one of those already fits within 2%.
+        auto startingPoints = get_ladder_starting_points(frequenciesVector, valuePoints, numberUnknowns / 2, 0);
         for (size_t loopIndex = 0; loopIndex < loopIterations; ++loopIndex) {
+            startingPoints.push_back(std::vector<double>(numberUnknowns, initialState));
+            initialState /= 10;
+        }
+        for (auto& startingPoint : startingPoints) {
+            if (bestError < 0.02) break;
             double coefficients[numberUnknowns];
-            for (size_t index = 0; index < numberUnknowns; ++index) {
-                coefficients[index] = initialState;
-            }
+            std::copy(startingPoint.begin(), startingPoint.end(), coefficients);
             double opts[5], info[10];
 
             opts[0] = 1e-03;
@@ -744,7 +1000,7 @@ std::vector<double> CircuitSimulatorExporter::calculate_core_resistance_coeffici
                 dcResistanceAndfrequencies[index + 1] = frequenciesVector[index];
             }
 
-            eigen_levmar_dif(CircuitSimulatorExporter::core_ladder_func, coefficients, coreResistances, numberUnknowns, numberElements, 10000, opts, info, NULL, NULL, static_cast<void*>(&dcResistanceAndfrequencies));
+            eigen_levmar_der(CircuitSimulatorExporter::core_ladder_func, CircuitSimulatorExporter::core_ladder_jacobian, coefficients, coreResistances, numberUnknowns, numberElements, 10000, opts, info, NULL, NULL, static_cast<void*>(&dcResistanceAndfrequencies));
 
             double errorAverage = 0;
             for (size_t index = 0; index < frequenciesVector.size(); ++index) {
@@ -754,7 +1010,6 @@ std::vector<double> CircuitSimulatorExporter::calculate_core_resistance_coeffici
             }
 
             errorAverage /= frequenciesVector.size();
-            initialState /= 10;
 
             if (errorAverage < bestError) {
                 bestError = errorAverage;
@@ -796,9 +1051,21 @@ std::vector<std::vector<double>> calculate_ac_resistance_coefficients_per_windin
             acResistances[index] = points[index];
         }
 
+        // R = x0 + x1 sqrt(f) + x2 f is linear in x: its least-squares solution
+        // is the starting point and the fit only polishes it.
+        Eigen::MatrixXd design(numPoints, numberUnknowns);
+        Eigen::VectorXd target(numPoints);
+        for (size_t index = 0; index < numPoints; ++index) {
+            design(index, 0) = 1;
+            design(index, 1) = sqrt(frequenciesVector[index]);
+            design(index, 2) = frequenciesVector[index];
+            target(index) = acResistances[index];
+        }
+        Eigen::VectorXd startingPoint = design.colPivHouseholderQr().solve(target);
+
         double coefficients[numberUnknowns];
         for (size_t index = 0; index < numberUnknowns; ++index) {
-            coefficients[index] = 1;
+            coefficients[index] = std::isfinite(startingPoint(index)) ? startingPoint(index) : 1;
         }
         double opts[5], info[10];
 
@@ -818,7 +1085,7 @@ std::vector<std::vector<double>> calculate_ac_resistance_coefficients_per_windin
             frequencies[index] = frequenciesVector[index];
         }
 
-        eigen_levmar_dif(CircuitSimulatorExporter::analytical_func, coefficients, acResistances, numberUnknowns, numberElements, 10000, opts, info, NULL, NULL, static_cast<void*>(&frequencies));
+        eigen_levmar_der(CircuitSimulatorExporter::analytical_func, CircuitSimulatorExporter::analytical_jacobian, coefficients, acResistances, numberUnknowns, numberElements, 10000, opts, info, NULL, NULL, static_cast<void*>(&frequencies));
 
         acResistanceCoefficientsPerWinding.push_back(std::vector<double>());
         for (auto coefficient : coefficients) {
@@ -926,21 +1193,48 @@ std::vector<std::vector<double>> calculate_ac_resistance_coefficients_per_windin
             dcResistanceAndFrequencies[index + 1] = frequenciesVector[index];
         }
 
-        double coefficients[2];
-        coefficients[0] = 1e-4; // Initial guess for h
-        coefficients[1] = 0.5;  // Initial guess for alpha (skin effect)
+        // Starting points: the historical guess (h = 1e-4, alpha = 0.5), then
+        // alpha = 0.5 (skin), 0.75 and 1 (proximity-dominated) with h chosen so
+        // the model meets the swept excess resistance at the top frequency.
+        // The fit with the lowest average relative error wins.
+        double topExcess = acResistances[numPoints - 1] - acResistances[0];
+        double topAngularFrequency = 2 * std::numbers::pi * frequenciesVector[numPoints - 1];
+        std::vector<std::pair<double, double>> startingPoints = {{1e-4, 0.5}};
+        if (topExcess > 0) {
+            for (double alpha : {0.5, 0.75, 1.0}) {
+                startingPoints.push_back({topExcess / pow(topAngularFrequency, alpha), alpha});
+            }
+        }
 
-        double opts[5], info[10];
-        opts[0] = 1e-03;
-        opts[1] = 1e-25;
-        opts[2] = 1e-25;
-        opts[3] = 1e-25;
-        opts[4] = 1e-19;
+        double bestError = DBL_MAX;
+        double coefficients[2] = {1e-4, 0.5};
+        for (auto [hStart, alphaStart] : startingPoints) {
+            double candidate[2] = {hStart, alphaStart};
 
-        eigen_levmar_dif(CircuitSimulatorExporter::fracpole_skin_func,
-                         coefficients, acResistances, numberUnknowns, numberElements,
-                         10000, opts, info, NULL, NULL,
-                         static_cast<void*>(&dcResistanceAndFrequencies));
+            double opts[5], info[10];
+            opts[0] = 1e-03;
+            opts[1] = 1e-25;
+            opts[2] = 1e-25;
+            opts[3] = 1e-25;
+            opts[4] = 1e-19;
+
+            eigen_levmar_der(CircuitSimulatorExporter::fracpole_skin_func, CircuitSimulatorExporter::fracpole_skin_jacobian,
+                             candidate, acResistances, numberUnknowns, numberElements,
+                             10000, opts, info, NULL, NULL,
+                             static_cast<void*>(&dcResistanceAndFrequencies));
+
+            double errorAverage = 0;
+            for (size_t index = 0; index < numFreqs; ++index) {
+                double modeled = acResistances[0] + CircuitSimulatorExporter::fracpole_skin_model(candidate, frequenciesVector[index]);
+                errorAverage += fabs(acResistances[index] - modeled) / acResistances[index];
+            }
+            errorAverage /= numFreqs;
+            if (errorAverage < bestError || bestError == DBL_MAX) {
+                bestError = errorAverage;
+                coefficients[0] = candidate[0];
+                coefficients[1] = candidate[1];
+            }
+        }
 
         double h_fit = std::max(coefficients[0], 1e-15);
         double alpha_fit = std::clamp(coefficients[1], 0.1, 1.0);
@@ -956,6 +1250,13 @@ std::vector<std::vector<double>> calculate_ac_resistance_coefficients_per_windin
 
 
 std::vector<std::vector<double>> CircuitSimulatorExporter::calculate_ac_resistance_coefficients_per_winding(Magnetic magnetic, double temperature, CircuitSimulatorExporterCurveFittingModes mode) {
+    auto key = get_curve_fitting_cache_key("ac", static_cast<int>(mode), magnetic, temperature);
+    return get_or_fit_curve(key, [&]() {
+        return fit_ac_resistance_coefficients_per_winding(magnetic, temperature, mode);
+    });
+}
+
+std::vector<std::vector<double>> CircuitSimulatorExporter::fit_ac_resistance_coefficients_per_winding(Magnetic magnetic, double temperature, CircuitSimulatorExporterCurveFittingModes mode) {
     if (mode == CircuitSimulatorExporterCurveFittingModes::LADDER) {
         return calculate_ac_resistance_coefficients_per_winding_ladder(magnetic, temperature);
     }
@@ -1026,6 +1327,20 @@ static void mutual_resistance_ladder_func(double *p, double *x, int m, int n, vo
     }
 }
 
+static void mutual_resistance_ladder_jacobian(double *p, double *jac, int m, int n, void *data) {
+    MutualResistanceFitData* fitData = static_cast<MutualResistanceFitData*>(data);
+    double dcResistance = fitData->dcMutualResistance;
+
+    for (int i = 0; i < n; ++i) {
+        double* row = jac + i * m;
+        if (mutual_resistance_ladder_model(p, fitData->frequencies[i], dcResistance) >= 1e30) {
+            std::fill(row, row + m, 0.0);
+            continue;
+        }
+        ladder_gradient(p, 3, fitData->frequencies[i], row);
+    }
+}
+
 std::vector<CircuitSimulatorExporter::MutualResistanceCoefficients> 
 CircuitSimulatorExporter::calculate_mutual_resistance_coefficients(Magnetic magnetic, double temperature) {
     const size_t numberUnknowns = 6;  // 3 R-L pairs for mutual resistance
@@ -1119,7 +1434,7 @@ CircuitSimulatorExporter::calculate_mutual_resistance_coefficients(Magnetic magn
                     targetValues[idx] = mutualResistances[idx];
                 }
                 
-                eigen_levmar_dif(mutual_resistance_ladder_func, coefficients, targetValues, 
+                eigen_levmar_der(mutual_resistance_ladder_func, mutual_resistance_ladder_jacobian, coefficients, targetValues, 
                                  numberUnknowns, numberElements, 5000, opts, info, NULL, NULL,
                                  static_cast<void*>(&fitData));
                 
@@ -1760,20 +2075,9 @@ std::string emit_stray_capacitance_spice(const Coil& coil, size_t numWindings) {
 
 
 
-// Strip leading/trailing whitespace (and CR) in place.
-static void trim_inplace(std::string& s) {
-    size_t start = 0;
-    while (start < s.size() && (static_cast<unsigned char>(s[start]) <= 32)) ++start;
-    size_t end = s.size();
-    while (end > start && (static_cast<unsigned char>(s[end - 1]) <= 32)) --end;
-    if (start > 0 || end < s.size()) {
-        s = s.substr(start, end - start);
-    }
-}
-
 // Decide whether a CSV line should be ignored entirely (blank or comment).
 // Comment prefixes accepted: '#', '!', '*' (SPICE), "//".
-static bool is_skippable_csv_line(const std::string& line) {
+static bool is_skippable_csv_line(std::string_view line) {
     if (line.empty()) return true;
     size_t i = 0;
     while (i < line.size() && static_cast<unsigned char>(line[i]) <= 32) ++i;
@@ -1785,28 +2089,29 @@ static bool is_skippable_csv_line(const std::string& line) {
 }
 
 // Strip a UTF-8 BOM (EF BB BF) if present at the start of the string.
-static void strip_utf8_bom(std::string& s) {
+static void strip_utf8_bom(std::string_view& s) {
     if (s.size() >= 3 &&
         static_cast<unsigned char>(s[0]) == 0xEF &&
         static_cast<unsigned char>(s[1]) == 0xBB &&
         static_cast<unsigned char>(s[2]) == 0xBF) {
-        s.erase(0, 3);
+        s.remove_prefix(3);
     }
 }
 
-std::vector<std::string> CircuitSimulationReader::split_fields(const std::string& line, char separator) {
-    // Mirrors getline(ss, token, separator) but treats a separator as literal
-    // when it sits inside a double-quoted field or inside balanced parentheses.
-    // Parenthesis-awareness is what keeps LTspice differential probes like
-    // V(N009,d) from being split into two columns on a comma-separated file.
-    std::vector<std::string> fields;
-    std::string current;
+// Mirrors getline(ss, token, separator) but treats a separator as literal
+// when it sits inside a double-quoted field or inside balanced parentheses.
+// Parenthesis-awareness is what keeps LTspice differential probes like
+// V(N009,d) from being split into two columns on a comma-separated file.
+// Fields are handed to onField as views into line, quotes included.
+template<typename FieldCallback>
+static void for_each_field(std::string_view line, char separator, FieldCallback&& onField) {
+    size_t fieldStart = 0;
     bool inQuotes = false;
     int parenDepth = 0;
-    for (char c : line) {
+    for (size_t index = 0; index < line.size(); ++index) {
+        char c = line[index];
         if (c == '"') {
             inQuotes = !inQuotes;
-            current.push_back(c);  // keep quotes; the caller strips surrounding ones
             continue;
         }
         if (!inQuotes) {
@@ -1818,13 +2123,56 @@ std::vector<std::string> CircuitSimulationReader::split_fields(const std::string
             }
         }
         if (c == separator && !inQuotes && parenDepth == 0) {
-            fields.push_back(current);
-            current.clear();
-            continue;
+            onField(line.substr(fieldStart, index - fieldStart));
+            fieldStart = index + 1;
         }
-        current.push_back(c);
     }
-    fields.push_back(current);
+    onField(line.substr(fieldStart));
+}
+
+// CR anywhere, then surrounding quotes, then surrounding whitespace, in the
+// order the header and data rows have always been cleaned. Only a field
+// carrying a CR is copied (into scratch).
+static std::string_view clean_field(std::string_view token, std::string& scratch) {
+    if (token.find('\r') != std::string_view::npos) {
+        scratch.assign(token);
+        scratch.erase(std::remove(scratch.begin(), scratch.end(), '\r'), scratch.end());
+        token = scratch;
+    }
+    if (token.size() >= 2 && token.front() == '"' && token.back() == '"') {
+        token = token.substr(1, token.size() - 2);
+    }
+    while (!token.empty() && static_cast<unsigned char>(token.front()) <= 32) {
+        token.remove_prefix(1);
+    }
+    while (!token.empty() && static_cast<unsigned char>(token.back()) <= 32) {
+        token.remove_suffix(1);
+    }
+    return token;
+}
+
+// std::from_chars when it takes the whole token, which covers every plain
+// decimal a simulator writes. Anything else (hex, trailing units, overflow)
+// goes through std::stod exactly as before, including its exceptions.
+static double parse_field(std::string_view token) {
+    const char* first = token.data();
+    const char* last = token.data() + token.size();
+    if (first != last && *first == '+' && (last - first < 2 || (first[1] != '+' && first[1] != '-'))) {
+        ++first;  // std::stod accepts a leading '+', std::from_chars does not
+    }
+    double value;
+    auto [end, error] = std::from_chars(first, last, value);
+    if (error == std::errc() && end == last) {
+        return value;
+    }
+    return std::stod(std::string(token));
+}
+
+std::vector<std::string> CircuitSimulationReader::split_fields(const std::string& line, char separator) {
+    std::vector<std::string> fields;
+    for_each_field(line, separator, [&](std::string_view field) {
+        fields.emplace_back(field);
+    });
     return fields;
 }
 
@@ -1833,72 +2181,493 @@ void CircuitSimulationReader::process_line(std::string line, char separator) {
 }
 
 void CircuitSimulationReader::process_line_with_context(const std::string& line, char separator, size_t lineNumber) {
-    if (_columns.size() == 0) {
-        // Header row: collect column names. Strip CR and surrounding quotes from each token.
-        for (std::string token : split_fields(line, separator)) {
-            // Strip CR anywhere in the token (handles CRLF files).
-            token.erase(std::remove(token.begin(), token.end(), '\r'), token.end());
-            // Strip surrounding quotes only (preserves quoted commas/separators within names).
-            if (token.size() >= 2 && token.front() == '"' && token.back() == '"') {
-                token = token.substr(1, token.size() - 2);
-            }
-            // Trim whitespace; many exports pad headers with spaces.
-            trim_inplace(token);
-            if (token.empty()) continue;
+    std::string scratch;
+    if (_numberHeaderFields == 0) {
+        // Header row: collect column names, cleaned like the data cells below.
+        // Quoted separators stay within names.
+        for_each_field(line, separator, [&](std::string_view field) {
+            auto token = clean_field(field, scratch);
+            if (token.empty()) return;
+            _numberHeaderFields++;
+            std::string name(token);
+            if (!keeps_column(name)) {
+                _columnIndexPerHeaderField.push_back(-1);
+                return;
+            }
+            _columnIndexPerHeaderField.push_back(static_cast<int>(_columns.size()));
             CircuitSimulationSignal circuitSimulationSignal;
-            circuitSimulationSignal.name = token;
+            circuitSimulationSignal.name = name;
             _columns.push_back(circuitSimulationSignal);
-        }
+        });
+        configure_period_window();
     }
     else {
         size_t currentColumnIndex = 0;
-        for (std::string token : split_fields(line, separator)) {
-            // Same CR/quote/whitespace cleanup as the header so a stray CR in the
-            // last field of a CRLF file does not break std::stod.
-            token.erase(std::remove(token.begin(), token.end(), '\r'), token.end());
-            if (token.size() >= 2 && token.front() == '"' && token.back() == '"') {
-                token = token.substr(1, token.size() - 2);
-            }
-            trim_inplace(token);
+        for_each_field(line, separator, [&](std::string_view field) {
+            // Same cleanup as the header so a stray CR in the last field of a
+            // CRLF file does not break the number parsing.
+            auto token = clean_field(field, scratch);
             if (token.empty()) {
                 // An empty cell means "no sample for this column on this row".
                 // The column index must still advance, otherwise every later
                 // value on the row lands in the wrong column.
                 currentColumnIndex++;
-                continue;
+                return;
             }
-            if (currentColumnIndex >= _columns.size()) {
+            if (currentColumnIndex >= _numberHeaderFields) {
                 throw InvalidInputException(ErrorCode::INVALID_INPUT,
                     "Data row " + std::to_string(lineNumber) +
                     " has more columns than the header (" +
-                    std::to_string(_columns.size()) + ")");
+                    std::to_string(_numberHeaderFields) + ")");
+            }
+            int columnIndex = _columnIndexPerHeaderField[currentColumnIndex];
+            if (columnIndex < 0) {
+                currentColumnIndex++;
+                return;
             }
             double value;
             try {
-                size_t consumed = 0;
-                value = std::stod(token, &consumed);
-                (void)consumed;
+                value = parse_field(token);
             }
             catch (const std::exception&) {
                 throw InvalidInputException(ErrorCode::INVALID_INPUT,
                     "Could not parse number on line " + std::to_string(lineNumber) +
                     ", column " + std::to_string(currentColumnIndex + 1) + " (\"" +
-                    _columns[currentColumnIndex].name + "\"): \"" + token + "\"");
+                    _columns[columnIndex].name + "\"): \"" + std::string(token) + "\"");
             }
-            _columns[currentColumnIndex].data.push_back(value);
+            _columns[columnIndex].data.push_back(value);
             currentColumnIndex++;
+        });
+        if (_windowTimeColumnIndex && _columns[*_windowTimeColumnIndex].data.size() >= _windowTrimLength) {
+            trim_to_period_window();
         }
     }
 }
 
-CircuitSimulationReader::CircuitSimulationReader(std::string filePathOrFile, bool forceFile) {
-    char separator = '\0';
+bool CircuitSimulationReader::keeps_column(const std::string& name) {
+    return _readOptions.columnNames.empty() ||
+           std::find(_readOptions.columnNames.begin(), _readOptions.columnNames.end(), name) != _readOptions.columnNames.end() ||
+           guess_type_by_name(name) == DataType::TIME;
+}
+
+void CircuitSimulationReader::configure_period_window() {
+    _windowTimeColumnIndex = std::nullopt;
+    if (!_readOptions.frequency || _readOptions.frequency.value() <= 0) {
+        return;
+    }
+    for (size_t columnIndex = 0; columnIndex < _columns.size(); ++columnIndex) {
+        if (guess_type_by_name(_columns[columnIndex].name) == DataType::TIME) {
+            if (_windowTimeColumnIndex) {
+                // Several acquisitions side by side: rows of one axis say
+                // nothing about the other's period, so keep everything.
+                _windowTimeColumnIndex = std::nullopt;
+                return;
+            }
+            _windowTimeColumnIndex = columnIndex;
+        }
+    }
+    _windowDuration = _readOptions.periodsToRetain / _readOptions.frequency.value();
+    _windowTrimLength = 1024;
+}
+
+// Index of the last sample at or before time.back() - duration, so that
+// get_one_period() always finds a sample at the start of its window.
+static size_t get_first_sample_in_window(const std::vector<double>& time, double duration) {
+    double windowStart = time.back() - duration;
+    size_t firstKept = 0;
+    while (firstKept + 1 < time.size() && time[firstKept + 1] <= windowStart) {
+        ++firstKept;
+    }
+    return firstKept;
+}
+
+// Drops the rows that end before the retained window, keeping one sample at
+// or before its start for get_one_period(). Trimming waits until the columns
+// have doubled since the last trim, so each row is moved O(1) times.
+void CircuitSimulationReader::trim_to_period_window() {
+    auto& time = _columns[*_windowTimeColumnIndex].data;
+    for (auto& column : _columns) {
+        if (column.data.size() != time.size()) {
+            // A missing cell misaligns the rows; from here on keep everything.
+            _windowTimeColumnIndex = std::nullopt;
+            return;
+        }
+    }
+    size_t firstKept = get_first_sample_in_window(time, _windowDuration);
+    if (firstKept > 0) {
+        for (auto& column : _columns) {
+            column.data.erase(column.data.begin(), column.data.begin() + firstKept);
+        }
+    }
+    _windowTrimLength = std::max<size_t>(1024, 2 * time.size());
+}
+
+// =============================================================================
+// SPICE RAW FILES
+// =============================================================================
+// Layout shared by ngspice and LTspice: a text header of "Key: value" lines
+// ("Plotname", "Flags", "No. Variables", "No. Points", "Command", then
+// "Variables:" followed by one indented "index name type" line per vector)
+// ending in "Binary:" or "Values:", then the data. A file can hold several
+// plots back to back. Binary data is little-endian and point by point (all
+// vectors of point 0, then point 1, ...) unless the flags say "fastaccess",
+// in which case it is vector by vector. ngspice writes every value as a
+// double (two for complex). LTspice writes its header in UTF-16LE and, for
+// real plots without the "double" flag, stores the scale as a double and
+// every other vector as a float; it also flags compressed time points with
+// a negative sign.
+
+namespace {
+
+// Read-only std::streambuf over memory that is not owned, so in-memory raw
+// data is parsed without a copy.
+class MemoryStreamBuffer : public std::streambuf {
+    public:
+        MemoryStreamBuffer(const char* data, size_t size) {
+            char* begin = const_cast<char*>(data);
+            setg(begin, begin, begin + size);
+        }
+
+    protected:
+        pos_type seekoff(off_type offset, std::ios_base::seekdir direction, std::ios_base::openmode) override {
+            char* base = direction == std::ios_base::beg ? eback() : direction == std::ios_base::cur ? gptr() : egptr();
+            if (base + offset < eback() || base + offset > egptr()) {
+                return pos_type(off_type(-1));
+            }
+            setg(eback(), base + offset, egptr());
+            return pos_type(gptr() - eback());
+        }
+        pos_type seekpos(pos_type position, std::ios_base::openmode mode) override {
+            return seekoff(off_type(position), std::ios_base::beg, mode);
+        }
+};
+
+struct SpiceRawPlot {
+    std::string name;
+    std::vector<std::string> variableNames;
+    size_t numberPoints = 0;
+    bool isComplex = false;
+    bool isDouble = false;
+    bool isFastAccess = false;
+    bool isBinary = true;
+    bool isLtspice = false;
+};
+
+bool read_spice_raw_header_line(std::istream& stream, bool isUtf16, std::string& line) {
+    line.clear();
+    char c;
+    bool readAny = false;
+    while (stream.get(c)) {
+        if (isUtf16) {
+            char highByte;
+            if (!stream.get(highByte)) {
+                break;
+            }
+        }
+        readAny = true;
+        if (c == '\n') {
+            break;
+        }
+        line.push_back(c);
+    }
+    if (!line.empty() && line.back() == '\r') {
+        line.pop_back();
+    }
+    return readAny;
+}
+
+// The next plot header, or std::nullopt at the end of the file.
+std::optional<SpiceRawPlot> read_spice_raw_header(std::istream& stream, bool isUtf16) {
+    SpiceRawPlot plot;
+    plot.isLtspice = isUtf16;
     std::string line;
+    bool inVariables = false;
+    bool readAny = false;
+    while (read_spice_raw_header_line(stream, isUtf16, line)) {
+        if (line.empty() && !readAny) {
+            continue;
+        }
+        readAny = true;
+        if (inVariables && !line.empty() && std::isspace(static_cast<unsigned char>(line.front()))) {
+            std::istringstream fields(line);
+            std::string index, name;
+            fields >> index >> name;
+            plot.variableNames.push_back(name);
+            continue;
+        }
+        inVariables = false;
+        size_t colon = line.find(':');
+        if (colon == std::string::npos) {
+            continue;
+        }
+        std::string key = line.substr(0, colon);
+        std::string value = line.substr(colon + 1);
+        value.erase(0, value.find_first_not_of(" \t"));
+        if (key == "Plotname") {
+            plot.name = value;
+        }
+        else if (key == "Flags") {
+            std::istringstream flags(value);
+            std::string flag;
+            while (flags >> flag) {
+                plot.isComplex = plot.isComplex || flag == "complex";
+                plot.isDouble = plot.isDouble || flag == "double";
+                plot.isFastAccess = plot.isFastAccess || flag == "fastaccess";
+            }
+        }
+        else if (key == "No. Points") {
+            plot.numberPoints = std::stoull(value);
+        }
+        else if (key == "Command") {
+            plot.isLtspice = plot.isLtspice || value.find("LTspice") != std::string::npos || value.find("Linear Technology") != std::string::npos;
+        }
+        else if (key == "Variables") {
+            inVariables = true;
+        }
+        else if (key == "Binary" || key == "Values") {
+            plot.isBinary = key == "Binary";
+            if (plot.variableNames.empty()) {
+                throw InvalidInputException(ErrorCode::INVALID_INPUT, "SPICE raw plot \"" + plot.name + "\" declares no variables");
+            }
+            return plot;
+        }
+    }
+    if (readAny) {
+        throw InvalidInputException(ErrorCode::INVALID_INPUT, "SPICE raw header ends without a Binary: or Values: section");
+    }
+    return std::nullopt;
+}
+
+size_t get_spice_raw_value_size(const SpiceRawPlot& plot, size_t variableIndex) {
+    if (plot.isComplex) {
+        return 2 * sizeof(double);
+    }
+    if (!plot.isLtspice || plot.isDouble || variableIndex == 0) {
+        return sizeof(double);
+    }
+    return sizeof(float);
+}
+
+// Decodes one little-endian value into real and imaginary parts.
+std::pair<double, double> decode_spice_raw_value(const char* bytes, size_t size) {
+    if (size == sizeof(float)) {
+        float value;
+        std::memcpy(&value, bytes, sizeof(float));
+        return {value, 0};
+    }
+    double real;
+    double imaginary = 0;
+    std::memcpy(&real, bytes, sizeof(double));
+    if (size == 2 * sizeof(double)) {
+        std::memcpy(&imaginary, bytes + sizeof(double), sizeof(double));
+    }
+    return {real, imaginary};
+}
+
+// Skips the data of a plot that is not loaded.
+void skip_spice_raw_data(std::istream& stream, const SpiceRawPlot& plot) {
+    if (plot.isBinary) {
+        size_t pointSize = 0;
+        for (size_t variableIndex = 0; variableIndex < plot.variableNames.size(); ++variableIndex) {
+            pointSize += get_spice_raw_value_size(plot, variableIndex);
+        }
+        stream.seekg(static_cast<std::streamoff>(pointSize * plot.numberPoints), std::ios_base::cur);
+        return;
+    }
+    std::string token;
+    for (size_t index = 0; index < plot.numberPoints * (plot.variableNames.size() + 1) && stream >> token; ++index) {
+    }
+}
+
+} // namespace
+
+bool CircuitSimulationReader::is_spice_raw(std::string_view head) {
+    if (head.starts_with("\xFF\xFE")) {
+        head.remove_prefix(2);
+    }
+    else if (head.starts_with("\xEF\xBB\xBF")) {
+        head.remove_prefix(3);
+    }
+    using namespace std::string_view_literals;
+    return head.starts_with("Title:") || head.starts_with("T\0i\0t\0l\0e\0:\0"sv);
+}
+
+void CircuitSimulationReader::read_spice_raw(std::istream& stream) {
+    char head[3] = {};
+    stream.read(head, sizeof(head));
+    std::string_view headView(head, static_cast<size_t>(stream.gcount()));
+    size_t bomSize = headView.starts_with("\xEF\xBB\xBF") ? 3 : headView.starts_with("\xFF\xFE") ? 2 : 0;
+    bool isUtf16 = bomSize == 2 || (headView.size() >= 2 && headView[1] == '\0');
+    stream.clear();
+    stream.seekg(static_cast<std::streamoff>(bomSize));
+
+    // The transient plot if there is one, otherwise the first.
+    std::optional<SpiceRawPlot> plot;
+    std::optional<std::pair<SpiceRawPlot, std::streampos>> firstPlot;
+    while (auto candidate = read_spice_raw_header(stream, isUtf16)) {
+        if (candidate->name.find("Transient") != std::string::npos) {
+            plot = candidate;
+            break;
+        }
+        if (!firstPlot) {
+            firstPlot = std::make_pair(*candidate, stream.tellg());
+        }
+        skip_spice_raw_data(stream, *candidate);
+        if (!stream) {
+            break;
+        }
+    }
+    if (!plot) {
+        if (!firstPlot) {
+            throw InvalidInputException(ErrorCode::INVALID_INPUT, "SPICE raw file holds no plot");
+        }
+        plot = firstPlot->first;
+        stream.clear();
+        stream.seekg(firstPlot->second);
+    }
+
+    // One column per real vector, two per complex one, unless projected out.
+    const size_t numberVariables = plot->variableNames.size();
+    std::vector<std::array<int, 2>> columnIndexesPerVariable(numberVariables, {-1, -1});
+    for (size_t variableIndex = 0; variableIndex < numberVariables; ++variableIndex) {
+        const auto& name = plot->variableNames[variableIndex];
+        std::array<std::string, 2> columnNames = {name, ""};
+        if (plot->isComplex) {
+            columnNames = {"Re(" + name + ")", "Im(" + name + ")"};
+        }
+        for (size_t part = 0; part < (plot->isComplex ? 2 : 1); ++part) {
+            if (variableIndex == 0 || keeps_column(columnNames[part])) {
+                columnIndexesPerVariable[variableIndex][part] = static_cast<int>(_columns.size());
+                CircuitSimulationSignal signal;
+                signal.name = columnNames[part];
+                signal.data.reserve(_readOptions.frequency ? 0 : plot->numberPoints);
+                _columns.push_back(signal);
+            }
+        }
+    }
+    configure_period_window();
+
+    auto store = [&](size_t variableIndex, std::pair<double, double> value) {
+        if (variableIndex == 0 && plot->isLtspice && !plot->isComplex) {
+            value.first = std::fabs(value.first);
+        }
+        for (size_t part = 0; part < 2; ++part) {
+            int columnIndex = columnIndexesPerVariable[variableIndex][part];
+            if (columnIndex >= 0) {
+                _columns[columnIndex].data.push_back(part == 0 ? value.first : value.second);
+            }
+        }
+    };
+    auto truncated = [&]() {
+        return InvalidInputException(ErrorCode::INVALID_INPUT,
+            "SPICE raw plot \"" + plot->name + "\" is truncated: expected " + std::to_string(plot->numberPoints) + " points");
+    };
+
+    if (!plot->isBinary) {
+        // "index value" on the first line of each point, one value per line
+        // after it; complex values are written "real,imaginary". LTspice
+        // writes these in UTF-16LE too, which is narrowed first.
+        std::istringstream narrowed;
+        if (isUtf16) {
+            std::string text((std::istreambuf_iterator<char>(stream)), std::istreambuf_iterator<char>());
+            text.erase(std::remove(text.begin(), text.end(), '\0'), text.end());
+            narrowed.str(std::move(text));
+        }
+        std::istream& values = isUtf16 ? narrowed : stream;
+        std::string token;
+        for (size_t point = 0; point < plot->numberPoints; ++point) {
+            if (!(values >> token)) {
+                throw truncated();
+            }
+            for (size_t variableIndex = 0; variableIndex < numberVariables; ++variableIndex) {
+                if (!(values >> token)) {
+                    throw truncated();
+                }
+                size_t comma = token.find(',');
+                double real = parse_field(std::string_view(token).substr(0, comma));
+                double imaginary = comma == std::string::npos ? 0 : parse_field(std::string_view(token).substr(comma + 1));
+                store(variableIndex, {real, imaginary});
+            }
+            if (_windowTimeColumnIndex && _columns[*_windowTimeColumnIndex].data.size() >= _windowTrimLength) {
+                trim_to_period_window();
+            }
+        }
+        return;
+    }
+
+    std::vector<size_t> valueSizes(numberVariables);
+    for (size_t variableIndex = 0; variableIndex < numberVariables; ++variableIndex) {
+        valueSizes[variableIndex] = get_spice_raw_value_size(*plot, variableIndex);
+    }
+
+    if (plot->isFastAccess) {
+        // Vector by vector: the scale comes first, so the retained window is
+        // known before any signal is read and the rest of each is skipped.
+        size_t firstKept = 0;
+        std::vector<char> bytes;
+        for (size_t variableIndex = 0; variableIndex < numberVariables; ++variableIndex) {
+            size_t valueSize = valueSizes[variableIndex];
+            bool kept = columnIndexesPerVariable[variableIndex][0] >= 0 || columnIndexesPerVariable[variableIndex][1] >= 0;
+            if (!kept) {
+                stream.seekg(static_cast<std::streamoff>(valueSize * plot->numberPoints), std::ios_base::cur);
+                continue;
+            }
+            stream.seekg(static_cast<std::streamoff>(valueSize * firstKept), std::ios_base::cur);
+            size_t numberValues = plot->numberPoints - firstKept;
+            bytes.resize(valueSize * numberValues);
+            if (!stream.read(bytes.data(), static_cast<std::streamsize>(bytes.size()))) {
+                throw truncated();
+            }
+            for (size_t value = 0; value < numberValues; ++value) {
+                store(variableIndex, decode_spice_raw_value(bytes.data() + value * valueSize, valueSize));
+            }
+            if (variableIndex == 0 && _windowTimeColumnIndex && numberValues > 0) {
+                auto& time = _columns[*_windowTimeColumnIndex].data;
+                firstKept = get_first_sample_in_window(time, _windowDuration);
+                time.erase(time.begin(), time.begin() + firstKept);
+                _windowTimeColumnIndex = std::nullopt;
+            }
+        }
+        return;
+    }
+
+    // Point by point, read in blocks of about 1 MiB.
+    size_t pointSize = 0;
+    for (auto valueSize : valueSizes) {
+        pointSize += valueSize;
+    }
+    size_t pointsPerBlock = std::max<size_t>(1, (1 << 20) / pointSize);
+    std::vector<char> block(pointsPerBlock * pointSize);
+    for (size_t point = 0; point < plot->numberPoints; point += pointsPerBlock) {
+        size_t numberBlockPoints = std::min(pointsPerBlock, plot->numberPoints - point);
+        if (!stream.read(block.data(), static_cast<std::streamsize>(numberBlockPoints * pointSize))) {
+            throw truncated();
+        }
+        const char* bytes = block.data();
+        for (size_t blockPoint = 0; blockPoint < numberBlockPoints; ++blockPoint) {
+            for (size_t variableIndex = 0; variableIndex < numberVariables; ++variableIndex) {
+                store(variableIndex, decode_spice_raw_value(bytes, valueSizes[variableIndex]));
+                bytes += valueSizes[variableIndex];
+            }
+            if (_windowTimeColumnIndex && _columns[*_windowTimeColumnIndex].data.size() >= _windowTrimLength) {
+                trim_to_period_window();
+            }
+        }
+    }
+}
+
+CircuitSimulationReader::CircuitSimulationReader(std::string filePathOrFile, bool forceFile)
+    : CircuitSimulationReader(std::move(filePathOrFile), ReadOptions(), forceFile) {}
+
+CircuitSimulationReader::CircuitSimulationReader(std::string filePathOrFile, ReadOptions readOptions, bool forceFile)
+    : _readOptions(std::move(readOptions)) {
+    char separator = '\0';
     size_t lineNumber = 0;
+    std::string line;
 
     std::filesystem::path path = filePathOrFile;
 
-    auto handle_line = [&](std::string& rawLine) {
+    auto handle_line = [&](std::string_view rawLine) {
         ++lineNumber;
         // Strip BOM on the very first line; harmless if absent.
         if (lineNumber == 1) {
@@ -1907,14 +2676,26 @@ CircuitSimulationReader::CircuitSimulationReader(std::string filePathOrFile, boo
         if (is_skippable_csv_line(rawLine)) {
             return;
         }
+        line.assign(rawLine);
         if (separator == '\0') {
-            separator = guess_separator(rawLine);
+            separator = guess_separator(line);
+        }
+        process_line_with_context(line, separator, lineNumber);
+    };
+
+    // Calls handle_line for every complete line in text and returns the
+    // offset of the unterminated tail.
+    auto handle_lines = [&](std::string_view text) {
+        size_t lineStart = 0;
+        for (size_t lineEnd = text.find('\n'); lineEnd != std::string_view::npos; lineEnd = text.find('\n', lineStart)) {
+            handle_line(text.substr(lineStart, lineEnd - lineStart));
+            lineStart = lineEnd + 1;
         }
-        process_line_with_context(rawLine, separator, lineNumber);
+        return lineStart;
     };
 
     if (path.has_parent_path() && !forceFile) {
-        std::ifstream is(filePathOrFile);
+        std::ifstream is(filePathOrFile, std::ios::binary);
         if (!is.is_open()) {
             if (!std::filesystem::exists(filePathOrFile)) {
                 throw InvalidInputException(ErrorCode::MISSING_DATA,
@@ -1923,15 +2704,43 @@ CircuitSimulationReader::CircuitSimulationReader(std::string filePathOrFile, boo
             throw InvalidInputException(ErrorCode::MISSING_DATA,
                 "Could not open file (check permissions): " + filePathOrFile);
         }
-        while (getline(is, line)) {
-            handle_line(line);
+        char head[16] = {};
+        is.read(head, sizeof(head));
+        bool isSpiceRaw = is_spice_raw(std::string_view(head, static_cast<size_t>(is.gcount())));
+        is.clear();
+        is.seekg(0);
+        if (isSpiceRaw) {
+            read_spice_raw(is);
+        }
+        else {
+            // Fixed-size chunks; a line split across two chunks is carried over.
+            const size_t chunkSize = 1 << 20;
+            std::string buffer;
+            size_t carried = 0;
+            while (is) {
+                buffer.resize(carried + chunkSize);
+                is.read(buffer.data() + carried, static_cast<std::streamsize>(chunkSize));
+                buffer.resize(carried + static_cast<size_t>(is.gcount()));
+                size_t consumed = handle_lines(buffer);
+                buffer.erase(0, consumed);
+                carried = buffer.size();
+            }
+            if (!buffer.empty()) {
+                handle_line(buffer);
+            }
         }
         is.close();
     }
+    else if (is_spice_raw(filePathOrFile)) {
+        MemoryStreamBuffer memory(filePathOrFile.data(), filePathOrFile.size());
+        std::istream stream(&memory);
+        read_spice_raw(stream);
+    }
     else {
-        std::stringstream ss(filePathOrFile);
-        while (std::getline(ss, line, '\n')) {
-            handle_line(line);
+        std::string_view text = filePathOrFile;
+        size_t consumed = handle_lines(text);
+        if (consumed < text.size()) {
+            handle_line(text.substr(consumed));
         }
     }
 
@@ -1959,7 +2768,7 @@ std::vector<std::string> CircuitSimulationReader::extract_column_names() {
     return names;
 }
 
-bool CircuitSimulationReader::can_be_time(std::vector<double> data) {
+bool CircuitSimulationReader::can_be_time(const std::vector<double>& data) {
     if (data.size() == 0) {
         throw std::invalid_argument("vector data cannot be empty");
     }
@@ -1983,7 +2792,7 @@ bool CircuitSimulationReader::can_be_time(std::vector<double> data) {
     return data.back() > data.front();
 }
 
-bool CircuitSimulationReader::can_be_voltage(std::vector<double> data, double limit) {
+bool CircuitSimulationReader::can_be_voltage(const std::vector<double>& data, double limit) {
     if (data.size() == 0) {
         throw std::invalid_argument("vector data cannot be empty");
     }
@@ -2025,7 +2834,7 @@ bool CircuitSimulationReader::can_be_voltage(std::vector<double> data, double li
     return result;
 }
 
-bool CircuitSimulationReader::can_be_current(std::vector<double> data, double limit) {
+bool CircuitSimulationReader::can_be_current(const std::vector<double>& data, double limit) {
     std::vector<double> diffValues;
     for (size_t index = 0; index < data.size(); index++) {
         double diff;
@@ -2206,11 +3015,12 @@ Waveform CircuitSimulationReader::get_one_period(Waveform waveform, double frequ
     }
 }
 
-CircuitSimulationReader::CircuitSimulationSignal CircuitSimulationReader::find_time(std::vector<CircuitSimulationReader::CircuitSimulationSignal> columns) {
-    for (auto column : columns) {
+CircuitSimulationReader::CircuitSimulationSignal CircuitSimulationReader::find_time(const std::vector<CircuitSimulationReader::CircuitSimulationSignal>& columns) {
+    for (const auto& column : columns) {
         if (can_be_time(column.data)) {
-            column.type = DataType::TIME;
-            return column;
+            auto time = column;
+            time.type = DataType::TIME;
+            return time;
         }
     }
     throw InvalidInputException(ErrorCode::MISSING_DATA, "no time column found");
@@ -2253,13 +3063,21 @@ Waveform CircuitSimulationReader::extract_waveform(CircuitSimulationReader::Circ
     return get_one_period(waveform, frequency, sample, true, timeSignal.name);
 }
 
-std::vector<int> get_numbers_in_string(std::string s) {
-    std::regex regex(R"(\d+)");   // matches a sequence of digits
+// Every run of decimal digits in s, in order.
+std::vector<int> get_numbers_in_string(const std::string& s) {
     std::vector<int> numbers;
-    std::smatch match;
-    while (std::regex_search(s, match, regex)) {
-        numbers.push_back(std::stoi(match.str()));
-        s = match.suffix();
+    size_t index = 0;
+    while (index < s.size()) {
+        if (!std::isdigit(static_cast<unsigned char>(s[index]))) {
+            ++index;
+            continue;
+        }
+        size_t runEnd = index;
+        while (runEnd < s.size() && std::isdigit(static_cast<unsigned char>(s[runEnd]))) {
+            ++runEnd;
+        }
+        numbers.push_back(std::stoi(s.substr(index, runEnd - index)));
+        index = runEnd;
     }
 
     return numbers;
@@ -2658,6 +3476,21 @@ void CircuitSimulatorExporter::fracpole_skin_func(double *p, double *x, int m, i
     }
 }
 
+void CircuitSimulatorExporter::fracpole_skin_jacobian(double *p, double *jac, int m, int n, void *data) {
+    double* dcResistanceAndFrequencies = static_cast<double*>(data);
+    for (int i = 0; i < n; ++i) {
+        double* row = jac + i * m;
+        if (fracpole_skin_model(p, dcResistanceAndFrequencies[i + 1]) >= 1e30) {
+            std::fill(row, row + m, 0.0);
+            continue;
+        }
+        double w = 2 * std::numbers::pi * dcResistanceAndFrequencies[i + 1];
+        double wPowAlpha = pow(w, p[1]);
+        row[0] = wPowAlpha;
+        row[1] = p[0] * wPowAlpha * log(w);
+    }
+}
+
 double CircuitSimulatorExporter::fracpole_model(double x[], int numCoeffs, double frequency, double dcResistance) {
     double w = 2 * std::numbers::pi * frequency;
     std::complex<double> Z(dcResistance, 0);
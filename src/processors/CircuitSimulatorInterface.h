@@ -5,6 +5,8 @@
 #include "support/Utils.h"
 #include <random>
 #include <chrono>
+#include <istream>
+#include <string_view>
 #include "support/Exceptions.h"
 
 using ordered_json = nlohmann::ordered_json;
@@ -53,17 +55,37 @@ struct LMFunctorWrapper : Eigen::DenseFunctor<double> {
     }
 };
 
-inline int eigen_levmar_dif(
-    void (*func)(double *p, double *x, int m, int n, void *data),
-    double *p, double *x, int m, int n, int itmax,
-    double *opts, double *info,
-    [[maybe_unused]] double *work,
-    [[maybe_unused]] double *covar,
-    void *data)
-{
-    LMFunctorWrapper functor(m, n, func, x, data);
-    Eigen::NumericalDiff<LMFunctorWrapper> numDiff(functor);
-    Eigen::LevenbergMarquardt<Eigen::NumericalDiff<LMFunctorWrapper>> lm(numDiff);
+// levmar's dlevmar_der() convention for a caller-supplied Jacobian:
+// jac[i * m + j] = d x[i] / d p[j], n rows of m parameters.
+struct LMAnalyticFunctorWrapper : LMFunctorWrapper {
+    using LevmarJacobian = void (*)(double *p, double *jac, int m, int n, void *data);
+
+    LevmarJacobian _jacobian;
+
+    LMAnalyticFunctorWrapper(int nParams, int nResiduals, LevmarFunc func, LevmarJacobian jacobian,
+                             const double* measurements, void* data)
+        : LMFunctorWrapper(nParams, nResiduals, func, measurements, data)
+        , _jacobian(jacobian) {}
+
+    int df(const Eigen::VectorXd& x, Eigen::MatrixXd& fjac) const {
+        std::vector<double> jacobian(static_cast<size_t>(values() * inputs()));
+        std::vector<double> paramsCopy(x.data(), x.data() + inputs());
+
+        _jacobian(paramsCopy.data(), jacobian.data(), static_cast<int>(inputs()), static_cast<int>(values()), _data);
+
+        for (int i = 0; i < values(); ++i) {
+            for (int j = 0; j < inputs(); ++j) {
+                fjac(i, j) = jacobian[static_cast<size_t>(i * inputs() + j)];
+            }
+        }
+        return 0;
+    }
+};
+
+template<typename Functor>
+int eigen_levmar_minimize(Functor& functor, const LMFunctorWrapper& residuals,
+                          double *p, int m, int n, int itmax, double *opts, double *info) {
+    Eigen::LevenbergMarquardt<Functor> lm(functor);
 
     // Set parameters using the public member directly
     lm.setMaxfev(itmax * (m + 1));
@@ -85,7 +107,7 @@ inline int eigen_levmar_dif(
     double initialNorm = 0.0;
     if (info != nullptr) {
         Eigen::VectorXd initialResiduals(n);
-        functor(params, initialResiduals);
+        residuals(params, initialResiduals);
         initialNorm = initialResiduals.squaredNorm();
     }
 
@@ -111,6 +133,35 @@ inline int eigen_levmar_dif(
     return static_cast<int>(lm.iterations());
 }
 
+inline int eigen_levmar_dif(
+    void (*func)(double *p, double *x, int m, int n, void *data),
+    double *p, double *x, int m, int n, int itmax,
+    double *opts, double *info,
+    [[maybe_unused]] double *work,
+    [[maybe_unused]] double *covar,
+    void *data)
+{
+    LMFunctorWrapper functor(m, n, func, x, data);
+    Eigen::NumericalDiff<LMFunctorWrapper> numDiff(functor);
+    return eigen_levmar_minimize(numDiff, functor, p, m, n, itmax, opts, info);
+}
+
+// As eigen_levmar_dif(), with the Jacobian from jacf instead of forward
+// differences: one Jacobian call per iteration instead of m model calls, and
+// no difference step to tune against the parameter scale.
+inline int eigen_levmar_der(
+    void (*func)(double *p, double *x, int m, int n, void *data),
+    void (*jacf)(double *p, double *jac, int m, int n, void *data),
+    double *p, double *x, int m, int n, int itmax,
+    double *opts, double *info,
+    [[maybe_unused]] double *work,
+    [[maybe_unused]] double *covar,
+    void *data)
+{
+    LMAnalyticFunctorWrapper functor(m, n, func, jacf, x, data);
+    return eigen_levmar_minimize(functor, functor, p, m, n, itmax, opts, info);
+}
+
 } // namespace OpenMagnetics
 
 
@@ -482,6 +533,8 @@ class CircuitSimulatorExporterModel {
 
 class CircuitSimulatorExporter {
     private:
+        static std::vector<std::vector<double>> fit_ac_resistance_coefficients_per_winding(Magnetic magnetic, double temperature, CircuitSimulatorExporterCurveFittingModes mode);
+        static std::vector<double> fit_core_resistance_coefficients(Magnetic magnetic, double temperature, CoreLossTopology topology);
     protected:
         std::shared_ptr<CircuitSimulatorExporterModel> _model;
     public:
@@ -490,17 +543,22 @@ class CircuitSimulatorExporter {
 
         static double analytical_model(double x[], double frequency);
         static void analytical_func(double *p, double *x, int m, int n, void *data);
+        static void analytical_jacobian(double *p, double *jac, int m, int n, void *data);
         static double ladder_model(double x[], double frequency, double dcResistance);
         static void ladder_func(double *p, double *x, int m, int n, void *data);
+        static void ladder_jacobian(double *p, double *jac, int m, int n, void *data);
         static double core_ladder_model(double x[], double frequency, double dcResistance);
         static void core_ladder_func(double *p, double *x, int m, int n, void *data);
+        static void core_ladder_jacobian(double *p, double *jac, int m, int n, void *data);
         static double core_rosano_model(double x[], double frequency);
         static void core_rosano_func(double *p, double *x, int m, int n, void *data);
+        static void core_rosano_jacobian(double *p, double *jac, int m, int n, void *data);
 
         // Rosano winding model: Z = Rdc + sum_k(Rk || jwLk)  [flat series of parallel R||L cells]
         // coefficients: [R1, L1, R2, L2, ..., R6, L6]  (12 unknowns, 6 stages)
         static double winding_rosano_model(double x[], double frequency, double dcResistance);
         static void winding_rosano_func(double *p, double *x, int m, int n, void *data);
+        static void winding_rosano_jacobian(double *p, double *jac, int m, int n, void *data);
 
         // Rosano RLC winding model: Z = Rdc + (R1||L1) + ... + (R(n-1)||L(n-1)) + (Rn||(Ln+Cn))
         // Extends Rosano model with one RLC stage for better high-frequency accuracy
@@ -509,10 +567,22 @@ class CircuitSimulatorExporter {
         // nRLCStages: number of RLC stages (currently 0 or 1 supported)
         static double winding_rosano_rlc_model(double x[], int nStages, int nRLCStages, double frequency, double dcResistance);
         static void winding_rosano_rlc_func(double *p, double *x, int m, int n, void *data);
+        static void winding_rosano_rlc_jacobian(double *p, double *jac, int m, int n, void *data);
 
         static double fracpole_skin_model(double x[], double frequency);
         static void fracpole_skin_func(double *p, double *x, int m, int n, void *data);
+        static void fracpole_skin_jacobian(double *p, double *jac, int m, int n, void *data);
         static double fracpole_model(double x[], int numCoeffs, double frequency, double dcResistance);
+        // The *_jacobian functions fill jac[i * m + j] = d x[i] / d p[j] for the
+        // matching *_func, for eigen_levmar_der(). Rows where the model returns
+        // its 1e30 out-of-domain penalty are zero.
+
+        // Fitted AC- and core-resistance coefficients are memoized per magnetic,
+        // temperature and mode (or topology), together with
+        // Settings::get_fingerprint() and get_databases_generation(), so exporting
+        // one design to several simulators fits it once. Shared between threads.
+        static void clear_curve_fitting_cache();
+        static size_t get_curve_fitting_cache_size();
 
         static std::vector<std::vector<double>> calculate_ac_resistance_coefficients_per_winding(Magnetic magnetic, double temperature, CircuitSimulatorExporterCurveFittingModes mode = CircuitSimulatorExporterCurveFittingModes::LADDER);
         
@@ -655,6 +725,21 @@ class CircuitSimulationReader {
         UNKNOWN
     };
 
+    // What to keep while reading a large simulator dump. Rows are parsed in
+    // place whatever the options; these bound what stays in memory.
+    struct ReadOptions {
+        // Header names of the columns to keep; empty keeps every column.
+        // Time-like columns (see guess_type_by_name()) are always kept.
+        std::vector<std::string> columnNames;
+        // When set, only the last periodsToRetain periods at this frequency
+        // are kept, trimmed as the rows arrive: enough for get_one_period()
+        // and extract_operating_point() at the same frequency, including the
+        // walk back to a zero crossing. Applies to files with a single
+        // time-like column and no missing cells; otherwise everything is kept.
+        std::optional<double> frequency;
+        double periodsToRetain = 2;
+    };
+
   private:
     class CircuitSimulationSignal {
         public:
@@ -689,12 +774,37 @@ class CircuitSimulationReader {
     std::vector<std::string> _currentPrefixes = {"I"};
     std::vector<std::string> _voltagePrefixes = {"V"};
 
+    ReadOptions _readOptions;
+    // Index into _columns for each header field, or -1 for a projected-out
+    // field. Empty header tokens are skipped, as they always have been.
+    std::vector<int> _columnIndexPerHeaderField;
+    size_t _numberHeaderFields = 0;
+    // Period-window state: the time column index, the retained duration and
+    // the column length at which the next trim runs.
+    std::optional<size_t> _windowTimeColumnIndex;
+    double _windowDuration = 0;
+    size_t _windowTrimLength = 0;
+
+    bool keeps_column(const std::string& name);
+    void configure_period_window();
+    void trim_to_period_window();
+    void read_spice_raw(std::istream& stream);
+
   public:
 
     CircuitSimulationReader() = default;
     virtual ~CircuitSimulationReader() = default;
 
     CircuitSimulationReader(std::string filePathOrFile, bool forceFile=false);
+    // Files are read in fixed-size chunks rather than line by line, and the
+    // in-memory text is split without copying it.
+    //
+    // SPICE raw files (ngspice and LTspice, see is_spice_raw()) are read
+    // natively instead of as delimited text: binary or ASCII values, real or
+    // complex, double or LTspice's single-precision signals. The transient
+    // plot is taken when the file holds several, otherwise the first one.
+    // Complex vectors become "Re(name)" and "Im(name)" columns.
+    CircuitSimulationReader(std::string filePathOrFile, ReadOptions readOptions, bool forceFile=false);
 
     void process_line(std::string line, char separator);
     void process_line_with_context(const std::string& line, char separator, size_t lineNumber);
@@ -710,18 +820,21 @@ class CircuitSimulationReader {
     // the signal's winding). The single-argument overload above keeps pairing
     // with the file's first time-like column for auto-detected imports.
     Waveform extract_waveform(CircuitSimulationSignal signal, const CircuitSimulationSignal& timeSignal, double frequency, bool sample=true);
-    static CircuitSimulationSignal find_time(std::vector<CircuitSimulationSignal> columns);
+    static CircuitSimulationSignal find_time(const std::vector<CircuitSimulationSignal>& columns);
     Waveform get_one_period(Waveform waveform, double frequency, bool sample=true, bool alignToZeroCrossing=true, const std::string& timeAxisName="");
     static char guess_separator(std::string line);
+    // True when head starts like a SPICE raw file: "Title:" in 8-bit text or
+    // in UTF-16LE (LTspice), with or without a byte-order mark.
+    static bool is_spice_raw(std::string_view head);
     // Split a line on `separator`, ignoring any separator that falls inside a
     // double-quoted field OR inside balanced parentheses. The latter keeps
     // SPICE differential probes such as LTspice's V(node_p,node_n) intact when
     // the file is comma-separated. Quotes are preserved in the returned tokens
     // (callers strip surrounding quotes themselves).
     static std::vector<std::string> split_fields(const std::string& line, char separator);
-    static bool can_be_voltage(std::vector<double> data, double limit=0.05);
-    static bool can_be_time(std::vector<double> data);
-    static bool can_be_current(std::vector<double> data, double limit=0.05);
+    static bool can_be_voltage(const std::vector<double>& data, double limit=0.05);
+    static bool can_be_time(const std::vector<double>& data);
+    static bool can_be_current(const std::vector<double>& data, double limit=0.05);
     std::optional<CircuitSimulationReader::DataType> guess_type_by_name(std::string name);
 };
 
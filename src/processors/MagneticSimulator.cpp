@@ -4,12 +4,16 @@
 #include "physical_models/Impedance.h"
 #include "physical_models/Temperature.h"
 #include "support/Settings.h"
+#include "support/CoilMesher.h"
 #include <MAS.hpp>
 #include "support/Exceptions.h"
+#include "support/Logger.h"
+#include "support/Parallel.h"
 
 #include <cmath>
 #include <complex>
 #include <limits>
+#include <numeric>
 #include <string>
 
 
@@ -20,8 +24,6 @@ Mas MagneticSimulator::simulate(Mas mas, bool fastMode){
 }
 Mas MagneticSimulator::simulate(const Inputs& inputs, const Magnetic& magnetic, bool fastMode){
     Mas mas;
-    std::vector<Outputs> outputs;
-    std::vector<OperatingPoint> simulatedOperatingPoints;
     mas.set_inputs(inputs);
 
     // Every winding must carry its own excitation (ABT #814). Deeper models
@@ -46,33 +48,48 @@ Mas MagneticSimulator::simulate(const Inputs& inputs, const Magnetic& magnetic,
         }
     }
 
-    for (auto& operatingPoint : mas.get_mutable_inputs().get_mutable_operating_points()){
+    // Operating points are independent: each task works on its own copy of
+    // the operating point and writes only its own slot, so the result is the
+    // same as the serial loop whatever the thread count. The magnetic (processed
+    // core, turns description) is shared read-only by every task, and its coil
+    // mesh cache lets the turns be meshed once for all operating points.
+    Magnetic meshedMagnetic = magnetic;
+    if (!meshedMagnetic.get_coil_mesh_cache()) {
+        meshedMagnetic.set_coil_mesh_cache(std::make_shared<CoilMeshCache>());
+    }
+    std::vector<OperatingPoint> simulatedOperatingPoints = mas.get_inputs().get_operating_points();
+    std::vector<Outputs> outputs(simulatedOperatingPoints.size());
+    parallel_for(simulatedOperatingPoints.size(), [&](size_t operatingPointIndex) {
+        _stopCondition.throw_if_stop_requested("MagneticSimulator::simulate");
+        auto& operatingPoint = simulatedOperatingPoints[operatingPointIndex];
         Outputs output;
         InductanceOutput inductanceOutput;
-        inductanceOutput.set_magnetizing_inductance(calculate_magnetizing_inductance(operatingPoint, magnetic));
+        inductanceOutput.set_magnetizing_inductance(calculate_magnetizing_inductance(operatingPoint, meshedMagnetic));
         if (!fastMode) {
-            if (magnetic.get_coil().get_functional_description().size() > 1) {
-                inductanceOutput.set_leakage_inductance(calculate_leakage_inductance(operatingPoint, magnetic));
+            if (meshedMagnetic.get_coil().get_functional_description().size() > 1) {
+                inductanceOutput.set_leakage_inductance(calculate_leakage_inductance(operatingPoint, meshedMagnetic));
             }
         }
         output.set_inductance(inductanceOutput);
-        output.set_core_losses(calculate_core_losses(operatingPoint, magnetic));
-        output.set_winding_losses(calculate_winding_losses(operatingPoint, magnetic, operatingPoint.get_conditions().get_ambient_temperature()));
+        output.set_core_losses(calculate_core_losses(operatingPoint, meshedMagnetic));
+        output.set_winding_losses(calculate_winding_losses(operatingPoint, meshedMagnetic, operatingPoint.get_conditions().get_ambient_temperature()));
+        if (Settings::GetInstance().get_magnetic_simulator_thermal_coupling()) {
+            couple_losses_and_temperature(operatingPoint, meshedMagnetic, output);
+        }
 
-        outputs.push_back(output);
-        simulatedOperatingPoints.push_back(operatingPoint);
-    }
+        outputs[operatingPointIndex] = std::move(output);
+    });
     mas.get_mutable_inputs().set_operating_points(simulatedOperatingPoints);
     mas.set_magnetic(magnetic);
     mas.set_outputs(outputs);
     return mas;
 }
 
-MagnetizingInductanceOutput MagneticSimulator::calculate_magnetizing_inductance(OperatingPoint& operatingPoint, Magnetic magnetic){
+MagnetizingInductanceOutput MagneticSimulator::calculate_magnetizing_inductance(OperatingPoint& operatingPoint, const Magnetic& magnetic){
     return _magnetizingInductanceModel.calculate_inductance_from_number_turns_and_gapping(magnetic.get_core(), magnetic.get_coil(), &operatingPoint);
 }
 
-LeakageInductanceOutput MagneticSimulator::calculate_leakage_inductance(OperatingPoint& operatingPoint, Magnetic magnetic){
+LeakageInductanceOutput MagneticSimulator::calculate_leakage_inductance(OperatingPoint& operatingPoint, const Magnetic& magnetic){
     double frequency = operatingPoint.get_excitations_per_winding()[0].get_frequency();
     return calculate_leakage_inductance(magnetic, frequency);
 }
@@ -86,7 +103,7 @@ LeakageInductanceOutput MagneticSimulator::calculate_leakage_inductance(Magnetic
     return OpenMagnetics::LeakageInductance().calculate_leakage_inductance_all_windings(magnetic, frequency);
 }
 
-WindingLossesOutput MagneticSimulator::calculate_winding_losses(OperatingPoint& operatingPoint, Magnetic magnetic, std::optional<double> temperature){
+WindingLossesOutput MagneticSimulator::calculate_winding_losses(OperatingPoint& operatingPoint, const Magnetic& magnetic, std::optional<double> temperature){
     auto& settings = OpenMagnetics::Settings::GetInstance();
     // RAII: if calculate_losses throws, the manual restore below never ran and the
     // process kept mirroring=1 for every subsequent computation.
@@ -105,7 +122,7 @@ WindingLossesOutput MagneticSimulator::calculate_winding_losses(OperatingPoint&
     return losses;
 }
 
-CoreLossesOutput MagneticSimulator::calculate_core_losses(OperatingPoint& operatingPoint, Magnetic magnetic) {
+CoreLossesOutput MagneticSimulator::calculate_core_losses(OperatingPoint& operatingPoint, const Magnetic& magnetic) {
     OperatingPointExcitation excitation = operatingPoint.get_excitations_per_winding()[0];
     if (!excitation.get_current()) {
         throw InvalidInputException(ErrorCode::MISSING_DATA, "Missing current in operating point");
@@ -145,6 +162,97 @@ CoreLossesOutput MagneticSimulator::calculate_core_losses(OperatingPoint& operat
     return coreLossesOutput;
 }
 
+// Fixed point losses(T) <-> T(losses) on the full (core + turns) thermal network.
+//
+// The network is assembled once; every later solve only rescales node powers
+// and restarts from the previous temperatures (Temperature::recalculateTemperatures).
+// Each outer iteration is a predictor/corrector pair:
+//   * predictor: cheap loss updates -- core losses from the already computed
+//     flux density at the new core temperature, winding losses from the last
+//     full evaluation scaled by the DC-resistivity ratio -- solved until the
+//     hot spot settles;
+//   * corrector: one full-fidelity evaluation (flux density, core and winding
+//     losses) at the predicted temperatures.
+// The predictor usually lands within tolerance, so a hot result costs about
+// one extra loss evaluation on top of the ambient one.
+void MagneticSimulator::couple_losses_and_temperature(OperatingPoint& operatingPoint, const Magnetic& magnetic, Outputs& output) {
+    const size_t maximumPredictorSteps = 20;
+    auto& settings = Settings::GetInstance();
+    double tolerance = settings.get_magnetic_simulator_thermal_coupling_tolerance();
+    size_t maximumIterations = settings.get_magnetic_simulator_thermal_coupling_maximum_iterations();
+    if (maximumIterations == 0 || !output.get_core_losses() || !output.get_winding_losses()) {
+        return;
+    }
+
+    double ambientTemperature = operatingPoint.get_conditions().get_ambient_temperature();
+    auto core = magnetic.get_core();
+    auto coil = magnetic.get_coil();
+    auto coreLossesOutput = output.get_core_losses().value();
+    auto windingLossesOutput = output.get_winding_losses().value();
+    auto excitation = operatingPoint.get_excitations_per_winding()[0];
+
+    auto totalDcResistance = [&coil](double temperature) {
+        auto resistances = WindingOhmicLosses::calculate_dc_resistance_per_winding(coil, temperature);
+        return std::accumulate(resistances.begin(), resistances.end(), 0.0);
+    };
+
+    try {
+        TemperatureConfig temperatureConfig;
+        temperatureConfig.ambientTemperature = ambientTemperature;
+        temperatureConfig.coreLosses = coreLossesOutput.get_core_losses();
+        temperatureConfig.windingLosses = windingLossesOutput.get_winding_losses();
+        temperatureConfig.windingLossesOutput = windingLossesOutput;
+        temperatureConfig.plotSchematic = false;
+        temperatureConfig.masCooling = operatingPoint.get_conditions().get_cooling();
+        Temperature thermalModel(magnetic, temperatureConfig);
+        auto thermalResult = thermalModel.calculateTemperatures();
+
+        double referenceResistance = totalDcResistance(ambientTemperature);
+        for (size_t iteration = 0; iteration < maximumIterations && !_stopCondition.should_stop(); ++iteration) {
+            for (size_t step = 0; step < maximumPredictorSteps; ++step) {
+                double previousHotSpot = thermalResult.maximumTemperature;
+                double coreLosses = _coreLossesModel.calculate_core_losses(core, excitation, thermalResult.averageCoreTemperature).get_core_losses();
+                double windingLossesScale = totalDcResistance(thermalResult.averageCoilTemperature) / referenceResistance;
+                thermalResult = thermalModel.recalculateTemperatures(coreLosses, windingLossesOutput, windingLossesScale);
+                if (fabs(thermalResult.maximumTemperature - previousHotSpot) < tolerance) {
+                    break;
+                }
+            }
+
+            double predictedHotSpot = thermalResult.maximumTemperature;
+            double coreTemperature = thermalResult.averageCoreTemperature;
+            double coilTemperature = thermalResult.averageCoilTemperature;
+
+            // Permeability, hence B, follows the core temperature; the
+            // inductance model reads it from the operating point conditions.
+            operatingPoint.get_mutable_conditions().set_ambient_temperature(coreTemperature);
+            auto magneticFluxDensity = _magnetizingInductanceModel.calculate_inductance_and_magnetic_flux_density(core, coil, &operatingPoint).second;
+            operatingPoint.get_mutable_conditions().set_ambient_temperature(ambientTemperature);
+            excitation.set_magnetic_flux_density(magneticFluxDensity);
+
+            coreLossesOutput = _coreLossesModel.calculate_core_losses(core, excitation, coreTemperature);
+            windingLossesOutput = calculate_winding_losses(operatingPoint, magnetic, coilTemperature);
+            referenceResistance = totalDcResistance(coilTemperature);
+            thermalResult = thermalModel.recalculateTemperatures(coreLossesOutput.get_core_losses(), windingLossesOutput);
+            // Same statistic as the uncoupled path: the hottest core node.
+            coreLossesOutput.set_temperature(thermalResult.maximumCoreTemperature);
+
+            if (fabs(thermalResult.maximumTemperature - predictedHotSpot) < tolerance) {
+                break;
+            }
+        }
+    }
+    catch (const std::exception& e) {
+        operatingPoint.get_mutable_conditions().set_ambient_temperature(ambientTemperature);
+        OM_WARNING_M("MagneticSimulator", std::string("Thermal coupling skipped, losses kept at ambient: ") + e.what());
+        return;
+    }
+
+    operatingPoint.get_mutable_excitations_per_winding()[0] = excitation;
+    output.set_core_losses(coreLossesOutput);
+    output.set_winding_losses(windingLossesOutput);
+}
+
 namespace {
     // Builds a single-valued DimensionWithTolerance (nominal only) tagged with a unit.
     DimensionWithTolerance nominal_dimension(double value, const std::string& unit) {
@@ -248,11 +356,17 @@ MagneticManufacturerInfo MagneticSimulator::build_datasheet(Mas& mas) {
         double stopFrequency = selfResonantFrequency * 100;
         double logStep = std::log10(stopFrequency / startFrequency) / (numberPoints - 1);
 
+        std::vector<double> frequencies(numberPoints);
+        for (size_t pointIndex = 0; pointIndex < numberPoints; ++pointIndex) {
+            frequencies[pointIndex] = startFrequency * std::pow(10.0, logStep * pointIndex);
+        }
+        auto impedances = impedanceModel.impedance_from_model(widebandModel, frequencies);
+
         std::vector<DatasheetImpedancePoint> impedancePoints;
         double maximumImpedanceMagnitude = std::numeric_limits<double>::lowest();
         for (size_t pointIndex = 0; pointIndex < numberPoints; ++pointIndex) {
-            double frequency = startFrequency * std::pow(10.0, logStep * pointIndex);
-            auto impedance = impedanceModel.impedance_from_model(widebandModel, frequency);
+            double frequency = frequencies[pointIndex];
+            auto impedance = impedances[pointIndex];
 
             ImpedancePoint impedancePoint;
             impedancePoint.set_magnitude(std::abs(impedance));
@@ -4,6 +4,7 @@
 #include "physical_models/WindingLosses.h"
 #include "support/Utils.h"
 #include "support/Settings.h"
+#include "support/Cancellation.h"
 #include "constructive_models/Mas.h"
 #include <MAS.hpp>
 
@@ -19,6 +20,13 @@ class MagneticSimulator {
 
         MagnetizingInductance _magnetizingInductanceModel;
         CoreLosses _coreLossesModel;
+        StopCondition _stopCondition;
+
+        // Settings::get_magnetic_simulator_thermal_coupling(): re-evaluates the
+        // operating point's losses at the temperatures of the full thermal
+        // network until its hot spot converges. Leaves `output` untouched if the
+        // network cannot be built for this magnetic.
+        void couple_losses_and_temperature(OperatingPoint& operatingPoint, const Magnetic& magnetic, Outputs& output);
 
     public:
 
@@ -36,7 +44,14 @@ class MagneticSimulator {
         void set_core_losses_model_name(CoreLossesModels model) {
             _coreLossesModel.set_core_losses_model_name(model);
         }
+        // simulate() checks it before every operating point and throws
+        // CalculationInterruptedException once it fires.
+        void set_stop_condition(const StopCondition& stopCondition) {
+            _stopCondition = stopCondition;
+        }
 
+        // Operating points are simulated concurrently through parallel_for()
+        // (Settings::get_parallel_number_threads()); outputs keep the input order.
         Mas simulate(Mas mas, bool fastMode=false);
         Mas simulate(const Inputs& inputs, const Magnetic& magnetic, bool fastMode=false);
 
@@ -46,11 +61,11 @@ class MagneticSimulator {
         // only the datasheetInfo block is populated/overwritten. The result is also attached to
         // mas.magnetic.manufacturerInfo. Requires mas to carry simulation outputs (run simulate first).
         MagneticManufacturerInfo build_datasheet(Mas& mas);
-        CoreLossesOutput calculate_core_losses(OperatingPoint& operatingPoint, Magnetic magnetic);
-        LeakageInductanceOutput calculate_leakage_inductance(OperatingPoint& operatingPoint, Magnetic magnetic);
+        CoreLossesOutput calculate_core_losses(OperatingPoint& operatingPoint, const Magnetic& magnetic);
+        LeakageInductanceOutput calculate_leakage_inductance(OperatingPoint& operatingPoint, const Magnetic& magnetic);
         static LeakageInductanceOutput calculate_leakage_inductance(Magnetic magnetic, double frequency);
-        MagnetizingInductanceOutput calculate_magnetizing_inductance(OperatingPoint& operatingPoint, Magnetic magnetic);
-        WindingLossesOutput calculate_winding_losses(OperatingPoint& operatingPoint, Magnetic magnetic, std::optional<double> temperature = std::nullopt);
+        MagnetizingInductanceOutput calculate_magnetizing_inductance(OperatingPoint& operatingPoint, const Magnetic& magnetic);
+        WindingLossesOutput calculate_winding_losses(OperatingPoint& operatingPoint, const Magnetic& magnetic, std::optional<double> temperature = std::nullopt);
 
 };
 
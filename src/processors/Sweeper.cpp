@@ -9,26 +9,72 @@
 #include "physical_models/Impedance.h"
 #include "physical_models/LeakageInductance.h"
 #include "support/Settings.h"
+#include "support/Parallel.h"
+#include <algorithm>
 #include <cmath>
 #include <numbers>
+#include <span>
 #include <complex>
+#include <utility>
 #include "support/Exceptions.h"
 
 
 namespace OpenMagnetics {
 
+namespace {
 
-Curve2D Sweeper::sweep_impedance_over_frequency(Magnetic magnetic, double start, double stop, size_t numberElements, std::string mode, std::string title, bool fast) {
-    std::vector<double> frequencies;
+std::vector<double> get_sweep_points(double start, double stop, size_t numberElements, const std::string& mode) {
     if (mode == "linear") {
-        frequencies = linear_spaced_array(start, stop, numberElements);
+        return linear_spaced_array(start, stop, numberElements);
     }
     else if (mode == "log") {
-        frequencies = logarithmic_spaced_array(start, stop, numberElements);
+        return logarithmic_spaced_array(start, stop, numberElements);
     }
     else {
         throw ModelNotAvailableException("Unknown spaced array mode");
     }
+}
+
+// The chunked core of evaluate_sweep() below. Each chunk is handed over whole,
+// for evaluations that batch their per-point work (µ(f) of a whole chunk in
+// one pass for the impedance sweeps).
+template<typename Result, typename MakeState, typename EvaluateChunk>
+std::vector<Result> evaluate_sweep_in_chunks(const std::vector<double>& points, MakeState makeState, EvaluateChunk evaluateChunk) {
+    using State = decltype(makeState());
+    std::vector<Result> results(points.size());
+    size_t numberChunks = std::min(get_parallel_number_workers(), points.size());
+    parallel_for(numberChunks, [&](size_t chunk) {
+        State state = makeState();
+        size_t begin = points.size() * chunk / numberChunks;
+        size_t end = points.size() * (chunk + 1) / numberChunks;
+        evaluateChunk(state, std::span<const double>(points).subspan(begin, end - begin), std::span<Result>(results).subspan(begin, end - begin));
+    });
+    return results;
+}
+
+// Evaluates every point of a sweep through parallel_for (support/Parallel.h).
+// The points are split into one contiguous chunk per worker, and each chunk
+// builds its own state with makeState(): the per-magnetic invariants (core and
+// coil copies, model objects with their memo caches) are set up once per chunk
+// instead of once per point, and no two threads share a model. Results are
+// written by index and no point depends on another, so the curve is
+// bit-identical to the serial loop for any thread count.
+template<typename MakeState, typename Evaluate>
+auto evaluate_sweep(const std::vector<double>& points, MakeState makeState, Evaluate evaluate) {
+    using State = decltype(makeState());
+    using Result = decltype(evaluate(std::declval<State&>(), 0.0));
+    return evaluate_sweep_in_chunks<Result>(points, makeState, [&](State& state, std::span<const double> chunkPoints, std::span<Result> chunkResults) {
+        for (size_t index = 0; index < chunkPoints.size(); ++index) {
+            chunkResults[index] = evaluate(state, chunkPoints[index]);
+        }
+    });
+}
+
+} // namespace
+
+
+Curve2D Sweeper::sweep_impedance_over_frequency(Magnetic magnetic, double start, double stop, size_t numberElements, std::string mode, std::string title, bool fast) {
+    auto frequencies = get_sweep_points(start, stop, numberElements, mode);
 
     // The terminal impedance is a series cascade of resonant tanks (a Foster
     // ladder): the magnetizing tank (first resonance) plus, for coupled magnetics,
@@ -50,26 +96,16 @@ Curve2D Sweeper::sweep_impedance_over_frequency(Magnetic magnetic, double start,
     auto impedanceModel = OpenMagnetics::Impedance();
     auto model = impedanceModel.build_wideband_impedance_model(magnetic, referenceFrequency, temperature, fast);
 
-    std::vector<double> impedances;
-    impedances.reserve(frequencies.size());
-    for (auto frequency : frequencies) {
-        impedances.push_back(abs(impedanceModel.impedance_from_model(model, frequency)));
-    }
+    auto impedances = evaluate_sweep_in_chunks<double>(frequencies, [&] { return impedanceModel; }, [&](Impedance& chunkModel, std::span<const double> chunkFrequencies, std::span<double> chunkImpedances) {
+        auto chunkComplexImpedances = chunkModel.impedance_from_model(model, chunkFrequencies);
+        std::transform(chunkComplexImpedances.begin(), chunkComplexImpedances.end(), chunkImpedances.begin(), [](std::complex<double> impedance) { return abs(impedance); });
+    });
 
     return Curve2D(frequencies, impedances, title);
 }
 
 Curve2D Sweeper::sweep_common_mode_impedance_over_frequency(Magnetic magnetic, double start, double stop, size_t numberElements, std::string mode, std::string title) {
-    std::vector<double> frequencies;
-    if (mode == "linear") {
-        frequencies = linear_spaced_array(start, stop, numberElements);
-    }
-    else if (mode == "log") {
-        frequencies = logarithmic_spaced_array(start, stop, numberElements);
-    }
-    else {
-        throw ModelNotAvailableException("Unknown spaced array mode");
-    }
+    auto frequencies = get_sweep_points(start, stop, numberElements, mode);
 
     // Common mode drives all windings in parallel, so the leakage between them is
     // not excited and the terminal impedance is the magnetizing tank alone: the
@@ -80,26 +116,16 @@ Curve2D Sweeper::sweep_common_mode_impedance_over_frequency(Magnetic magnetic, d
     auto impedanceModel = OpenMagnetics::Impedance();
     auto model = impedanceModel.build_common_mode_impedance_model(magnetic);
 
-    std::vector<double> impedances;
-    impedances.reserve(frequencies.size());
-    for (auto frequency : frequencies) {
-        impedances.push_back(abs(impedanceModel.impedance_from_model(model, frequency)));
-    }
+    auto impedances = evaluate_sweep_in_chunks<double>(frequencies, [&] { return impedanceModel; }, [&](Impedance& chunkModel, std::span<const double> chunkFrequencies, std::span<double> chunkImpedances) {
+        auto chunkComplexImpedances = chunkModel.impedance_from_model(model, chunkFrequencies);
+        std::transform(chunkComplexImpedances.begin(), chunkComplexImpedances.end(), chunkImpedances.begin(), [](std::complex<double> impedance) { return abs(impedance); });
+    });
 
     return Curve2D(frequencies, impedances, title);
 }
 
 Curve2D Sweeper::sweep_differential_mode_impedance_over_frequency(Magnetic magnetic, double start, double stop, size_t numberElements, std::string mode, std::string title) {
-    std::vector<double> frequencies;
-    if (mode == "linear") {
-        frequencies = linear_spaced_array(start, stop, numberElements);
-    }
-    else if (mode == "log") {
-        frequencies = logarithmic_spaced_array(start, stop, numberElements);
-    }
-    else {
-        throw ModelNotAvailableException("Unknown spaced array mode");
-    }
+    auto frequencies = get_sweep_points(start, stop, numberElements, mode);
 
     // The leakage inductance, winding resistance and inter-winding capacitance are
     // frequency-independent, but the stray-capacitance model behind the last one is
@@ -110,48 +136,31 @@ Curve2D Sweeper::sweep_differential_mode_impedance_over_frequency(Magnetic magne
     auto impedance = OpenMagnetics::Impedance();
     auto parameters = impedance.calculate_differential_mode_parameters(magnetic.get_core(), magnetic.get_coil(), referenceFrequency);
 
-    std::vector<double> impedances;
-    for (auto frequency : frequencies) {
-        impedances.push_back(abs(impedance.differential_mode_impedance_from_parameters(parameters, frequency)));
-    }
+    auto impedances = evaluate_sweep(frequencies, [&] { return impedance; }, [&](Impedance& chunkModel, double frequency) {
+        return abs(chunkModel.differential_mode_impedance_from_parameters(parameters, frequency));
+    });
 
     return Curve2D(frequencies, impedances, title);
 }
 
 Curve2D Sweeper::sweep_q_factor_over_frequency(Magnetic magnetic, double start, double stop, size_t numberElements, std::string mode, std::string title) {
-    std::vector<double> frequencies;
-    if (mode == "linear") {
-        frequencies = linear_spaced_array(start, stop, numberElements);
-    }
-    else if (mode == "log") {
-        frequencies = logarithmic_spaced_array(start, stop, numberElements);
-    }
-    else {
-        throw ModelNotAvailableException("Unknown spaced array mode");
-    }
+    auto frequencies = get_sweep_points(start, stop, numberElements, mode);
 
-    std::vector<double> qFactors;
-    for (auto frequency : frequencies) {
-        auto qFactor = abs(OpenMagnetics::Impedance().calculate_q_factor(magnetic, frequency));
-        qFactors.push_back(qFactor);
-    }
+    struct QFactorState {
+        Core core;
+        Coil coil;
+        OpenMagnetics::Impedance impedance;
+    };
+    auto qFactors = evaluate_sweep(frequencies, [&] { return QFactorState{magnetic.get_core(), magnetic.get_coil(), OpenMagnetics::Impedance()}; },
+                                   [](QFactorState& state, double frequency) {
+        return abs(state.impedance.calculate_q_factor(state.core, state.coil, frequency));
+    });
 
-    auto core = magnetic.get_core();
-    auto coil = magnetic.get_coil();
     return Curve2D(frequencies, qFactors, title);
 }
 
 Curve2D Sweeper::sweep_magnetizing_inductance_over_frequency(Magnetic magnetic, double start, double stop, size_t numberElements, double temperature, std::string mode, std::string title) {
-    std::vector<double> frequencies;
-    if (mode == "linear") {
-        frequencies = linear_spaced_array(start, stop, numberElements);
-    }
-    else if (mode == "log") {
-        frequencies = logarithmic_spaced_array(start, stop, numberElements);
-    }
-    else {
-        throw ModelNotAvailableException("Unknown spaced array mode");
-    }
+    auto frequencies = get_sweep_points(start, stop, numberElements, mode);
 
     auto magnetizingInductanceModel = MagnetizingInductance();
     auto turnsRatios = magnetic.get_mutable_coil().get_turns_ratios();
@@ -162,27 +171,22 @@ Curve2D Sweeper::sweep_magnetizing_inductance_over_frequency(Magnetic magnetic,
         currentMask.push_back(virtualCurrentRms * sqrt(2) * turnsRatio);
     }
 
-    std::vector<double> magnetizingInductances;
-    for (auto frequency : frequencies) {
+    struct InductanceState {
+        Core core;
+        Coil coil;
+        MagnetizingInductance model;
+    };
+    auto magnetizingInductances = evaluate_sweep(frequencies, [&] { return InductanceState{magnetic.get_core(), magnetic.get_coil(), magnetizingInductanceModel}; },
+                                                 [&](InductanceState& state, double frequency) {
         auto operatingPoint = Inputs::create_operating_point_with_sinusoidal_current_mask(frequency, staticMagnetizingInductance, temperature, turnsRatios, currentMask);
-        double magnetizingInductance = resolve_dimensional_values(magnetizingInductanceModel.calculate_inductance_from_number_turns_and_gapping(magnetic.get_core(), magnetic.get_coil(), &operatingPoint).get_magnetizing_inductance());
-        magnetizingInductances.push_back(magnetizingInductance);
-    }
+        return resolve_dimensional_values(state.model.calculate_inductance_from_number_turns_and_gapping(state.core, state.coil, &operatingPoint).get_magnetizing_inductance());
+    });
 
     return Curve2D(frequencies, magnetizingInductances, title);
 }
 
 Curve2D Sweeper::sweep_magnetizing_inductance_over_temperature(Magnetic magnetic, double start, double stop, size_t numberElements, double frequency, std::string mode, std::string title) {
-    std::vector<double> temperatures;
-    if (mode == "linear") {
-        temperatures = linear_spaced_array(start, stop, numberElements);
-    }
-    else if (mode == "log") {
-        temperatures = logarithmic_spaced_array(start, stop, numberElements);
-    }
-    else {
-        throw ModelNotAvailableException("Unknown spaced array mode");
-    }
+    auto temperatures = get_sweep_points(start, stop, numberElements, mode);
 
     auto magnetizingInductanceModel = MagnetizingInductance();
     auto turnsRatios = magnetic.get_mutable_coil().get_turns_ratios();
@@ -193,27 +197,22 @@ Curve2D Sweeper::sweep_magnetizing_inductance_over_temperature(Magnetic magnetic
         currentMask.push_back(virtualCurrentRms * sqrt(2) * turnsRatio);
     }
 
-    std::vector<double> magnetizingInductances;
-    for (auto temperature : temperatures) {
+    struct InductanceState {
+        Core core;
+        Coil coil;
+        MagnetizingInductance model;
+    };
+    auto magnetizingInductances = evaluate_sweep(temperatures, [&] { return InductanceState{magnetic.get_core(), magnetic.get_coil(), magnetizingInductanceModel}; },
+                                                 [&](InductanceState& state, double temperature) {
         auto operatingPoint = Inputs::create_operating_point_with_sinusoidal_current_mask(frequency, staticMagnetizingInductance, temperature, turnsRatios, currentMask);
-        double magnetizingInductance = resolve_dimensional_values(magnetizingInductanceModel.calculate_inductance_from_number_turns_and_gapping(magnetic.get_core(), magnetic.get_coil(), &operatingPoint).get_magnetizing_inductance());
-        magnetizingInductances.push_back(magnetizingInductance);
-    }
+        return resolve_dimensional_values(state.model.calculate_inductance_from_number_turns_and_gapping(state.core, state.coil, &operatingPoint).get_magnetizing_inductance());
+    });
 
     return Curve2D(temperatures, magnetizingInductances, title);
 }
 
 Curve2D Sweeper::sweep_magnetizing_inductance_over_dc_bias(Magnetic magnetic, double start, double stop, size_t numberElements, double temperature, std::string mode, std::string title) {
-    std::vector<double> currentOffsets;
-    if (mode == "linear") {
-        currentOffsets = linear_spaced_array(start, stop, numberElements);
-    }
-    else if (mode == "log") {
-        currentOffsets = logarithmic_spaced_array(start, stop, numberElements);
-    }
-    else {
-        throw ModelNotAvailableException("Unknown spaced array mode");
-    }
+    auto currentOffsets = get_sweep_points(start, stop, numberElements, mode);
 
     auto magnetizingInductanceModel = MagnetizingInductance();
 
@@ -227,48 +226,32 @@ Curve2D Sweeper::sweep_magnetizing_inductance_over_dc_bias(Magnetic magnetic, do
         currentMask.push_back(virtualCurrentRms * sqrt(2) * turnsRatio);
     }
 
-    std::vector<double> magnetizingInductances;
-    for (auto currentOffset : currentOffsets) {
+    struct InductanceState {
+        Core core;
+        Coil coil;
+        MagnetizingInductance model;
+    };
+    auto magnetizingInductances = evaluate_sweep(currentOffsets, [&] { return InductanceState{magnetic.get_core(), inductorCoil, magnetizingInductanceModel}; },
+                                                 [&](InductanceState& state, double currentOffset) {
         auto operatingPoint = Inputs::create_operating_point_with_sinusoidal_current_mask(defaults.measurementFrequency, staticMagnetizingInductance, temperature, turnsRatios, currentMask, currentOffset);
-        double magnetizingInductance = resolve_dimensional_values(magnetizingInductanceModel.calculate_inductance_from_number_turns_and_gapping(magnetic.get_core(), inductorCoil, &operatingPoint).get_magnetizing_inductance());
-        magnetizingInductances.push_back(magnetizingInductance);
-    }
+        return resolve_dimensional_values(state.model.calculate_inductance_from_number_turns_and_gapping(state.core, state.coil, &operatingPoint).get_magnetizing_inductance());
+    });
 
     return Curve2D(currentOffsets, magnetizingInductances, title);
 }
 
 Curve2D Sweeper::sweep_winding_resistance_over_frequency(Magnetic magnetic, double start, double stop, size_t numberElements, size_t windingIndex, double temperature, std::string mode, std::string title) {
-    std::vector<double> frequencies;
-    if (mode == "linear") {
-        frequencies = linear_spaced_array(start, stop, numberElements);
-    }
-    else if (mode == "log") {
-        frequencies = logarithmic_spaced_array(start, stop, numberElements);
-    }
-    else {
-        throw ModelNotAvailableException("Unknown spaced array mode");
-    }
+    auto frequencies = get_sweep_points(start, stop, numberElements, mode);
 
-    std::vector<double> effectiveResistances;
-    for (auto frequency : frequencies) {
-        auto effectiveResistance = WindingLosses::calculate_effective_resistance_of_winding(magnetic, windingIndex, frequency, temperature);
-        effectiveResistances.push_back(effectiveResistance);
-    }
+    auto effectiveResistances = evaluate_sweep(frequencies, [&] { return magnetic; }, [&](Magnetic& chunkMagnetic, double frequency) {
+        return WindingLosses::calculate_effective_resistance_of_winding(chunkMagnetic, windingIndex, frequency, temperature);
+    });
 
     return Curve2D(frequencies, effectiveResistances, title);
 }
 
 Curve2D Sweeper::sweep_resistance_over_frequency(Magnetic magnetic, double start, double stop, size_t numberElements, double temperature, std::string mode, std::string title) {
-    std::vector<double> frequencies;
-    if (mode == "linear") {
-        frequencies = linear_spaced_array(start, stop, numberElements);
-    }
-    else if (mode == "log") {
-        frequencies = logarithmic_spaced_array(start, stop, numberElements);
-    }
-    else {
-        throw ModelNotAvailableException("Unknown spaced array mode");
-    }
+    auto frequencies = get_sweep_points(start, stop, numberElements, mode);
 
     auto magnetizingInductanceModel = MagnetizingInductance();
     auto turnsRatios = magnetic.get_mutable_coil().get_turns_ratios();
@@ -279,29 +262,18 @@ Curve2D Sweeper::sweep_resistance_over_frequency(Magnetic magnetic, double start
         currentMask.push_back(virtualCurrentRms * sqrt(2) * turnsRatio);
     }
 
-    std::vector<double> effectiveResistances;
-    for (auto frequency : frequencies) {
+    auto effectiveResistances = evaluate_sweep(frequencies, [&] { return magnetic; }, [&](Magnetic& chunkMagnetic, double frequency) {
         auto operatingPoint = Inputs::create_operating_point_with_sinusoidal_current_mask(frequency, magnetizingInductance, temperature, turnsRatios, currentMask);
-        auto windingLosses = WindingLosses().calculate_losses(magnetic, operatingPoint, temperature).get_winding_losses();
+        auto windingLosses = WindingLosses().calculate_losses(chunkMagnetic, operatingPoint, temperature).get_winding_losses();
 
-        double effectiveResistance = windingLosses / pow(operatingPoint.get_excitations_per_winding()[0].get_current()->get_processed()->get_rms().value(), 2);
-        effectiveResistances.push_back(effectiveResistance);
-    }
+        return windingLosses / pow(operatingPoint.get_excitations_per_winding()[0].get_current()->get_processed()->get_rms().value(), 2);
+    });
 
     return Curve2D(frequencies, effectiveResistances, title);
 }
 
 Curve2D Sweeper::sweep_core_resistance_over_frequency(Magnetic magnetic, double start, double stop, size_t numberElements, double temperature, std::string mode, std::string title) {
-    std::vector<double> frequencies;
-    if (mode == "linear") {
-        frequencies = linear_spaced_array(start, stop, numberElements);
-    }
-    else if (mode == "log") {
-        frequencies = logarithmic_spaced_array(start, stop, numberElements);
-    }
-    else {
-        throw ModelNotAvailableException("Unknown spaced array mode");
-    }
+    auto frequencies = get_sweep_points(start, stop, numberElements, mode);
     auto core = magnetic.get_core();
     auto coil = magnetic.get_coil();
 
@@ -331,28 +303,21 @@ Curve2D Sweeper::sweep_core_resistance_over_frequency(Magnetic magnetic, double
     else {
         coreLossesModelName = "Proprietary";
     }
-    auto coreLossesModel = CoreLossesModel::factory(std::map<std::string, std::string>({{"coreLosses", coreLossesModelName}}));
-
-    for (auto frequency : frequencies) {
-        auto coreResistance = coreLossesModel->get_core_losses_series_resistance(core, frequency, temperature, magnetizingInductance);
-        coreResistances.push_back(coreResistance);
-    }
-
+    struct CoreResistanceState {
+        Core core;
+        std::shared_ptr<CoreLossesModel> model;
+    };
+    coreResistances = evaluate_sweep(frequencies, [&] {
+        return CoreResistanceState{core, CoreLossesModel::factory(std::map<std::string, std::string>({{"coreLosses", coreLossesModelName}}))};
+    }, [&](CoreResistanceState& state, double frequency) {
+        return state.model->get_core_losses_series_resistance(state.core, frequency, temperature, magnetizingInductance);
+    });
 
     return Curve2D(frequencies, coreResistances, title);
 }
 
 Curve2D Sweeper::sweep_core_losses_over_frequency(Magnetic magnetic, OperatingPoint operatingPoint, double start, double stop, size_t numberElements, double temperature, std::string mode, std::string title) {
-    std::vector<double> frequencies;
-    if (mode == "linear") {
-        frequencies = linear_spaced_array(start, stop, numberElements);
-    }
-    else if (mode == "log") {
-        frequencies = logarithmic_spaced_array(start, stop, numberElements);
-    }
-    else {
-        throw ModelNotAvailableException("Unknown spaced array mode");
-    }
+    auto frequencies = get_sweep_points(start, stop, numberElements, mode);
     auto core = magnetic.get_core();
     auto coil = magnetic.get_coil();
 
@@ -369,11 +334,21 @@ Curve2D Sweeper::sweep_core_losses_over_frequency(Magnetic magnetic, OperatingPo
     auto magnetizingInductanceOutput = reluctanceModel->get_core_reluctance(core, initialPermeability);
     auto totalReluctance = magnetizingInductanceOutput.get_core_reluctance();
 
-    std::vector<double> coreLossesPerFrequency;
-    CoreLosses coreLossesModel;
-    coreLossesModel.set_core_losses_model_name(CoreLossesModels::STEINMETZ);
+    auto isolationSides = coil.get_isolation_sides();
+    struct CoreLossesState {
+        Core core;
+        CoreLosses model;
+    };
+    auto make_state = [&] {
+        CoreLossesState state{core, CoreLosses()};
+        state.model.set_core_losses_model_name(CoreLossesModels::STEINMETZ);
+        return state;
+    };
 
-    for (auto frequency : frequencies) {
+    // Every point rescales its own copy of the operating point, so points do not
+    // depend on each other (the loop used to rescale one shared copy in place).
+    auto coreLossesPerFrequency = evaluate_sweep(frequencies, make_state, [&](CoreLossesState& state, double frequency) {
+        auto pointOperatingPoint = operatingPoint;
 
         // Keep BOTH signals through the rescale. The third argument used to be `true`
         // (cleanFrequencyDependentFields), which with the default useCurrentAsBase=true
@@ -384,25 +359,25 @@ Curve2D Sweeper::sweep_core_losses_over_frequency(Magnetic magnetic, OperatingPo
         // core losses go DOWN, not up. The two only ever agreed at the operating
         // point's own frequency, which is why the graph read tens of watts where the
         // Core Info panel and the datasheet read a fraction of one (ABT: user report).
-        Inputs::scale_time_to_frequency(operatingPoint, frequency, false);
+        Inputs::scale_time_to_frequency(pointOperatingPoint, frequency, false);
 
-        OperatingPointExcitation excitation = Inputs::get_primary_excitation(operatingPoint);
+        OperatingPointExcitation excitation = Inputs::get_primary_excitation(pointOperatingPoint);
 
         if (numberWindings == 1 && excitation.get_current()) {
-            Inputs::set_current_as_magnetizing_current(&operatingPoint);
+            Inputs::set_current_as_magnetizing_current(&pointOperatingPoint);
         }
-        else if (Inputs::is_multiport_inductor(operatingPoint, coil.get_isolation_sides())) {
-            auto magnetizingCurrent = Inputs::get_multiport_inductor_magnetizing_current(operatingPoint);
+        else if (Inputs::is_multiport_inductor(pointOperatingPoint, isolationSides)) {
+            auto magnetizingCurrent = Inputs::get_multiport_inductor_magnetizing_current(pointOperatingPoint);
             excitation.set_magnetizing_current(magnetizingCurrent);
-            operatingPoint.get_mutable_excitations_per_winding()[0] = excitation;
+            pointOperatingPoint.get_mutable_excitations_per_winding()[0] = excitation;
         }
-        else if (Inputs::can_be_common_mode_choke(operatingPoint) && core.get_type() == CoreType::TOROIDAL) {
+        else if (Inputs::can_be_common_mode_choke(pointOperatingPoint) && state.core.get_type() == CoreType::TOROIDAL) {
             // CMC: drive the core from the common-mode current alone, so the
             // DM (line) current which cancels in the toroid doesn't inflate B.
             // Same pattern MagnetizingInductance.cpp:149 uses.
-            auto magnetizingCurrent = Inputs::get_common_mode_choke_magnetizing_current(operatingPoint);
+            auto magnetizingCurrent = Inputs::get_common_mode_choke_magnetizing_current(pointOperatingPoint);
             excitation.set_magnetizing_current(magnetizingCurrent);
-            operatingPoint.get_mutable_excitations_per_winding()[0] = excitation;
+            pointOperatingPoint.get_mutable_excitations_per_winding()[0] = excitation;
         }
         else if (excitation.get_voltage()) {
             auto voltage = excitation.get_voltage().value();
@@ -418,51 +393,41 @@ Curve2D Sweeper::sweep_core_losses_over_frequency(Magnetic magnetic, OperatingPo
             magnetizingCurrent.set_processed(Inputs::calculate_processed_data(magnetizingCurrent, sampledMagnetizingCurrentWaveform, false));
 
             excitation.set_magnetizing_current(magnetizingCurrent);
-            operatingPoint.get_mutable_excitations_per_winding()[0] = excitation;
+            pointOperatingPoint.get_mutable_excitations_per_winding()[0] = excitation;
         }
 
-        auto magneticFlux = OpenMagnetics::MagneticField::calculate_magnetic_flux(operatingPoint.get_mutable_excitations_per_winding()[0].get_magnetizing_current().value(), totalReluctance, numberTurnsPrimary);
+        auto magneticFlux = OpenMagnetics::MagneticField::calculate_magnetic_flux(pointOperatingPoint.get_mutable_excitations_per_winding()[0].get_magnetizing_current().value(), totalReluctance, numberTurnsPrimary);
         auto magneticFluxDensity = OpenMagnetics::MagneticField::calculate_magnetic_flux_density(magneticFlux, effectiveArea);
     
         excitation.set_magnetic_flux_density(magneticFluxDensity);
 
-        auto coreLosses =  coreLossesModel.calculate_core_losses(core, excitation, temperature).get_core_losses();
-        coreLossesPerFrequency.push_back(coreLosses);
-    }
+        return state.model.calculate_core_losses(state.core, excitation, temperature).get_core_losses();
+    });
 
     return Curve2D(frequencies, coreLossesPerFrequency, title);
 }
 
 Curve2D Sweeper::sweep_winding_losses_over_frequency(Magnetic magnetic, OperatingPoint operatingPoint, double start, double stop, size_t numberElements, double temperature, std::string mode, std::string title) {
-    std::vector<double> frequencies;
-    if (mode == "linear") {
-        frequencies = linear_spaced_array(start, stop, numberElements);
-    }
-    else if (mode == "log") {
-        frequencies = logarithmic_spaced_array(start, stop, numberElements);
-    }
-    else {
-        throw ModelNotAvailableException("Unknown spaced array mode");
-    }
+    auto frequencies = get_sweep_points(start, stop, numberElements, mode);
 
     auto magnetizingInductanceModel = MagnetizingInductance();
     auto turnsRatios = magnetic.get_mutable_coil().get_turns_ratios();
     auto magnetizingInductance = resolve_dimensional_values(magnetizingInductanceModel.calculate_inductance_from_number_turns_and_gapping(magnetic.get_core(), magnetic.get_coil()).get_magnetizing_inductance());
 
-    std::vector<double> windingLossesPerFrequency;
-    for (auto frequency : frequencies) {
+    // Every point rescales its own copy of the operating point, so points do not
+    // depend on each other (the loop used to rescale one shared copy in place).
+    auto windingLossesPerFrequency = evaluate_sweep(frequencies, [&] { return magnetic; }, [&](Magnetic& chunkMagnetic, double frequency) {
+        auto pointOperatingPoint = operatingPoint;
         // Rescale the time axis and recompute the harmonics the loss model needs, but
         // do NOT reshape the excitation. process_operating_point() reflects waveforms,
         // re-derives the magnetizing current and synthesises a voltage; fed an operating
         // point whose voltage had just been deleted by the rescale, it handed the loss
         // model different currents from the ones the Winding Losses panel uses, and the
         // curve sat ~44% above the panel even at the operating point's own frequency.
-        Inputs::scale_time_to_frequency(operatingPoint, frequency, false, true);
-
-        auto windingLosses =  WindingLosses().calculate_losses(magnetic, operatingPoint, temperature).get_winding_losses();
+        Inputs::scale_time_to_frequency(pointOperatingPoint, frequency, false, true);
 
-        windingLossesPerFrequency.push_back(windingLosses);
-    }
+        return WindingLosses().calculate_losses(chunkMagnetic, pointOperatingPoint, temperature).get_winding_losses();
+    });
 
     return Curve2D(frequencies, windingLossesPerFrequency, title);
 }
@@ -475,28 +440,16 @@ std::vector<ScalarMatrixAtFrequency> Sweeper::sweep_resistance_matrix_over_frequ
     double temperature, 
     std::string mode) {
     
-    std::vector<double> frequencies;
-    if (mode == "linear") {
-        frequencies = linear_spaced_array(start, stop, numberElements);
-    }
-    else if (mode == "log") {
-        frequencies = logarithmic_spaced_array(start, stop, numberElements);
-    }
-    else {
-        throw ModelNotAvailableException("Unknown spaced array mode");
-    }
+    auto frequencies = get_sweep_points(start, stop, numberElements, mode);
 
-    std::vector<ScalarMatrixAtFrequency> resistanceMatrices;
-    resistanceMatrices.reserve(numberElements);
-    
-    WindingLosses windingLossesModel;
-    
-    for (auto frequency : frequencies) {
-        auto resistanceMatrix = windingLossesModel.calculate_resistance_matrix(magnetic, temperature, frequency);
-        resistanceMatrices.push_back(resistanceMatrix);
-    }
-
-    return resistanceMatrices;
+    struct ResistanceMatrixState {
+        Magnetic magnetic;
+        WindingLosses model;
+    };
+    return evaluate_sweep(frequencies, [&] { return ResistanceMatrixState{magnetic, WindingLosses()}; },
+                          [&](ResistanceMatrixState& state, double frequency) {
+        return state.model.calculate_resistance_matrix(state.magnetic, temperature, frequency);
+    });
 }
 
 } // namespace OpenMagnetics
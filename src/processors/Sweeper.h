@@ -11,6 +11,9 @@ using namespace MAS;
 
 namespace OpenMagnetics {
 
+// Every sweep evaluates its points through parallel_for (support/Parallel.h),
+// honouring Settings::get_parallel_number_threads(). Points are independent and
+// written by index, so the curves are bit-identical for any thread count.
 class Sweeper {
     private:
     protected:
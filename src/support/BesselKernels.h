@@ -0,0 +1,44 @@
+#pragma once
+#include <complex>
+#include <vector>
+
+namespace OpenMagnetics {
+
+// Double-precision Bessel and Kelvin kernels for the skin and proximity
+// models, which evaluate them per wire and per harmonic.
+//
+// The generic series in support/Utils.h recompute tgammaf() and pow() for every
+// term and stop at a relative increment of 1e-4. The float gamma overflows
+// near k = 34, so beyond |z| ~ 25 they return garbage. These kernels build
+// each term from the previous one. Past a crossover they switch to the Hankel
+// asymptotic expansion, where the series would cancel catastrophically.
+//
+// ACCURACY (checked against the series in tests/TestBesselKernels.cpp):
+//   * kelvin_functions(): ~1e-12 relative to max(|ber|, |bei|) for x < 30
+//     (power series). For x >= 30 the asymptotic expansion gives full
+//     double precision.
+//   * modified_bessel_ratio_I1_I0(): continued fraction to 1e-15 for
+//     |z| < 20. Above that it keeps the 3-term asymptotic form the models
+//     have always used (< 0.1%).
+//
+// The batch overloads take arrays of arguments, so a sweep over wires or
+// harmonics is one call with no per-element dispatch.
+
+// ber_n(x), bei_n(x) and their derivatives, for integer order n and x >= 0.
+struct KelvinFunctions {
+    double ber;
+    double bei;
+    double derivativeBer;
+    double derivativeBei;
+};
+
+// J_n(z) for integer n >= 0 and any complex z.
+std::complex<double> bessel_first_kind_integer_order(int order, std::complex<double> z);
+
+KelvinFunctions kelvin_functions(int order, double x);
+std::vector<KelvinFunctions> kelvin_functions(int order, const std::vector<double>& x);
+
+std::complex<double> modified_bessel_ratio_I1_I0_kernel(std::complex<double> z);
+std::vector<std::complex<double>> modified_bessel_ratio_I1_I0_kernel(const std::vector<std::complex<double>>& z);
+
+} // namespace OpenMagnetics
@@ -0,0 +1,74 @@
+#pragma once
+#include "support/Exceptions.h"
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <optional>
+#include <string>
+
+namespace OpenMagnetics {
+
+// Shared cancel flag. Copies observe the same flag: the caller keeps one copy
+// and hands another to an adviser running on a different thread, then calls
+// cancel() to stop it at its next checkpoint.
+class CancellationToken {
+    public:
+        CancellationToken() : _cancelled(std::make_shared<std::atomic<bool>>(false)) {}
+
+        void cancel() const {
+            _cancelled->store(true, std::memory_order_relaxed);
+        }
+        bool is_cancelled() const {
+            return _cancelled->load(std::memory_order_relaxed);
+        }
+
+    private:
+        std::shared_ptr<std::atomic<bool>> _cancelled;
+};
+
+// When a long search has to give up: an optional cancellation token and an
+// optional wall-clock deadline. Default-constructed never stops. Cheap to copy
+// and to poll, so advisers check it between candidates and simply return what
+// they have; MagneticSimulator throws CalculationInterruptedException instead,
+// since a half-simulated Mas is not a result.
+class StopCondition {
+    public:
+        using Clock = std::chrono::steady_clock;
+
+        void set_cancellation_token(const CancellationToken& token) {
+            _cancellationToken = token;
+        }
+        void set_deadline(Clock::time_point deadline) {
+            _deadline = deadline;
+        }
+        // Deadline relative to now.
+        void set_time_limit(std::chrono::milliseconds timeLimit) {
+            _deadline = Clock::now() + timeLimit;
+        }
+
+        bool is_cancelled() const {
+            return _cancellationToken && _cancellationToken->is_cancelled();
+        }
+        bool deadline_passed() const {
+            return _deadline && Clock::now() >= _deadline.value();
+        }
+        bool should_stop() const {
+            return is_cancelled() || deadline_passed();
+        }
+
+        void throw_if_stop_requested(const std::string& context) const {
+            if (is_cancelled()) {
+                throw CalculationInterruptedException(ErrorCode::CALCULATION_CANCELLED, "Calculation cancelled", context);
+            }
+            if (deadline_passed()) {
+                throw CalculationInterruptedException(ErrorCode::CALCULATION_TIMEOUT, "Calculation deadline passed", context);
+            }
+        }
+
+    private:
+        std::optional<CancellationToken> _cancellationToken;
+        std::optional<Clock::time_point> _deadline;
+};
+
+} // namespace OpenMagnetics
@@ -19,6 +19,124 @@ using OpenMagnetics::linspace;
 
 namespace OpenMagnetics {
 
+namespace {
+
+template<typename T>
+void append_to_key(std::string& key, const T& value) {
+    key.append(reinterpret_cast<const char*>(&value), sizeof(value));
+}
+
+void append_to_key(std::string& key, const std::string& value) {
+    append_to_key(key, value.size());
+    key.append(value);
+}
+
+void append_to_key(std::string& key, const std::vector<double>& values) {
+    append_to_key(key, values.size());
+    for (auto value : values) {
+        append_to_key(key, value);
+    }
+}
+
+// Everything the per-turn generators read: turn placement and cross-section,
+// conducting dimensions, core shape/material/gapping/stacks and the mesher
+// settings. Raw bytes, so equal keys mean identical inputs.
+std::string get_mesh_geometry_key(char kind, Coil& coil, const std::vector<Turn>& turns, std::vector<Wire>& wirePerWinding, const Core& core, const std::vector<CoilMesherModels>& modelPerWinding) {
+    std::string key(1, kind);
+    append_to_key(key, settings.get_magnetic_field_mirroring_dimension());
+    append_to_key(key, settings.get_magnetic_field_include_fringing());
+    for (auto model : modelPerWinding) {
+        append_to_key(key, model);
+    }
+    for (auto& wire : wirePerWinding) {
+        append_to_key(key, wire.get_type());
+        // A wire without conducting dimensions can only mesh through models
+        // that never read them, so they cannot change its points either.
+        try {
+            append_to_key(key, wire.get_maximum_conducting_width());
+            append_to_key(key, wire.get_maximum_conducting_height());
+        }
+        catch (const std::exception&) {
+            append_to_key(key, std::numeric_limits<double>::quiet_NaN());
+        }
+    }
+    append_to_key(key, core.get_shape_family());
+    append_to_key(key, core.get_shape_name());
+    append_to_key(key, core.get_material_name());
+    append_to_key(key, core.get_number_stacks());
+    for (auto& gap : core.get_functional_description().get_gapping()) {
+        append_to_key(key, gap.get_length());
+    }
+    append_to_key(key, coil.get_functional_description().size());
+    for (auto& turn : turns) {
+        append_to_key(key, turn.get_winding());
+        append_to_key(key, turn.get_coordinates());
+        if (turn.get_additional_coordinates()) {
+            for (auto& coordinates : turn.get_additional_coordinates().value()) {
+                append_to_key(key, coordinates);
+            }
+        }
+        append_to_key(key, turn.get_dimensions().value_or(std::vector<double>{}));
+        append_to_key(key, turn.get_cross_sectional_shape().has_value());
+        append_to_key(key, turn.get_cross_sectional_shape().value_or(TurnCrossSectionalShape::ROUND));
+        append_to_key(key, turn.get_rotation().value_or(0.0));
+        append_to_key(key, turn.get_length());
+        append_to_key(key, turn.get_coordinate_system().value_or(CoordinateSystem::CARTESIAN));
+    }
+    return key;
+}
+
+CoilMesherModels get_default_mesher_model(Coil& coil, size_t windingIndex) {
+    switch(coil.get_wire_type(windingIndex)) {
+        case WireType::ROUND:
+        case WireType::LITZ:
+            return CoilMesherModels::CENTER;
+        case WireType::PLANAR:
+        case WireType::RECTANGULAR:
+        case WireType::FOIL:
+            return CoilMesherModels::WANG;
+        default:
+            throw InvalidInputException(ErrorCode::INVALID_WIRE_DATA, "Unknown type of wire");
+    }
+}
+
+std::shared_ptr<const CoilMeshCache::PointsPerTurn> get_points_per_turn(const Magnetic& magnetic, const std::string& key, const std::function<CoilMeshCache::PointsPerTurn()>& build) {
+    if (auto& cache = magnetic.get_coil_mesh_cache()) {
+        return cache->get_or_build(key, build);
+    }
+    return std::make_shared<const CoilMeshCache::PointsPerTurn>(build());
+}
+
+} // namespace
+
+std::shared_ptr<const CoilMeshCache::PointsPerTurn> CoilMeshCache::get_or_build(const std::string& key, const std::function<PointsPerTurn()>& build) {
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        auto entry = _entries.find(key);
+        if (entry != _entries.end()) {
+            return entry->second;
+        }
+    }
+    // Built outside the lock; a concurrent miss on the same key builds the
+    // same points and the first insert wins.
+    auto points = std::make_shared<const PointsPerTurn>(build());
+    std::lock_guard<std::mutex> lock(_mutex);
+    if (_entries.size() >= MAXIMUM_NUMBER_ENTRIES) {
+        _entries.clear();
+    }
+    return _entries.emplace(key, points).first->second;
+}
+
+size_t CoilMeshCache::size() {
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _entries.size();
+}
+
+void CoilMeshCache::clear() {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _entries.clear();
+}
+
 std::shared_ptr<CoilMesherModel> CoilMesherModel::factory(CoilMesherModels modelName){
     if (modelName == CoilMesherModels::CENTER) {
         return std::make_shared<CoilMesherCenterModel>();
@@ -30,6 +148,19 @@ std::shared_ptr<CoilMesherModel> CoilMesherModel::factory(CoilMesherModels model
         throw ModelNotAvailableException("Unknown coil breaker mode, available options are: {WANG, CENTER}");
 }
 
+const std::shared_ptr<CoilMesherModel>& CoilMesherModel::get_shared(CoilMesherModels modelName){
+    static const std::shared_ptr<CoilMesherModel> centerModel = factory(CoilMesherModels::CENTER);
+    static const std::shared_ptr<CoilMesherModel> wangModel = factory(CoilMesherModels::WANG);
+    if (modelName == CoilMesherModels::CENTER) {
+        return centerModel;
+    }
+    else if (modelName == CoilMesherModels::WANG) {
+        return wangModel;
+    }
+    else
+        throw ModelNotAvailableException("Unknown coil breaker mode, available options are: {WANG, CENTER}");
+}
+
 
 std::vector<size_t> CoilMesher::get_common_harmonic_indexes(OperatingPoint operatingPoint, double windingLossesHarmonicAmplitudeThreshold) {
     auto commonHarmonicIndexes = get_main_harmonic_indexes(operatingPoint, windingLossesHarmonicAmplitudeThreshold);
@@ -325,42 +456,11 @@ std::vector<Field> CoilMesher::generate_mesh_inducing_coil(Magnetic magnetic, Op
         throw InvalidInputException(ErrorCode::MISSING_DATA, "Input has no waveform. TODO: get waveform from processed data");
     }
 
+    std::vector<CoilMesherModels> modelPerWinding;
     std::vector<std::shared_ptr<CoilMesherModel>> breakdownModelPerWinding;
-
     for (size_t windingIndex = 0; windingIndex < coil.get_functional_description().size(); ++windingIndex) {
-        std::shared_ptr<CoilMesherModel> model;
-
-        if (coilMesherModel) {
-            model = CoilMesherModel::factory(coilMesherModel.value());
-        }
-        else {
-            switch(coil.get_wire_type(windingIndex)) {
-                case WireType::ROUND: {
-                    model = CoilMesherModel::factory(CoilMesherModels::CENTER);
-                    break;
-                }
-                case WireType::LITZ: {
-                    model = CoilMesherModel::factory(CoilMesherModels::CENTER);
-                    break;
-                }
-                case WireType::PLANAR: {
-                    model = CoilMesherModel::factory(CoilMesherModels::WANG);
-                    break;
-                }
-                case WireType::RECTANGULAR: {
-                    model = CoilMesherModel::factory(CoilMesherModels::WANG);
-                    break;
-                }
-                case WireType::FOIL: {
-                    model = CoilMesherModel::factory(CoilMesherModels::WANG);
-                    break;
-                }
-                default:
-                    throw InvalidInputException(ErrorCode::INVALID_WIRE_DATA, "Unknown type of wire");
-            }
-        }
-
-        breakdownModelPerWinding.push_back(model);
+        modelPerWinding.push_back(coilMesherModel ? coilMesherModel.value() : get_default_mesher_model(coil, windingIndex));
+        breakdownModelPerWinding.push_back(CoilMesherModel::get_shared(modelPerWinding.back()));
     }
 
     auto commonHarmonicIndexes = get_common_harmonic_indexes(operatingPoint, windingLossesHarmonicAmplitudeThreshold);
@@ -385,17 +485,29 @@ std::vector<Field> CoilMesher::generate_mesh_inducing_coil(Magnetic magnetic, Op
     // Hoisted: the MAS getter copies the whole Core (cached material datasets included);
     // fetching it per turn dominated this loop's cost.
     auto meshCore = magnetic.get_core();
+    auto key = get_mesh_geometry_key('i', coil, turns, wirePerWinding, meshCore, modelPerWinding);
+    auto pointsPerTurn = get_points_per_turn(magnetic, key, [&]() {
+        CoilMeshCache::PointsPerTurn points;
+        points.reserve(turns.size());
+        for (size_t turnIndex = 0; turnIndex < turns.size(); ++turnIndex) {
+            auto& turn = turns[turnIndex];
+            int windingIndex = coil.get_winding_index_by_name(turn.get_winding());
+            auto wire = wirePerWinding[windingIndex];
+            points.push_back(breakdownModelPerWinding[windingIndex]->generate_mesh_inducing_turn(turn, wire, turnIndex, turn.get_length(), meshCore));
+        }
+        return points;
+    });
+
     for (size_t turnIndex = 0; turnIndex < turns.size(); ++turnIndex) {
-        auto turn = turns[turnIndex];
+        auto& turn = turns[turnIndex];
         int windingIndex = coil.get_winding_index_by_name(turn.get_winding());
-        auto wire = wirePerWinding[windingIndex];
         auto excitationCurrent = operatingPoint.get_excitations_per_winding()[windingIndex].get_current();
         if (!excitationCurrent || !excitationCurrent->get_harmonics()) {
             throw InvalidInputException(ErrorCode::MISSING_DATA, "Current for winding " + std::to_string(windingIndex) + " is missing harmonics in Coil Mesher");
         }
         auto harmonics = excitationCurrent->get_harmonics().value();
 
-        auto fieldPoints = breakdownModelPerWinding[windingIndex]->generate_mesh_inducing_turn(turn, wire, turnIndex, turn.get_length(), meshCore);
+        auto& fieldPoints = (*pointsPerTurn)[turnIndex];
 
         for (auto harmonicIndex : commonHarmonicIndexes) {
             double harmonicCurrentPeak = 0;
@@ -451,38 +563,11 @@ std::vector<Field> CoilMesher::generate_mesh_induced_coil(Magnetic magnetic, Ope
     auto wirePerWinding = coil.get_wires();
     auto turns = coil.get_turns_description().value();
 
+    std::vector<CoilMesherModels> modelPerWinding;
     std::vector<std::shared_ptr<CoilMesherModel>> breakdownModelPerWinding;
-
-    for (size_t windingIndex = 0; windingIndex < coil.get_functional_description().size(); ++windingIndex)
-    {
-        std::shared_ptr<CoilMesherModel> model;
-
-        switch(coil.get_wire_type(windingIndex)) {
-            case WireType::ROUND: {
-                model = CoilMesherModel::factory(CoilMesherModels::CENTER);
-                break;
-            }
-            case WireType::LITZ: {
-                model = CoilMesherModel::factory(CoilMesherModels::CENTER);
-                break;
-            }
-            case WireType::PLANAR: {
-                model = CoilMesherModel::factory(CoilMesherModels::WANG);
-                break;
-            }
-            case WireType::RECTANGULAR: {
-                model = CoilMesherModel::factory(CoilMesherModels::WANG);
-                break;
-            }
-            case WireType::FOIL: {
-                model = CoilMesherModel::factory(CoilMesherModels::WANG);
-                break;
-            }
-            default:
-                throw InvalidInputException(ErrorCode::INVALID_WIRE_DATA, "Unknown type of wire");
-        }
-
-        breakdownModelPerWinding.push_back(model);
+    for (size_t windingIndex = 0; windingIndex < coil.get_functional_description().size(); ++windingIndex) {
+        modelPerWinding.push_back(get_default_mesher_model(coil, windingIndex));
+        breakdownModelPerWinding.push_back(CoilMesherModel::get_shared(modelPerWinding.back()));
     }
 
     auto commonHarmonicIndexes = get_common_harmonic_indexes(operatingPoint, windingLossesHarmonicAmplitudeThreshold);
@@ -501,17 +586,29 @@ std::vector<Field> CoilMesher::generate_mesh_induced_coil(Magnetic magnetic, Ope
 
     // Hoisted like the inducing loop: one Core copy for the whole mesh, not one per turn.
     auto meshCore = magnetic.get_core();
+    auto key = get_mesh_geometry_key('d', coil, turns, wirePerWinding, meshCore, modelPerWinding);
+    auto pointsPerTurn = get_points_per_turn(magnetic, key, [&]() {
+        CoilMeshCache::PointsPerTurn points;
+        points.reserve(turns.size());
+        for (size_t turnIndex = 0; turnIndex < turns.size(); ++turnIndex) {
+            auto& turn = turns[turnIndex];
+            int windingIndex = coil.get_winding_index_by_name(turn.get_winding());
+            auto wire = wirePerWinding[windingIndex];
+            points.push_back(breakdownModelPerWinding[windingIndex]->generate_mesh_induced_turn(turn, wire, turnIndex, &meshCore));
+        }
+        return points;
+    });
+
     for (size_t turnIndex = 0; turnIndex < turns.size(); ++turnIndex) {
-        auto turn = turns[turnIndex];
+        auto& turn = turns[turnIndex];
         int windingIndex = coil.get_winding_index_by_name(turn.get_winding());
-        auto wire = wirePerWinding[windingIndex];
         auto excitationCurrent = operatingPoint.get_excitations_per_winding()[windingIndex].get_current();
         if (!excitationCurrent || !excitationCurrent->get_harmonics()) {
             throw InvalidInputException(ErrorCode::MISSING_DATA, "Current for winding " + std::to_string(windingIndex) + " is missing harmonics in Coil Mesher");
         }
         auto harmonics = excitationCurrent->get_harmonics().value();
 
-        auto fieldPoints = breakdownModelPerWinding[windingIndex]->generate_mesh_induced_turn(turn, wire, turnIndex, &meshCore);
+        auto& fieldPoints = (*pointsPerTurn)[turnIndex];
 
         for (auto harmonicIndex : commonHarmonicIndexes) {
             for (auto& fieldPoint : fieldPoints) {
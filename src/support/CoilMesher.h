@@ -8,7 +8,10 @@
 #include <filesystem>
 #include <fstream>
 #include <iostream>
+#include <functional>
 #include <map>
+#include <memory>
+#include <mutex>
 #include <numbers>
 #include <streambuf>
 #include <vector>
@@ -23,12 +26,34 @@ enum class CoilMesherModels : int {
     CENTER
 };
 
+// Geometry-only layer of the coil mesh: the FieldPoints every turn contributes
+// for a unit current. They depend on the turns, wires, core and the mesher
+// settings, never on the operating point, so CoilMesher builds them once and
+// applies the harmonic currents afterwards as a scaling pass.
+// Entries are keyed by the exact geometry they were built from: a magnetic
+// whose turns were rewritten (e.g. the toroid outer-half pass) misses instead
+// of reading stale points. Shared between threads, guarded by a mutex.
+class CoilMeshCache {
+  public:
+    using PointsPerTurn = std::vector<std::vector<FieldPoint>>;
+
+    std::shared_ptr<const PointsPerTurn> get_or_build(const std::string& key, const std::function<PointsPerTurn()>& build);
+    size_t size();
+    void clear();
+
+  private:
+    static constexpr size_t MAXIMUM_NUMBER_ENTRIES = 16;
+    std::mutex _mutex;
+    std::map<std::string, std::shared_ptr<const PointsPerTurn>> _entries;
+};
+
 
 class CoilMesher {
   private:
   protected:
     double _quickModeForManyHarmonicsThreshold = 1;
   public:
+    // Both mesh generators reuse Magnetic::get_coil_mesh_cache() when one is attached.
     std::vector<Field> generate_mesh_inducing_coil(Magnetic magnetic, OperatingPoint operatingPoint, double windingLossesHarmonicAmplitudeThreshold = defaults.harmonicAmplitudeThreshold, std::optional<std::vector<int8_t>> customCurrentDirectionPerWinding = std::nullopt, std::optional<CoilMesherModels> coilMesherModel = std::nullopt);
     std::vector<Field> generate_mesh_induced_coil(Magnetic magnetic, OperatingPoint operatingPoint, double windingLossesHarmonicAmplitudeThreshold = defaults.harmonicAmplitudeThreshold);
     std::vector<size_t> get_common_harmonic_indexes(OperatingPoint operatingPoint, double windingLossesHarmonicAmplitudeThreshold);
@@ -56,6 +81,9 @@ class CoilMesherModel {
     // sample here.
     virtual std::vector<FieldPoint> generate_mesh_induced_turn(const Turn& turn, Wire& wire, std::optional<size_t> turnIndex = std::nullopt, const Core* core = nullptr) = 0;
     static std::shared_ptr<CoilMesherModel> factory(CoilMesherModels modelName);
+    // The models hold no per-call state: one instance per model serves every
+    // winding, call and thread.
+    static const std::shared_ptr<CoilMesherModel>& get_shared(CoilMesherModels modelName);
 
 };
 
@@ -86,7 +86,8 @@ enum class ErrorCode : int {
     // Calculation result errors (1300-1399)
     CALCULATION_INVALID_RESULT = 1300,
     CALCULATION_TIMEOUT = 1301,
-    INVALID_LOSS_DATA = 1302
+    INVALID_LOSS_DATA = 1302,
+    CALCULATION_CANCELLED = 1303
 };
 
 /**
@@ -135,6 +136,7 @@ inline std::string to_string(ErrorCode code) {
         case ErrorCode::CALCULATION_INVALID_RESULT: return "CALCULATION_INVALID_RESULT";
         case ErrorCode::CALCULATION_TIMEOUT: return "CALCULATION_TIMEOUT";
         case ErrorCode::INVALID_LOSS_DATA: return "INVALID_LOSS_DATA";
+        case ErrorCode::CALCULATION_CANCELLED: return "CALCULATION_CANCELLED";
         default: return "UNKNOWN";
     }
 }
@@ -289,6 +291,15 @@ public:
         : CalculationException(code, message) {}
 };
 
+/**
+ * @brief A calculation stopped by its StopCondition (CALCULATION_CANCELLED or CALCULATION_TIMEOUT)
+ */
+class CalculationInterruptedException : public CalculationException {
+public:
+    CalculationInterruptedException(ErrorCode code, const std::string& message, const std::string& context = "")
+        : CalculationException(code, message, context) {}
+};
+
 // ============================================================================
 // Gap Exceptions
 // ============================================================================
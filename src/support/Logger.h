@@ -19,6 +19,9 @@
 #include <functional>
 #include <memory>
 #include <vector>
+#include <cstdint>
+#include <string_view>
+#include <thread>
 
 namespace OpenMagnetics {
 
@@ -193,8 +196,121 @@ private:
     std::ostringstream _buffer;
 };
 
+/**
+ * @brief What an asynchronous logger does when its queue is full
+ */
+enum class LogOverflowPolicy : uint8_t {
+    BLOCK = 0, ///< The logging thread waits for room (nothing is lost)
+    DROP = 1   ///< The message is dropped and counted
+};
+
+/**
+ * @brief One message waiting in the asynchronous queue
+ *
+ * The timestamp stays a time point until the flush thread formats it.
+ */
+struct LogRecord {
+    LogLevel level = LogLevel::INFO;
+    std::string moduleOfOrigin;
+    std::string message;
+    std::chrono::system_clock::time_point time;
+};
+
+/**
+ * @brief Bounded multi-producer ring buffer of log records
+ *
+ * Lock-free for the producers (D. Vyukov's bounded MPMC queue): each cell
+ * carries a sequence number telling whether it is free for the producer at
+ * that position or full for the consumer. The capacity is rounded up to a
+ * power of two.
+ */
+class LogRingBuffer {
+public:
+    explicit LogRingBuffer(size_t capacity) {
+        size_t roundedCapacity = 2;
+        while (roundedCapacity < capacity) {
+            roundedCapacity *= 2;
+        }
+        _mask = roundedCapacity - 1;
+        _cells = std::make_unique<Cell[]>(roundedCapacity);
+        for (size_t index = 0; index < roundedCapacity; ++index) {
+            _cells[index].sequence.store(index, std::memory_order_relaxed);
+        }
+    }
+
+    size_t capacity() const { return _mask + 1; }
+
+    /**
+     * @brief Move record into the queue, or leave it untouched and return false when full
+     */
+    bool tryPush(LogRecord& record) {
+        size_t position = _enqueuePosition.load(std::memory_order_relaxed);
+        Cell* cell;
+        while (true) {
+            cell = &_cells[position & _mask];
+            size_t sequence = cell->sequence.load(std::memory_order_acquire);
+            auto difference = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(position);
+            if (difference == 0) {
+                if (_enqueuePosition.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)) {
+                    break;
+                }
+            }
+            else if (difference < 0) {
+                return false;
+            }
+            else {
+                position = _enqueuePosition.load(std::memory_order_relaxed);
+            }
+        }
+        cell->record = std::move(record);
+        cell->sequence.store(position + 1, std::memory_order_release);
+        return true;
+    }
+
+    bool tryPop(LogRecord& record) {
+        size_t position = _dequeuePosition.load(std::memory_order_relaxed);
+        Cell* cell;
+        while (true) {
+            cell = &_cells[position & _mask];
+            size_t sequence = cell->sequence.load(std::memory_order_acquire);
+            auto difference = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(position + 1);
+            if (difference == 0) {
+                if (_dequeuePosition.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)) {
+                    break;
+                }
+            }
+            else if (difference < 0) {
+                return false;
+            }
+            else {
+                position = _dequeuePosition.load(std::memory_order_relaxed);
+            }
+        }
+        record = std::move(cell->record);
+        cell->sequence.store(position + _mask + 1, std::memory_order_release);
+        return true;
+    }
+
+private:
+    struct Cell {
+        std::atomic<size_t> sequence;
+        LogRecord record;
+    };
+
+    std::unique_ptr<Cell[]> _cells;
+    size_t _mask = 0;
+    alignas(64) std::atomic<size_t> _enqueuePosition{0};
+    alignas(64) std::atomic<size_t> _dequeuePosition{0};
+};
+
 /**
  * @brief Main logger class (singleton)
+ *
+ * Synchronous by default: every message that passes the level check is
+ * written to the sinks under one mutex. enableAsync() switches to a bounded
+ * queue drained by a background thread, so logging threads only pay for a
+ * copy of the message and never wait for each other or the sinks. The
+ * timestamp is formatted on the flush thread.
  */
 class Logger {
 public:
@@ -225,6 +341,71 @@ public:
     LogLevel getLevel() const {
         return _level;
     }
+
+    /**
+     * @brief Whether a message at this level would reach the sinks
+     *
+     * The logging macros check this before evaluating their message, so a
+     * disabled call site builds no string.
+     */
+    bool isEnabled(LogLevel level) const {
+        return level != LogLevel::OFF && level >= _level.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Queue messages and write them from a background thread
+     * @param capacity Queue length, rounded up to a power of two
+     * @param policy What a logging thread does when the queue is full
+     *
+     * Dropped messages are counted (getDroppedCount()) and reported through
+     * the sinks once there is room again. Call enableAsync() while no other
+     * thread is logging, e.g. at start-up.
+     */
+    void enableAsync(size_t capacity = 8192, LogOverflowPolicy policy = LogOverflowPolicy::BLOCK) {
+        disableAsync();
+        _ring = std::make_unique<LogRingBuffer>(capacity);
+        _overflowPolicy = policy;
+        _stopping.store(false);
+        _flushThread = std::thread([this] { drainQueue(); });
+        _async.store(true, std::memory_order_release);
+    }
+
+    /**
+     * @brief Write everything still queued and return to synchronous logging
+     *
+     * Safe while other threads log: new messages go the synchronous way, and
+     * the queue is only released once every producer already inside enqueue()
+     * has left it.
+     */
+    void disableAsync() {
+        if (!_flushThread.joinable()) {
+            return;
+        }
+        _async.store(false);
+        // The flush thread keeps draining meanwhile, so a producer blocked on
+        // a full queue gets its room and leaves.
+        while (_producersInFlight.load() != 0) {
+            _pendingSignal.fetch_add(1, std::memory_order_release);
+            _pendingSignal.notify_one();
+            std::this_thread::yield();
+        }
+        _stopping.store(true);
+        _pendingSignal.fetch_add(1, std::memory_order_release);
+        _pendingSignal.notify_one();
+        _flushThread.join();
+        _ring.reset();
+    }
+
+    bool isAsync() const {
+        return _async.load(std::memory_order_acquire);
+    }
+
+    /**
+     * @brief Messages dropped by the DROP overflow policy so far
+     */
+    size_t getDroppedCount() const {
+        return _dropped.load(std::memory_order_relaxed);
+    }
     
     /**
      * @brief Add a log sink
@@ -242,6 +423,14 @@ public:
         std::lock_guard<std::mutex> lock(_mutex);
         _sinks.clear();
     }
+
+    /**
+     * @brief Remove one sink
+     */
+    void removeSink(const std::shared_ptr<LogSink>& sink) {
+        std::lock_guard<std::mutex> lock(_mutex);
+        std::erase(_sinks, sink);
+    }
     
     /**
      * @brief Log a message
@@ -250,13 +439,25 @@ public:
      * @param message The message to log
      */
     void log(LogLevel level, const std::string& moduleOfOrigin, const std::string& message) {
-        if (level < _level) {
+        if (!isEnabled(level)) {
             return;
         }
+
+        if (_async.load(std::memory_order_acquire)) {
+            // Announce the producer before re-checking, so disableAsync()
+            // either sees it and waits or has already switched us off.
+            _producersInFlight.fetch_add(1);
+            if (_async.load()) {
+                enqueue(LogRecord{level, moduleOfOrigin, message, std::chrono::system_clock::now()});
+                _producersInFlight.fetch_sub(1, std::memory_order_release);
+                return;
+            }
+            _producersInFlight.fetch_sub(1, std::memory_order_release);
+        }
         
         std::lock_guard<std::mutex> lock(_mutex);
         
-        auto timestamp = getTimestamp();
+        auto timestamp = formatTimestamp(std::chrono::system_clock::now());
         
         for (auto& sink : _sinks) {
             sink->write(level, moduleOfOrigin, message, timestamp);
@@ -265,8 +466,19 @@ public:
     
     /**
      * @brief Flush all sinks
+     *
+     * In asynchronous mode, first waits until every message queued before
+     * the call has been written.
      */
     void flush() {
+        if (_async.load(std::memory_order_acquire)) {
+            auto queued = _enqueued.load(std::memory_order_acquire);
+            while (_written.load(std::memory_order_acquire) < queued) {
+                _pendingSignal.fetch_add(1, std::memory_order_release);
+                _pendingSignal.notify_one();
+                std::this_thread::yield();
+            }
+        }
         std::lock_guard<std::mutex> lock(_mutex);
         for (auto& sink : _sinks) {
             sink->flush();
@@ -304,9 +516,68 @@ private:
         _sinks.push_back(std::make_shared<ConsoleSink>());
         _level = LogLevel::ERROR;
     }
+
+    ~Logger() {
+        disableAsync();
+    }
+
+    void enqueue(LogRecord record) {
+        while (!_ring->tryPush(record)) {
+            if (_overflowPolicy == LogOverflowPolicy::DROP) {
+                _dropped.fetch_add(1, std::memory_order_relaxed);
+                return;
+            }
+            _pendingSignal.fetch_add(1, std::memory_order_release);
+            _pendingSignal.notify_one();
+            std::this_thread::yield();
+        }
+        _enqueued.fetch_add(1, std::memory_order_release);
+        _pendingSignal.fetch_add(1, std::memory_order_release);
+        _pendingSignal.notify_one();
+    }
+
+    // Body of the flush thread: write whatever is queued, then sleep until a
+    // producer signals. Exits once stopping and the queue is empty.
+    void drainQueue() {
+        LogRecord record;
+        size_t reportedDropped = 0;
+        while (true) {
+            auto seen = _pendingSignal.load(std::memory_order_acquire);
+            while (_ring->tryPop(record)) {
+                std::lock_guard<std::mutex> lock(_mutex);
+                auto timestamp = formatTimestamp(record.time);
+                for (auto& sink : _sinks) {
+                    sink->write(record.level, record.moduleOfOrigin, record.message, timestamp);
+                }
+                _written.fetch_add(1, std::memory_order_release);
+            }
+            auto dropped = _dropped.load(std::memory_order_relaxed);
+            if (dropped != reportedDropped) {
+                std::lock_guard<std::mutex> lock(_mutex);
+                auto timestamp = formatTimestamp(std::chrono::system_clock::now());
+                for (auto& sink : _sinks) {
+                    sink->write(LogLevel::WARNING, "Logger", std::to_string(dropped - reportedDropped) + " message(s) dropped, queue full", timestamp);
+                }
+                reportedDropped = dropped;
+            }
+            if (_stopping.load()) {
+                if (!_ring->tryPop(record)) {
+                    return;
+                }
+                // A producer raced the stop; write it and look again.
+                std::lock_guard<std::mutex> lock(_mutex);
+                auto timestamp = formatTimestamp(record.time);
+                for (auto& sink : _sinks) {
+                    sink->write(record.level, record.moduleOfOrigin, record.message, timestamp);
+                }
+                _written.fetch_add(1, std::memory_order_release);
+                continue;
+            }
+            _pendingSignal.wait(seen, std::memory_order_acquire);
+        }
+    }
     
-    static std::string getTimestamp() {
-        auto now = std::chrono::system_clock::now();
+    static std::string formatTimestamp(std::chrono::system_clock::time_point now) {
         auto time = std::chrono::system_clock::to_time_t(now);
         auto ms = std::chrono::duration_cast<std::chrono::milliseconds>(
             now.time_since_epoch()) % 1000;
@@ -326,53 +597,75 @@ private:
     std::mutex _mutex;
     std::atomic<LogLevel> _level;
     std::vector<std::shared_ptr<LogSink>> _sinks;
+
+    std::unique_ptr<LogRingBuffer> _ring;
+    LogOverflowPolicy _overflowPolicy = LogOverflowPolicy::BLOCK;
+    std::thread _flushThread;
+    std::atomic<bool> _async{false};
+    std::atomic<bool> _stopping{false};
+    std::atomic<uint32_t> _pendingSignal{0};
+    std::atomic<size_t> _enqueued{0};
+    std::atomic<size_t> _written{0};
+    std::atomic<size_t> _dropped{0};
+    std::atomic<size_t> _producersInFlight{0};  // threads inside enqueue()
 };
 
 // ============================================================================
 // Logging Macros
 // ============================================================================
 
+// Each macro checks the level before evaluating `message`, so a disabled
+// call site costs one relaxed load and no allocation.
+
+#define OM_LOG_IF_ENABLED(level, call) \
+    do { \
+        auto& omLogger = OpenMagnetics::Logger::getInstance(); \
+        if (omLogger.isEnabled(level)) { \
+            omLogger.call; \
+        } \
+    } while (0)
+
 #define OM_LOG(level, message) \
-    OpenMagnetics::Logger::getInstance().log(level, "", message)
+    OM_LOG_IF_ENABLED(level, log(level, "", message))
 
 #define OM_LOG_MODULE(level, moduleName, message) \
-    OpenMagnetics::Logger::getInstance().log(level, moduleName, message)
+    OM_LOG_IF_ENABLED(level, log(level, moduleName, message))
 
 #define OM_TRACE(message) \
-    OpenMagnetics::Logger::getInstance().trace(message)
+    OM_LOG_IF_ENABLED(OpenMagnetics::LogLevel::TRACE, trace(message))
 
 #define OM_DEBUG(message) \
-    OpenMagnetics::Logger::getInstance().debug(message)
+    OM_LOG_IF_ENABLED(OpenMagnetics::LogLevel::DEBUG, debug(message))
 
 #define OM_INFO(message) \
-    OpenMagnetics::Logger::getInstance().info(message)
+    OM_LOG_IF_ENABLED(OpenMagnetics::LogLevel::INFO, info(message))
 
 #define OM_WARNING(message) \
-    OpenMagnetics::Logger::getInstance().warning(message)
+    OM_LOG_IF_ENABLED(OpenMagnetics::LogLevel::WARNING, warning(message))
 
 #define OM_ERROR(message) \
-    OpenMagnetics::Logger::getInstance().error(message)
+    OM_LOG_IF_ENABLED(OpenMagnetics::LogLevel::ERROR, error(message))
 
 #define OM_CRITICAL(message) \
-    OpenMagnetics::Logger::getInstance().critical(message)
+    OM_LOG_IF_ENABLED(OpenMagnetics::LogLevel::CRITICAL, critical(message))
 
 // Module-specific logging
 #define OM_TRACE_M(moduleName, message) \
-    OpenMagnetics::Logger::getInstance().trace(message, moduleName)
+    OM_LOG_IF_ENABLED(OpenMagnetics::LogLevel::TRACE, trace(message, moduleName))
 
 #define OM_DEBUG_M(moduleName, message) \
-    OpenMagnetics::Logger::getInstance().debug(message, moduleName)
+    OM_LOG_IF_ENABLED(OpenMagnetics::LogLevel::DEBUG, debug(message, moduleName))
 
 #define OM_INFO_M(moduleName, message) \
-    OpenMagnetics::Logger::getInstance().info(message, moduleName)
+    OM_LOG_IF_ENABLED(OpenMagnetics::LogLevel::INFO, info(message, moduleName))
 
 #define OM_WARNING_M(moduleName, message) \
-    OpenMagnetics::Logger::getInstance().warning(message, moduleName)
+    OM_LOG_IF_ENABLED(OpenMagnetics::LogLevel::WARNING, warning(message, moduleName))
 
 #define OM_ERROR_M(moduleName, message) \
-    OpenMagnetics::Logger::getInstance().error(message, moduleName)
+    OM_LOG_IF_ENABLED(OpenMagnetics::LogLevel::ERROR, error(message, moduleName))
 
 #define OM_CRITICAL_M(moduleName, message) \
-    OpenMagnetics::Logger::getInstance().critical(message, moduleName)
+    OM_LOG_IF_ENABLED(OpenMagnetics::LogLevel::CRITICAL, critical(message, moduleName))
 
 } // namespace OpenMagnetics
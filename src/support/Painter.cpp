@@ -6,7 +6,9 @@
 #include "constructive_models/Coil.h"
 #include "MAS.hpp"
 #include "support/Utils.h"
+#include "support/Parallel.h"
 #include "json.hpp"
+#include <algorithm>
 #include <cfloat>
 #include <chrono>
 #include <thread>
@@ -32,6 +34,54 @@ static size_t find_dominant_non_dc_harmonic_index(const Harmonics& harmonics) {
     return dominantIndex;
 }
 
+// Contiguous ranges of grid points, one per worker, split the way
+// evaluate_sweep_in_chunks() splits a sweep. Field plot points are
+// independent, so evaluating the tiles in parallel and reading them back in
+// order reproduces the serial result for any thread count.
+static std::vector<std::pair<size_t, size_t>> get_grid_tiles(size_t numberPoints) {
+    size_t numberTiles = std::max<size_t>(1, std::min(get_parallel_number_workers(), numberPoints));
+    std::vector<std::pair<size_t, size_t>> tiles;
+    for (size_t tile = 0; tile < numberTiles; ++tile) {
+        tiles.push_back({numberPoints * tile / numberTiles, numberPoints * (tile + 1) / numberTiles});
+    }
+    return tiles;
+}
+
+// H over the painter grid, one tile per worker. Each tile runs the field
+// calculation on its own slice of the grid with its own MagneticField, since
+// the model object swaps models and caches wire data while it sets up. Points
+// inside the core are dropped per tile as they are over the whole grid, so
+// the tiles concatenate to the serial output. Every tile meshes the same
+// inducing coil, so the turns go through a shared CoilMeshCache.
+static ComplexField calculate_magnetic_field_strength_tiled(MagneticFieldStrengthModels magneticFieldModel, MagneticFieldStrengthFringingEffectModels fringingEffectModel, const OperatingPoint& operatingPoint, Magnetic magnetic, const Field& inducedField) {
+    if (!magnetic.get_coil_mesh_cache()) {
+        magnetic.set_coil_mesh_cache(std::make_shared<CoilMeshCache>());
+    }
+    auto tiles = get_grid_tiles(inducedField.get_data().size());
+    if (tiles.size() == 1) {
+        MagneticField magneticField(magneticFieldModel, fringingEffectModel);
+        return magneticField.calculate_magnetic_field_strength_field(operatingPoint, magnetic, inducedField).get_field_per_frequency()[0];
+    }
+
+    std::vector<ComplexField> fieldPerTile(tiles.size());
+    parallel_for(tiles.size(), [&](size_t tile) {
+        auto& inducedData = inducedField.get_data();
+        Field inducedTile;
+        inducedTile.set_data(std::vector<FieldPoint>(inducedData.begin() + tiles[tile].first, inducedData.begin() + tiles[tile].second));
+        inducedTile.set_frequency(inducedField.get_frequency());
+        MagneticField magneticField(magneticFieldModel, fringingEffectModel);
+        fieldPerTile[tile] = magneticField.calculate_magnetic_field_strength_field(operatingPoint, magnetic, inducedTile).get_field_per_frequency()[0];
+    });
+
+    ComplexField field = fieldPerTile[0];
+    for (size_t tile = 1; tile < tiles.size(); ++tile) {
+        auto& data = field.get_mutable_data();
+        auto& tileData = fieldPerTile[tile].get_data();
+        data.insert(data.end(), tileData.begin(), tileData.end());
+    }
+    return field;
+}
+
 static void resolve_harmonic_index_for_painting(const Harmonics& harmonics, size_t& harmonicIndex) {
     if (harmonicIndex != 1 || harmonics.get_amplitudes().size() <= 2) {
         return;
@@ -87,18 +137,12 @@ ComplexField PainterInterface::calculate_magnetic_field(OperatingPoint operating
     auto magneticFieldModel = modelOverride.value_or(settings.get_magnetic_field_strength_model());
     // Use the configured fringing effect model from settings
     auto fringingEffectModel = settings.get_magnetic_field_strength_fringing_effect_model();
-    MagneticField magneticField(magneticFieldModel, fringingEffectModel);
     // RAII: restore the global magnetic-field settings on scope exit. They used to be
     // overwritten permanently, leaking the painter's fringing/mirroring choice into
     // every later physics computation in the process.
     SettingsGuard<bool> fringingGuard(settings, &Settings::get_magnetic_field_include_fringing, &Settings::set_magnetic_field_include_fringing, includeFringing);
     SettingsGuard<int> mirroringGuard(settings, &Settings::get_magnetic_field_mirroring_dimension, &Settings::set_magnetic_field_mirroring_dimension, mirroringDimension);
-    ComplexField field;
-    {
-        auto windingWindowMagneticStrengthFieldOutput = magneticField.calculate_magnetic_field_strength_field(operatingPoint, magnetic, inducedField);
-        field = windingWindowMagneticStrengthFieldOutput.get_field_per_frequency()[0];
-
-    }
+    ComplexField field = calculate_magnetic_field_strength_tiled(magneticFieldModel, fringingEffectModel, operatingPoint, magnetic, inducedField);
     auto turns = magnetic.get_coil().get_turns_description().value();
 
     if (turns[0].get_additional_coordinates()) {
@@ -108,8 +152,7 @@ ComplexField PainterInterface::calculate_magnetic_field(OperatingPoint operating
             }
         }
         magnetic.get_mutable_coil().set_turns_description(turns);
-        auto windingWindowMagneticStrengthFieldOutput = magneticField.calculate_magnetic_field_strength_field(operatingPoint, magnetic, inducedField);
-        auto additionalField = windingWindowMagneticStrengthFieldOutput.get_field_per_frequency()[0];
+        auto additionalField = calculate_magnetic_field_strength_tiled(magneticFieldModel, fringingEffectModel, operatingPoint, magnetic, inducedField);
         for (size_t pointIndex = 0; pointIndex < field.get_data().size(); ++pointIndex) {
             field.get_mutable_data()[pointIndex].set_real(field.get_mutable_data()[pointIndex].get_real() + additionalField.get_mutable_data()[pointIndex].get_real());
             field.get_mutable_data()[pointIndex].set_imaginary(field.get_mutable_data()[pointIndex].get_imaginary() + additionalField.get_mutable_data()[pointIndex].get_imaginary());
@@ -156,15 +199,13 @@ ComplexField PainterInterface::calculate_magnetic_field_internal_only(OperatingP
     auto modelOverride = settings.get_painter_magnetic_field_strength_model();
     auto magneticFieldModel = modelOverride.value_or(settings.get_magnetic_field_strength_model());
     auto fringingEffectModel = settings.get_magnetic_field_strength_fringing_effect_model();
-    MagneticField magneticField(magneticFieldModel, fringingEffectModel);
     // RAII: restore the global magnetic-field settings on scope exit. They used to be
     // overwritten permanently, leaking the painter's fringing/mirroring choice into
     // every later physics computation in the process.
     SettingsGuard<bool> fringingGuard(settings, &Settings::get_magnetic_field_include_fringing, &Settings::set_magnetic_field_include_fringing, includeFringing);
     SettingsGuard<int> mirroringGuard(settings, &Settings::get_magnetic_field_mirroring_dimension, &Settings::set_magnetic_field_mirroring_dimension, mirroringDimension);
     
-    auto windingWindowMagneticStrengthFieldOutput = magneticField.calculate_magnetic_field_strength_field(operatingPoint, magnetic, inducedField);
-    return windingWindowMagneticStrengthFieldOutput.get_field_per_frequency()[0];
+    return calculate_magnetic_field_strength_tiled(magneticFieldModel, fringingEffectModel, operatingPoint, magnetic, inducedField);
 }
 
 ComplexField PainterInterface::calculate_magnetic_field_external_only(OperatingPoint operatingPoint, Magnetic magnetic, size_t harmonicIndex) {
@@ -203,7 +244,6 @@ ComplexField PainterInterface::calculate_magnetic_field_external_only(OperatingP
     auto modelOverride = settings.get_painter_magnetic_field_strength_model();
     auto magneticFieldModel = modelOverride.value_or(settings.get_magnetic_field_strength_model());
     auto fringingEffectModel = settings.get_magnetic_field_strength_fringing_effect_model();
-    MagneticField magneticField(magneticFieldModel, fringingEffectModel);
     // RAII: restore the global magnetic-field settings on scope exit. They used to be
     // overwritten permanently, leaking the painter's fringing/mirroring choice into
     // every later physics computation in the process.
@@ -228,8 +268,7 @@ ComplexField PainterInterface::calculate_magnetic_field_external_only(OperatingP
     }
     
     magnetic.get_mutable_coil().set_turns_description(turns);
-    auto windingWindowMagneticStrengthFieldOutput = magneticField.calculate_magnetic_field_strength_field(operatingPoint, magnetic, inducedField);
-    return windingWindowMagneticStrengthFieldOutput.get_field_per_frequency()[0];
+    return calculate_magnetic_field_strength_tiled(magneticFieldModel, fringingEffectModel, operatingPoint, magnetic, inducedField);
 }
 
 
@@ -634,63 +673,68 @@ Field PainterInterface::calculate_electric_field_sdf(OperatingPoint operatingPoi
     }
 
     // --- Per-pixel: SDF Voronoi assignment + physics-based energy density ---
-    for (size_t pointIndex = 0; pointIndex < inducedField.get_data().size(); ++pointIndex) {
-        auto& datum = inducedField.get_data()[pointIndex];
-        auto& point = datum.get_point();
-        if (point.size() < 2) {
-            inducedField.get_mutable_data()[pointIndex].set_value(0);
-            continue;
-        }
-        double px = point[0];
-        double py = point[1];
-
-        // Find 2 nearest turns by SDF
-        double dBest = DBL_MAX, dSecond = DBL_MAX;
-        size_t iBest = 0, iSecond = 0;
-
-        for (size_t t = 0; t < turns.size(); ++t) {
-            double d = sdf_turn(px, py, turns[t]);
-            if (d < dBest) {
-                dSecond = dBest;  iSecond = iBest;
-                dBest = d;        iBest = t;
-            } else if (d < dSecond) {
-                dSecond = d;  iSecond = t;
+    // Pixels are independent and each writes only its own value, so the grid
+    // is evaluated in parallel tiles (see get_grid_tiles()).
+    auto tiles = get_grid_tiles(inducedField.get_data().size());
+    parallel_for(tiles.size(), [&](size_t tile) {
+        for (size_t pointIndex = tiles[tile].first; pointIndex < tiles[tile].second; ++pointIndex) {
+            auto& datum = inducedField.get_data()[pointIndex];
+            auto& point = datum.get_point();
+            if (point.size() < 2) {
+                inducedField.get_mutable_data()[pointIndex].set_value(0);
+                continue;
             }
-        }
+            double px = point[0];
+            double py = point[1];
 
-        // Only compute for pixels outside all turns
-        if (dBest <= 0 || turns.size() < 2) {
-            inducedField.get_mutable_data()[pointIndex].set_value(0);
-            continue;
-        }
+            // Find 2 nearest turns by SDF
+            double dBest = DBL_MAX, dSecond = DBL_MAX;
+            size_t iBest = 0, iSecond = 0;
 
-        // Find the voltage drop for this (iBest, iSecond) pair
-        double voltageDrop = 0;
-        bool found = false;
-        for (auto& pInfo : pairInfos) {
-            if ((pInfo.idx1 == iBest && pInfo.idx2 == iSecond) ||
-                (pInfo.idx1 == iSecond && pInfo.idx2 == iBest)) {
-                voltageDrop = pInfo.voltageDrop;
-                found = true;
-                break;
+            for (size_t t = 0; t < turns.size(); ++t) {
+                double d = sdf_turn(px, py, turns[t]);
+                if (d < dBest) {
+                    dSecond = dBest;  iSecond = iBest;
+                    dBest = d;        iBest = t;
+                } else if (d < dSecond) {
+                    dSecond = d;  iSecond = t;
+                }
             }
-        }
 
-        if (!found || voltageDrop < 1e-15) {
-            inducedField.get_mutable_data()[pointIndex].set_value(0);
-            continue;
-        }
+            // Only compute for pixels outside all turns
+            if (dBest <= 0 || turns.size() < 2) {
+                inducedField.get_mutable_data()[pointIndex].set_value(0);
+                continue;
+            }
+
+            // Find the voltage drop for this (iBest, iSecond) pair
+            double voltageDrop = 0;
+            bool found = false;
+            for (auto& pInfo : pairInfos) {
+                if ((pInfo.idx1 == iBest && pInfo.idx2 == iSecond) ||
+                    (pInfo.idx1 == iSecond && pInfo.idx2 == iBest)) {
+                    voltageDrop = pInfo.voltageDrop;
+                    found = true;
+                    break;
+                }
+            }
+
+            if (!found || voltageDrop < 1e-15) {
+                inducedField.get_mutable_data()[pointIndex].set_value(0);
+                continue;
+            }
 
-        // Compute physics-accurate energy density based on shape combination
-        double u = compute_energy_density_at_pixel(px, py,
-            turns[iBest], turns[iSecond], voltageDrop, epsilonEff);
+            // Compute physics-accurate energy density based on shape combination
+            double u = compute_energy_density_at_pixel(px, py,
+                turns[iBest], turns[iSecond], voltageDrop, epsilonEff);
 
-        // Ensure value is valid before setting
-        if (!std::isfinite(u) || u < 0) u = 0;
-        if (u > 1e300) u = 1e300;
+            // Ensure value is valid before setting
+            if (!std::isfinite(u) || u < 0) u = 0;
+            if (u > 1e300) u = 1e300;
 
-        inducedField.get_mutable_data()[pointIndex].set_value(u);
-    }
+            inducedField.get_mutable_data()[pointIndex].set_value(u);
+        }
+    });
 
     return inducedField;
 }
@@ -5,6 +5,9 @@
 #include "physical_models/Temperature.h"
 #include "support/Utils.h"
 #include <MAS.hpp>
+#include <cfloat>
+#include <functional>
+#include <unordered_map>
 #include "svg.hpp"
 #include "support/Exceptions.h"
 
@@ -44,6 +47,14 @@ enum class ElectricFieldVisualizationModel {
     SDF_PHYSICS   // SDF Voronoi decomposition + bipolar/plate energy density
 };
 
+// Colours come from Settings as "0xRRGGBB"; CSS wants "#RRGGBB". A plain scan,
+// not std::regex: this runs for every painted wire and field cell.
+inline std::string to_css_color(std::string color) {
+    for (size_t position = color.find("0x"); position != std::string::npos; position = color.find("0x", position + 1)) {
+        color.replace(position, 2, "#");
+    }
+    return color;
+}
 
 class PainterInterface {
  private:
@@ -443,6 +454,41 @@ class Painter : public PainterInterface {
     std::string get_color(double minimumValue, double maximumValue, std::string minimumColor, std::string maximumColor, double value);
     void paint_field_point(double xCoordinate, double yCoordinate, double xDimension, double yDimension, std::string color, std::string label);
 
+    // STYLE TABLE. One CSS class per distinct set of style attributes, added to
+    // _root's stylesheet the first time it is asked for. Wires and field cells
+    // of the same colour share a class instead of each adding its own rule.
+    std::unordered_map<std::string, std::string> _styleClasses;
+    const std::string& get_style_class(const std::vector<std::pair<std::string, std::string>>& attributes);
+
+    // STREAMED BLOCKS. Dense, uniform elements (field cells, litz strands) are
+    // written straight into text blocks instead of becoming _root DOM nodes.
+    // Each block is one placeholder group in the DOM, holding a bounding
+    // polygon so autoscale() still sees its extent. Elements painted before
+    // and after keep their z-order. export_svg() swaps each placeholder for
+    // its text.
+    struct StreamedBlock {
+        std::string id;
+        std::string content;
+        SVG::Group* placeholder;
+        double minimumX = DBL_MAX;
+        double minimumY = DBL_MAX;
+        double maximumX = -DBL_MAX;
+        double maximumY = -DBL_MAX;
+    };
+    std::vector<StreamedBlock> _streamedBlocks;
+    bool _streamedBlockOpen = false;
+    void begin_streamed_block();
+    void end_streamed_block();
+    // Coordinates in model units, as paint_rectangle() and paint_circle() take them.
+    void stream_rectangle(double xCoordinate, double yCoordinate, double xDimension, double yDimension, const std::string& cssClassName, const std::optional<std::string>& label);
+    void stream_circle(double xCoordinate, double yCoordinate, double radius, const std::string& cssClassName, const std::optional<std::string>& label);
+    std::string splice_streamed_blocks(std::string svg) const;
+
+    // PROGRESSIVE FIELD PLOTS (see set_progress_callback()).
+    static constexpr size_t progressiveCoarseningFactor = 4;
+    std::function<void(const std::string&)> _progressCallback;
+    void paint_field_preview(const std::function<void(Painter&)>& paintField);
+
  public:
     SVG::SVG _root;
     Painter() = default;
@@ -451,20 +497,20 @@ class Painter : public PainterInterface {
         _filepath = filepath.remove_filename();
         _root = SVG::SVG();
         
-        _root.style(".ferrite").set_attr("fill", std::regex_replace(std::string(settings.get_painter_color_ferrite()), std::regex("0x"), "#"));
-        _root.style(".bobbin").set_attr("fill", std::regex_replace(std::string(settings.get_painter_color_bobbin()), std::regex("0x"), "#"));
-        _root.style(".bobbin_translucent").set_attr("fill", std::regex_replace(std::string(settings.get_painter_color_bobbin()), std::regex("0x"), "#")).set_attr("opacity", 0.5);
-        _root.style(".margin").set_attr("fill", std::regex_replace(std::string(settings.get_painter_color_margin()), std::regex("0x"), "#"));
-        _root.style(".margin_translucent").set_attr("fill", std::regex_replace(std::string(settings.get_painter_color_margin()), std::regex("0x"), "#")).set_attr("opacity", 0.5);
-        _root.style(".spacer").set_attr("fill", std::regex_replace(std::string(settings.get_painter_color_spacer()), std::regex("0x"), "#"));
-        _root.style(".copper").set_attr("fill", std::regex_replace(std::string(settings.get_painter_color_copper()), std::regex("0x"), "#"));
-        _root.style(".copper_translucent").set_attr("fill", std::regex_replace(std::string(settings.get_painter_color_copper()), std::regex("0x"), "#")).set_attr("opacity", 0.5);
-        _root.style(".insulation").set_attr("fill", std::regex_replace(std::string(settings.get_painter_color_insulation()), std::regex("0x"), "#"));
-        _root.style(".insulation_translucent").set_attr("fill", std::regex_replace(std::string(settings.get_painter_color_insulation()), std::regex("0x"), "#")).set_attr("opacity", 0.5);
-        _root.style(".fr4").set_attr("fill", std::regex_replace(std::string(settings.get_painter_color_fr4()), std::regex("0x"), "#"));
-        _root.style(".fr4_translucent").set_attr("fill", std::regex_replace(std::string(settings.get_painter_color_fr4()), std::regex("0x"), "#")).set_attr("opacity", 0.5);
-        _root.style(".current_density").set_attr("fill", std::regex_replace(std::string(settings.get_painter_color_current_density()), std::regex("0x"), "#"));
-        _root.style(".text").set_attr("fill", std::regex_replace(std::string(settings.get_painter_color_text()), std::regex("0x"), "#"));
+        _root.style(".ferrite").set_attr("fill", to_css_color(settings.get_painter_color_ferrite()));
+        _root.style(".bobbin").set_attr("fill", to_css_color(settings.get_painter_color_bobbin()));
+        _root.style(".bobbin_translucent").set_attr("fill", to_css_color(settings.get_painter_color_bobbin())).set_attr("opacity", 0.5);
+        _root.style(".margin").set_attr("fill", to_css_color(settings.get_painter_color_margin()));
+        _root.style(".margin_translucent").set_attr("fill", to_css_color(settings.get_painter_color_margin())).set_attr("opacity", 0.5);
+        _root.style(".spacer").set_attr("fill", to_css_color(settings.get_painter_color_spacer()));
+        _root.style(".copper").set_attr("fill", to_css_color(settings.get_painter_color_copper()));
+        _root.style(".copper_translucent").set_attr("fill", to_css_color(settings.get_painter_color_copper())).set_attr("opacity", 0.5);
+        _root.style(".insulation").set_attr("fill", to_css_color(settings.get_painter_color_insulation()));
+        _root.style(".insulation_translucent").set_attr("fill", to_css_color(settings.get_painter_color_insulation())).set_attr("opacity", 0.5);
+        _root.style(".fr4").set_attr("fill", to_css_color(settings.get_painter_color_fr4()));
+        _root.style(".fr4_translucent").set_attr("fill", to_css_color(settings.get_painter_color_fr4())).set_attr("opacity", 0.5);
+        _root.style(".current_density").set_attr("fill", to_css_color(settings.get_painter_color_current_density()));
+        _root.style(".text").set_attr("fill", to_css_color(settings.get_painter_color_text()));
         _root.style(".white").set_attr("fill", "#ffffff");
         _root.style(".point").set_attr("fill", "#ff0000");
     };
@@ -472,6 +518,15 @@ class Painter : public PainterInterface {
 
     void paint_magnetic_field(OperatingPoint operatingPoint, Magnetic magnetic, size_t harmonicIndex = 1, std::optional<ComplexField> inputField = std::nullopt);
     void paint_electric_field(OperatingPoint operatingPoint, Magnetic magnetic, size_t harmonicIndex = 1, std::optional<Field> inputField = std::nullopt, ElectricFieldVisualizationModel model = ElectricFieldVisualizationModel::LEGACY, ColorPalette colorPalette = ColorPalette::VIRIDIS);
+    // Progressive mode for field plots. While a callback is set,
+    // paint_magnetic_field() and paint_electric_field() without an inputField
+    // first evaluate the grid with progressiveCoarseningFactor times fewer
+    // points per axis and pass the callback that preview (the field layer
+    // alone) as SVG text. They then paint the full grid as usual, so the
+    // final image is the same as without a callback.
+    void set_progress_callback(std::function<void(const std::string& previewSvg)> callback) {
+        _progressCallback = std::move(callback);
+    }
     void paint_wire_losses(Magnetic magnetic, std::optional<Outputs> outputs = std::nullopt, std::optional<OperatingPoint> operatingPoint = std::nullopt, double temperature=defaults.ambientTemperature);
 
     // Statics promoted from the deleted Painter wrapper (used by callers).
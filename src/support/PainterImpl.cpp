@@ -1,8 +1,10 @@
 #include "physical_models/WindingLosses.h"
 #include "support/Painter.h"
+#include "support/CoilMesher.h"
 #include "support/Utils.h"
 #include "support/CciCoordinatesData.h"
 #include <cfloat>
+#include <charconv>
 #include <cmath>
 #include <map>
 #include <set>
@@ -77,7 +79,7 @@ void Painter::paint_round_wire(double xCoordinate, double yCoordinate, Wire wire
         lineRadiusIncrease = coatingInfo.lineRadiusIncrease;
         coatingColor = coatingInfo.coatingColor;
     }
-    coatingColor = std::regex_replace(std::string(coatingColor), std::regex("0x"), "#");
+    coatingColor = to_css_color(coatingColor);
 
     SVG::Group* shapes = _root.add_child<SVG::Group>();
 
@@ -87,9 +89,7 @@ void Painter::paint_round_wire(double xCoordinate, double yCoordinate, Wire wire
     // }
     // Paint insulation
     {
-        std::string cssClassName = generate_random_string();
-
-        _root.style("." + cssClassName).set_attr("fill", coatingColor).set_attr("opacity", opacity);
+        const auto& cssClassName = get_style_class({{"fill", coatingColor}, {"opacity", std::to_string(opacity)}});
         paint_circle(xCoordinate, yCoordinate, outerDiameter / 2, cssClassName, shapes, 360, 0, {0, 0}, label);
     }
 
@@ -110,8 +110,7 @@ void Painter::paint_round_wire(double xCoordinate, double yCoordinate, Wire wire
 
     // Paint layer separation lines
     {
-        std::string cssClassName = generate_random_string();
-        _root.style("." + cssClassName).set_attr("opacity", opacity).set_attr("stroke-width", strokeWidth * _scale).set_attr("fill", "none").set_attr("stroke", std::regex_replace(std::string(settings.get_painter_color_lines()), std::regex("0x"), "#"));
+        const auto& cssClassName = get_style_class({{"opacity", std::to_string(opacity)}, {"stroke-width", std::to_string(strokeWidth * _scale)}, {"fill", "none"}, {"stroke", to_css_color(settings.get_painter_color_lines())}});
         
         for (size_t i = 0; i < numberLines; ++i) {
             paint_circle(xCoordinate, yCoordinate, currentLineDiameter / 2, cssClassName, shapes, 360, 0, {0, 0}, label);
@@ -201,20 +200,18 @@ void Painter::paint_litz_wire(double xCoordinate, double yCoordinate, Wire wire,
     }
 
 
-    coatingColor = std::regex_replace(std::string(coatingColor), std::regex("0x"), "#");
+    coatingColor = to_css_color(coatingColor);
 
     auto shapes = _root.add_child<SVG::Group>();
 
     // Paint insulation
     {
-        std::string cssClassName = generate_random_string();
-        _root.style("." + cssClassName).set_attr("opacity", _opacity).set_attr("fill", coatingColor);
+        const auto& cssClassName = get_style_class({{"opacity", std::to_string(_opacity)}, {"fill", coatingColor}});
         paint_circle(xCoordinate, yCoordinate, outerDiameter / 2, cssClassName, shapes, 360, 0, {0, 0}, label);
     }
     // Paint layer separation lines
     {
-        std::string cssClassName = generate_random_string();
-        _root.style("." + cssClassName).set_attr("stroke-width", strokeWidth * _scale).set_attr("fill", "none").set_attr("stroke", std::regex_replace(std::string(settings.get_painter_color_lines()), std::regex("0x"), "#"));
+        const auto& cssClassName = get_style_class({{"stroke-width", std::to_string(strokeWidth * _scale)}, {"fill", "none"}, {"stroke", to_css_color(settings.get_painter_color_lines())}});
         
         for (size_t i = 0; i < numberLines; ++i) {
             paint_circle(xCoordinate, yCoordinate, currentLineDiameter / 2, cssClassName, shapes, 360, 0, {0, 0}, label);
@@ -249,7 +246,7 @@ void Painter::paint_litz_wire(double xCoordinate, double yCoordinate, Wire wire,
                     Painter::paint_round_wire(xCoordinate + internalXCoordinate, yCoordinate - internalYCoordinate, strand);
                 }
                 else {
-                    paint_circle(xCoordinate + internalXCoordinate, yCoordinate - internalYCoordinate, strandOuterDiameter / 2, "copper", shapes, 360, 0, {0, 0}, label);
+                    stream_circle(xCoordinate + internalXCoordinate, yCoordinate - internalYCoordinate, strandOuterDiameter / 2, "copper", label);
                 }
             }
         }
@@ -267,7 +264,7 @@ void Painter::paint_litz_wire(double xCoordinate, double yCoordinate, Wire wire,
                     Painter::paint_round_wire(xCoordinate + internalXCoordinate, yCoordinate - internalYCoordinate, strand);
                 }
                 else {
-                    paint_circle(xCoordinate + internalXCoordinate, yCoordinate - internalYCoordinate, strandOuterDiameter / 2, "copper", shapes, 360, 0, {0, 0}, label);
+                    stream_circle(xCoordinate + internalXCoordinate, yCoordinate - internalYCoordinate, strandOuterDiameter / 2, "copper", label);
                 }
 
                 if (currentRadius > 0) {
@@ -288,7 +285,7 @@ void Painter::paint_litz_wire(double xCoordinate, double yCoordinate, Wire wire,
                 }
             }
         }
-
+        end_streamed_block();
     }
 }
 
@@ -305,8 +302,9 @@ void Painter::paint_rectangle(double xCoordinate, double yCoordinate, double xDi
     if (group == nullptr) {
         group = _root.add_child<SVG::Group>();
     }
-    *group << SVG::Polygon(scale_points(turnPoints, 0, _scale));
-    auto turnSvg = _root.get_children<SVG::Polygon>().back();
+    // add_child() hands back the new node; _root.get_children<>().back() walked
+    // the whole tree for every element painted.
+    auto turnSvg = group->add_child<SVG::Polygon>(scale_points(turnPoints, 0, _scale));
     turnSvg->set_attr("class", cssClassName);
     turnSvg->set_attr("transform", "rotate( " + std::to_string(-(angle)) + " " + std::to_string(center[0] * _scale) + " " + std::to_string(center[1] * _scale) + ") ");
     if (label) {
@@ -322,9 +320,7 @@ void Painter::paint_circle(double xCoordinate, double yCoordinate, double radius
     if (group == nullptr) {
         group = _root.add_child<SVG::Group>();
     }
-    *group << SVG::Circle(xCoordinate * _scale, -yCoordinate * _scale, radius * _scale);
-    auto turnSvg = _root.get_children<SVG::Circle>().back();
-    turnSvg = _root.get_children<SVG::Circle>().back();
+    auto turnSvg = group->add_child<SVG::Circle>(xCoordinate * _scale, -yCoordinate * _scale, radius * _scale);
     turnSvg->set_attr("class", cssClassName);
 
     // auto group = _root.add_child<SVG::Group>();
@@ -346,6 +342,167 @@ void Painter::paint_circle(double xCoordinate, double yCoordinate, double radius
     }
 }
 
+const std::string& Painter::get_style_class(const std::vector<std::pair<std::string, std::string>>& attributes) {
+    std::string key;
+    for (const auto& [name, value] : attributes) {
+        key += name + ":" + value + ";";
+    }
+    auto found = _styleClasses.find(key);
+    if (found != _styleClasses.end()) {
+        return found->second;
+    }
+    std::string cssClassName = generate_random_string();
+    for (const auto& [name, value] : attributes) {
+        _root.style("." + cssClassName).set_attr(name, value);
+    }
+    return _styleClasses.emplace(std::move(key), std::move(cssClassName)).first->second;
+}
+
+namespace {
+
+void append_svg_number(std::string& output, double value) {
+    char buffer[32];
+    auto result = std::to_chars(buffer, buffer + sizeof(buffer), value);
+    output.append(buffer, result.ptr);
+}
+
+void append_svg_text(std::string& output, const std::string& text) {
+    for (char character : text) {
+        switch (character) {
+            case '&': output += "&amp;"; break;
+            case '<': output += "&lt;"; break;
+            case '>': output += "&gt;"; break;
+            case '"': output += "&quot;"; break;
+            default: output += character;
+        }
+    }
+}
+
+} // namespace
+
+void Painter::begin_streamed_block() {
+    if (_streamedBlockOpen) {
+        return;
+    }
+    StreamedBlock block;
+    block.id = "streamed-block-" + std::to_string(_streamedBlocks.size());
+    block.placeholder = _root.add_child<SVG::Group>();
+    block.placeholder->set_attr("id", block.id);
+    _streamedBlocks.push_back(std::move(block));
+    _streamedBlockOpen = true;
+}
+
+void Painter::end_streamed_block() {
+    if (!_streamedBlockOpen) {
+        return;
+    }
+    _streamedBlockOpen = false;
+    auto& block = _streamedBlocks.back();
+    if (block.content.empty()) {
+        return;
+    }
+    std::vector<SVG::Point> bounds = {
+        SVG::Point(block.minimumX, block.minimumY),
+        SVG::Point(block.maximumX, block.minimumY),
+        SVG::Point(block.maximumX, block.maximumY),
+        SVG::Point(block.minimumX, block.maximumY),
+    };
+    block.placeholder->add_child<SVG::Polygon>(bounds);
+}
+
+void Painter::stream_rectangle(double xCoordinate, double yCoordinate, double xDimension, double yDimension, const std::string& cssClassName, const std::optional<std::string>& label) {
+    begin_streamed_block();
+    auto& block = _streamedBlocks.back();
+    // Same placement as paint_rectangle(): scaled, with y flipped.
+    double left = (xCoordinate - xDimension / 2) * _scale;
+    double top = -(yCoordinate + yDimension / 2) * _scale;
+    double width = xDimension * _scale;
+    double height = yDimension * _scale;
+    auto& output = block.content;
+    output += "<rect x=\"";
+    append_svg_number(output, left);
+    output += "\" y=\"";
+    append_svg_number(output, top);
+    output += "\" width=\"";
+    append_svg_number(output, width);
+    output += "\" height=\"";
+    append_svg_number(output, height);
+    output += "\" class=\"" + cssClassName + "\"";
+    if (label) {
+        output += "><title>";
+        append_svg_text(output, label.value());
+        output += "</title></rect>\n";
+    }
+    else {
+        output += " />\n";
+    }
+    block.minimumX = std::min(block.minimumX, left);
+    block.minimumY = std::min(block.minimumY, top);
+    block.maximumX = std::max(block.maximumX, left + width);
+    block.maximumY = std::max(block.maximumY, top + height);
+}
+
+void Painter::stream_circle(double xCoordinate, double yCoordinate, double radius, const std::string& cssClassName, const std::optional<std::string>& label) {
+    begin_streamed_block();
+    auto& block = _streamedBlocks.back();
+    double centerX = xCoordinate * _scale;
+    double centerY = -yCoordinate * _scale;
+    double scaledRadius = radius * _scale;
+    auto& output = block.content;
+    output += "<circle cx=\"";
+    append_svg_number(output, centerX);
+    output += "\" cy=\"";
+    append_svg_number(output, centerY);
+    output += "\" r=\"";
+    append_svg_number(output, scaledRadius);
+    output += "\" class=\"" + cssClassName + "\"";
+    if (label) {
+        output += "><title>";
+        append_svg_text(output, label.value());
+        output += "</title></circle>\n";
+    }
+    else {
+        output += " />\n";
+    }
+    block.minimumX = std::min(block.minimumX, centerX - scaledRadius);
+    block.minimumY = std::min(block.minimumY, centerY - scaledRadius);
+    block.maximumX = std::max(block.maximumX, centerX + scaledRadius);
+    block.maximumY = std::max(block.maximumY, centerY + scaledRadius);
+}
+
+// One forward pass: the placeholders are children of _root added in block
+// order, so they appear in the serialized document in that order too.
+std::string Painter::splice_streamed_blocks(std::string svg) const {
+    if (_streamedBlocks.empty()) {
+        return svg;
+    }
+    std::string spliced;
+    spliced.reserve(svg.size());
+    size_t cursor = 0;
+    for (const auto& block : _streamedBlocks) {
+        auto marker = svg.find("id=\"" + block.id + "\"", cursor);
+        if (marker == std::string::npos) {
+            continue;
+        }
+        auto opening = svg.rfind('<', marker);
+        auto openingEnd = svg.find('>', marker);
+        size_t end;
+        if (svg[openingEnd - 1] == '/') {
+            end = openingEnd + 1;
+        }
+        else {
+            end = svg.find("</g>", openingEnd) + 4;
+        }
+        spliced.append(svg, cursor, opening - cursor);
+        spliced += "<g>\n";
+        spliced += block.content;
+        spliced += "</g>";
+        cursor = end;
+    }
+    spliced.append(svg, cursor, std::string::npos);
+    return spliced;
+}
+
 void Painter::paint_rectangular_wire(double xCoordinate, double yCoordinate, Wire wire, double angle, std::vector<double> center, std::optional<std::string> label) {
     double outerWidth = 0;
     double outerHeight = 0;
@@ -402,7 +559,7 @@ void Painter::paint_rectangular_wire(double xCoordinate, double yCoordinate, Wir
         }
         strokeWidth = std::min(lineWidthIncrease / 10 / numberLines, lineHeightIncrease / 10 / numberLines);
     }
-    coatingColor = std::regex_replace(std::string(coatingColor), std::regex("0x"), "#");
+    coatingColor = to_css_color(coatingColor);
 
     SVG::Group* shapes = _root.add_child<SVG::Group>();
     // Paint insulation
@@ -422,7 +579,7 @@ void Painter::paint_rectangular_wire(double xCoordinate, double yCoordinate, Wir
 
     {
         std::string cssClassName = generate_random_string();
-        _root.style("." + cssClassName).set_attr("stroke-width", strokeWidth * _scale).set_attr("fill", "none").set_attr("stroke", std::regex_replace(std::string(settings.get_painter_color_lines()), std::regex("0x"), "#"));
+        _root.style("." + cssClassName).set_attr("stroke-width", strokeWidth * _scale).set_attr("fill", "none").set_attr("stroke", to_css_color(settings.get_painter_color_lines()));
         for (size_t i = 0; i < numberLines; ++i) {
             paint_rectangle(xCoordinate, yCoordinate, currentLineWidth, currentLineHeight, cssClassName, shapes, angle, center);
             currentLineWidth += lineWidthIncrease;
@@ -542,7 +699,7 @@ void Painter::paint_toroidal_coil_sections(Magnetic magnetic) {
                 double angularWidthDeg = sections[i].get_dimensions()[1];
                 double rectangleWidth = (initialRadius / 2.0) * angularWidthDeg * std::numbers::pi / 180.0;
                 std::string cssClassName = generate_random_string();
-                const std::string color = std::regex_replace(std::string(settings.get_painter_color_copper()),     std::regex("0x"), "#");
+                const std::string color = to_css_color(settings.get_painter_color_copper());
                 _root.style("." + cssClassName).set_attr("fill", color);
                 paint_rectangle(0, initialRadius / 2.0, rectangleWidth, initialRadius,
                                 cssClassName, nullptr, -90.0 + centerAngleDeg, {0, 0});
@@ -554,10 +711,10 @@ void Painter::paint_toroidal_coil_sections(Magnetic magnetic) {
 
             std::string cssClassName = generate_random_string();
             if (sections[i].get_type() == ElectricalType::CONDUCTION) {
-                _root.style("." + cssClassName).set_attr("stroke-width", strokeWidth * _scale).set_attr("fill", "none").set_attr("stroke", std::regex_replace(std::string(settings.get_painter_color_copper()), std::regex("0x"), "#"));
+                _root.style("." + cssClassName).set_attr("stroke-width", strokeWidth * _scale).set_attr("fill", "none").set_attr("stroke", to_css_color(settings.get_painter_color_copper()));
             }
             else {
-                _root.style("." + cssClassName).set_attr("stroke-width", strokeWidth * _scale).set_attr("fill", "none").set_attr("stroke", std::regex_replace(std::string(settings.get_painter_color_insulation()), std::regex("0x"), "#"));
+                _root.style("." + cssClassName).set_attr("stroke-width", strokeWidth * _scale).set_attr("fill", "none").set_attr("stroke", to_css_color(settings.get_painter_color_insulation()));
             }
 
             paint_circle(0, 0, circleDiameter / 2, cssClassName, nullptr, sections[i].get_dimensions()[1], -(sections[i].get_coordinates()[1] + sections[i].get_dimensions()[1] / 2), {0, 0});
@@ -634,7 +791,7 @@ void Painter::paint_toroidal_coil_layers(Magnetic magnetic) {
                 double angularWidthDeg = layers[i].get_dimensions()[1];
                 double rectangleWidth = (initialRadius / 2.0) * angularWidthDeg * std::numbers::pi / 180.0;
                 std::string cssClassName = generate_random_string();
-                const std::string color = std::regex_replace(std::string(settings.get_painter_color_copper()),     std::regex("0x"), "#");
+                const std::string color = to_css_color(settings.get_painter_color_copper());
                 _root.style("." + cssClassName).set_attr("fill", color);
                 paint_rectangle(0, initialRadius / 2.0, rectangleWidth, initialRadius,
                                 cssClassName, nullptr, -90.0 + centerAngleDeg, {0, 0});
@@ -646,10 +803,10 @@ void Painter::paint_toroidal_coil_layers(Magnetic magnetic) {
 
             std::string cssClassName = generate_random_string();
             if (layers[i].get_type() == ElectricalType::CONDUCTION) {
-                _root.style("." + cssClassName).set_attr("stroke-width", strokeWidth * _scale).set_attr("fill", "none").set_attr("stroke", std::regex_replace(std::string(settings.get_painter_color_copper()), std::regex("0x"), "#"));
+                _root.style("." + cssClassName).set_attr("stroke-width", strokeWidth * _scale).set_attr("fill", "none").set_attr("stroke", to_css_color(settings.get_painter_color_copper()));
             }
             else {
-                _root.style("." + cssClassName).set_attr("stroke-width", strokeWidth * _scale).set_attr("fill", "none").set_attr("stroke", std::regex_replace(std::string(settings.get_painter_color_insulation()), std::regex("0x"), "#"));
+                _root.style("." + cssClassName).set_attr("stroke-width", strokeWidth * _scale).set_attr("fill", "none").set_attr("stroke", to_css_color(settings.get_painter_color_insulation()));
             }
             paint_circle(0, 0, circleDiameter / 2, cssClassName, nullptr, layers[i].get_dimensions()[1], -(layers[i].get_coordinates()[1] + layers[i].get_dimensions()[1] / 2), {0, 0});
         }
@@ -810,8 +967,7 @@ void Painter::paint_toroidal_turn_connections(Magnetic magnetic, bool below) {
         previousOfConductor[key] = i;
     }
     auto shapes = _root.add_child<SVG::Group>();
-    const std::string copperColor =
-        std::regex_replace(std::string(settings.get_painter_color_copper()), std::regex("0x"), "#");
+    const std::string copperColor = to_css_color(settings.get_painter_color_copper());
     // TERMINALS. ABT #685 (Alf, 2026-08-18/19): "the pink terminal in all their length, not just
     // until the core ... outward past the core's outer radius, as the MVB++" and "the input
     // terminal below the core, the output terminals over the core". So the entrance is drawn in
@@ -1334,12 +1490,12 @@ void Painter::paint_toroidal_core(Core core) {
     double coatingThickness = core.get_functional_description().get_coating() ? core.get_coating_thickness() : 0.0;
     if (coatingThickness > 0) {
         std::string coatingCssClassName = generate_random_string();
-        _root.style("." + coatingCssClassName).set_attr("stroke-width", (strokeWidth + 2 * coatingThickness) * _scale).set_attr("fill", "none").set_attr("stroke", std::regex_replace(std::string(settings.get_painter_color_insulation()), std::regex("0x"), "#"));
+        _root.style("." + coatingCssClassName).set_attr("stroke-width", (strokeWidth + 2 * coatingThickness) * _scale).set_attr("fill", "none").set_attr("stroke", to_css_color(settings.get_painter_color_insulation()));
         paint_circle(0, 0, circleDiameter / 2, coatingCssClassName, nullptr);
     }
 
     std::string cssClassName = generate_random_string();
-    _root.style("." + cssClassName).set_attr("stroke-width", strokeWidth * _scale).set_attr("fill", "none").set_attr("stroke", std::regex_replace(std::string(settings.get_painter_color_ferrite()), std::regex("0x"), "#"));
+    _root.style("." + cssClassName).set_attr("stroke-width", strokeWidth * _scale).set_attr("fill", "none").set_attr("stroke", to_css_color(settings.get_painter_color_ferrite()));
     paint_circle(0, 0, circleDiameter / 2, cssClassName, nullptr);
 }
 
@@ -1476,7 +1632,7 @@ void Painter::paint_toroidal_margin(Magnetic magnetic) {
                         double angle = wound_distance_to_angle(margins[0], circleDiameter / 2 - strokeWidth / 2);
                         if (sections[i].get_type() == ElectricalType::CONDUCTION) {
                             std::string cssClassName = generate_random_string();
-                            _root.style("." + cssClassName).set_attr("stroke-width", strokeWidth * _scale).set_attr("fill", "none").set_attr("stroke", std::regex_replace(std::string(settings.get_painter_color_margin()), std::regex("0x"), "#"));
+                            _root.style("." + cssClassName).set_attr("stroke-width", strokeWidth * _scale).set_attr("fill", "none").set_attr("stroke", to_css_color(settings.get_painter_color_margin()));
                             paint_circle(0, 0, circleDiameter / 2, cssClassName, nullptr, angle, -(sections[i].get_coordinates()[1] - sections[i].get_dimensions()[1] / 2), {0, 0});
                         }
                     }
@@ -1490,7 +1646,7 @@ void Painter::paint_toroidal_margin(Magnetic magnetic) {
                         double angle = wound_distance_to_angle(margins[1], circleDiameter / 2 - strokeWidth / 2);
                         if (sections[i].get_type() == ElectricalType::CONDUCTION) {
                             std::string cssClassName = generate_random_string();
-                            _root.style("." + cssClassName).set_attr("stroke-width", strokeWidth * _scale).set_attr("fill", "none").set_attr("stroke", std::regex_replace(std::string(settings.get_painter_color_margin()), std::regex("0x"), "#"));
+                            _root.style("." + cssClassName).set_attr("stroke-width", strokeWidth * _scale).set_attr("fill", "none").set_attr("stroke", to_css_color(settings.get_painter_color_margin()));
                             paint_circle(0, 0, circleDiameter / 2, cssClassName, nullptr, angle, -(sections[i].get_coordinates()[1] + sections[i].get_dimensions()[1] / 2 + angle), {0, 0});
                         }
                     }
@@ -1506,7 +1662,7 @@ void Painter::paint_toroidal_margin(Magnetic magnetic) {
                     double angle = wound_distance_to_angle(sections[i].get_dimensions()[1], circleDiameter / 2 + strokeWidth / 2);
                     if (sections[i].get_type() == ElectricalType::CONDUCTION) {
                         std::string cssClassName = generate_random_string();
-                        _root.style("." + cssClassName).set_attr("stroke-width", strokeWidth * _scale).set_attr("fill", "none").set_attr("stroke", std::regex_replace(std::string(settings.get_painter_color_margin()), std::regex("0x"), "#"));
+                        _root.style("." + cssClassName).set_attr("stroke-width", strokeWidth * _scale).set_attr("fill", "none").set_attr("stroke", to_css_color(settings.get_painter_color_margin()));
                         paint_circle(0, 0, circleDiameter / 2, cssClassName, nullptr, angle, -(sections[i].get_coordinates()[1] - sections[i].get_dimensions()[1] / 2), {0, 0});
                     }
                 }
@@ -1520,7 +1676,7 @@ void Painter::paint_toroidal_margin(Magnetic magnetic) {
                     double angle = wound_distance_to_angle(sections[i].get_dimensions()[1], circleDiameter / 2 + strokeWidth / 2);
                     if (sections[i].get_type() == ElectricalType::CONDUCTION) {
                         std::string cssClassName = generate_random_string();
-                        _root.style("." + cssClassName).set_attr("stroke-width", strokeWidth * _scale).set_attr("fill", "none").set_attr("stroke", std::regex_replace(std::string(settings.get_painter_color_margin()), std::regex("0x"), "#"));
+                        _root.style("." + cssClassName).set_attr("stroke-width", strokeWidth * _scale).set_attr("fill", "none").set_attr("stroke", to_css_color(settings.get_painter_color_margin()));
                         paint_circle(0, 0, circleDiameter / 2, cssClassName, nullptr, angle, -(sections[i].get_coordinates()[1] + sections[i].get_dimensions()[1] / 2 + angle), {0, 0});
                     }
                 }
@@ -1767,17 +1923,31 @@ std::string Painter::get_color(double minimumValue, double maximumValue, std::st
 
 void Painter::paint_field_point(double xCoordinate, double yCoordinate, double xDimension, double yDimension, std::string color, std::string label) {
 
-    SVG::Group* shapes = _root.add_child<SVG::Group>();
+    // Thousands of cells per plot: streamed, and cells of one colour share a class.
+    const auto& cssClassName = get_style_class({{"opacity", std::to_string(_opacity)}, {"fill", color}, {"stroke", color}});
+    stream_rectangle(xCoordinate, yCoordinate, xDimension, yDimension, cssClassName, label);
+}
 
-    std::string cssClassName = generate_random_string();
 
-    // _root.style("." + cssClassName).set_attr("opacity", 0.5).set_attr("fill", color).set_attr("stroke", color);
-    _root.style("." + cssClassName).set_attr("opacity", _opacity).set_attr("fill", color).set_attr("stroke", color);
-    paint_rectangle(xCoordinate, yCoordinate, xDimension, yDimension, cssClassName, shapes, 0, {0, 0}, label);
+// The preview painter shares this one's file name and styles but never writes
+// the file, and has no callback of its own.
+void Painter::paint_field_preview(const std::function<void(Painter&)>& paintField) {
+    size_t numberPointsX = std::max<size_t>(2, settings.get_painter_number_points_x() / progressiveCoarseningFactor);
+    size_t numberPointsY = std::max<size_t>(2, settings.get_painter_number_points_y() / progressiveCoarseningFactor);
+    SettingsGuard<size_t> numberPointsXGuard(settings, &Settings::get_painter_number_points_x, &Settings::set_painter_number_points_x, numberPointsX);
+    SettingsGuard<size_t> numberPointsYGuard(settings, &Settings::get_painter_number_points_y, &Settings::set_painter_number_points_y, numberPointsY);
+    Painter preview(_filepath / _filename);
+    preview._filepath.clear();
+    paintField(preview);
+    _progressCallback(preview.export_svg());
 }
 
-
 void Painter::paint_magnetic_field(OperatingPoint operatingPoint, Magnetic magnetic, size_t harmonicIndex, std::optional<ComplexField> inputField) {
+    if (_progressCallback && !inputField) {
+        paint_field_preview([&](Painter& preview) {
+            preview.paint_magnetic_field(operatingPoint, magnetic, harmonicIndex);
+        });
+    }
     set_image_size(magnetic);
     double minimumModule = DBL_MAX;
     double maximumModule = 0;
@@ -1799,7 +1969,11 @@ void Painter::paint_magnetic_field(OperatingPoint operatingPoint, Magnetic magne
         field = inputField.value();
     }
     else if (isToroidal) {
-        // For toroidal cores, calculate internal and external fields separately
+        // For toroidal cores, calculate internal and external fields separately,
+        // meshing the turns once for both.
+        if (!magnetic.get_coil_mesh_cache()) {
+            magnetic.set_coil_mesh_cache(std::make_shared<CoilMeshCache>());
+        }
         internalField = calculate_magnetic_field_internal_only(operatingPoint, magnetic, harmonicIndex);
         externalField = calculate_magnetic_field_external_only(operatingPoint, magnetic, harmonicIndex);
     }
@@ -1955,9 +2129,15 @@ void Painter::paint_magnetic_field(OperatingPoint operatingPoint, Magnetic magne
             paint_field_point(point[0], point[1], pixelXDimension, pixelYDimension, color, label);
         }
     }
+    end_streamed_block();
 }
 
 void Painter::paint_electric_field(OperatingPoint operatingPoint, Magnetic magnetic, size_t harmonicIndex, std::optional<Field> inputField, ElectricFieldVisualizationModel model, ColorPalette colorPalette) {
+    if (_progressCallback && !inputField) {
+        paint_field_preview([&](Painter& preview) {
+            preview.paint_electric_field(operatingPoint, magnetic, harmonicIndex, std::nullopt, model, colorPalette);
+        });
+    }
     set_image_size(magnetic);
     double minimumModule = DBL_MAX;
     double maximumModule = 0;
@@ -2051,7 +2231,7 @@ void Painter::paint_electric_field(OperatingPoint operatingPoint, Magnetic magne
     // For toroidal cores, use the processed core dimensions
     std::string cssClassName = generate_random_string();
     auto bgColor = get_color(minimumModule, maximumModule, magneticFieldMinimumColor, magneticFieldMaximumColor, minimumModule);
-    bgColor = std::regex_replace(std::string(bgColor), std::regex("0x"), "#");
+    bgColor = to_css_color(bgColor);
     _root.style("." + cssClassName).set_attr("opacity", _opacity).set_attr("fill", bgColor);
 
     // Determine label based on output unit
@@ -2104,6 +2284,7 @@ void Painter::paint_electric_field(OperatingPoint operatingPoint, Magnetic magne
             paint_field_point(point[0], point[1], pixelXDimension, pixelYDimension, color, label);
         }
     }
+    end_streamed_block();
 }
 
 void Painter::paint_wire_losses(Magnetic magnetic, std::optional<Outputs> outputs, std::optional<OperatingPoint> operatingPoint, double temperature) {
@@ -3262,7 +3443,7 @@ std::string Painter::export_svg() {
         
         // Get the SVG string and wrap the content in a group that flips Y-axis
         // This converts from SVG convention (Y-down) to physical convention (Y-up)
-        svgString = std::string(_root);
+        svgString = splice_streamed_blocks(std::string(_root));
         
         // Find the end of the opening <svg ...> tag
         auto svgTagEnd = svgString.find('>');
@@ -3278,7 +3459,7 @@ std::string Painter::export_svg() {
         }
     }
     else {
-        svgString = std::string(_root);
+        svgString = splice_streamed_blocks(std::string(_root));
     }
     
     if (!_filepath.empty()) {
@@ -4911,8 +5092,7 @@ void Painter::paint_yz_projection(Magnetic magnetic) {
         for (const auto& [px, py] : points) {
             path->line_to(px * _scale, -py * _scale);
         }
-        auto copperColor = std::regex_replace(std::string(settings.get_painter_color_copper()),
-                                              std::regex("0x"), "#");
+        auto copperColor = to_css_color(settings.get_painter_color_copper());
         path->set_attr("stroke", copperColor);
         path->set_attr("stroke-width", od * _scale);
         path->set_attr("fill", "none");
@@ -5137,7 +5317,7 @@ void Painter::paint_xz_projection(Magnetic magnetic) {
         if (closed) {
             path->line_to(points.front().first * _scale, -points.front().second * _scale);
         }
-        path->set_attr("stroke", std::regex_replace(colorSetting, std::regex("0x"), "#"));
+        path->set_attr("stroke", to_css_color(colorSetting));
         path->set_attr("stroke-width", width * _scale);
         path->set_attr("fill", "none");
         path->set_attr("opacity", opacity);
@@ -5221,8 +5401,7 @@ void Painter::paint_xz_projection(Magnetic magnetic) {
             path->line_to(px * _scale, -pz * _scale);
         }
         path->line_to(points.front().first * _scale, -points.front().second * _scale);
-        path->set_attr("stroke", std::regex_replace(
-            std::string(settings.get_painter_color_lines()), std::regex("0x"), "#"));
+        path->set_attr("stroke", to_css_color(settings.get_painter_color_lines()));
         path->set_attr("stroke-width", 0.15 * level.height * _scale);
         path->set_attr("stroke-dasharray", std::to_string(0.6 * level.height * _scale) + " " +
                                            std::to_string(0.6 * level.height * _scale));
@@ -0,0 +1,252 @@
+#include "support/Parallel.h"
+#include "support/Settings.h"
+#include "support/LibraryContext.h"
+#include "support/Utils.h"
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <vector>
+
+namespace OpenMagnetics {
+
+namespace {
+
+// Depth of parallel_for() tasks on this thread. Pool threads and the caller
+// while it drains indices are both "inside"; a nested parallel_for() then
+// runs serially instead of queueing behind its own parent.
+thread_local size_t parallelTaskDepth = 0;
+
+struct TaskDepthScope {
+    TaskDepthScope() { parallelTaskDepth++; }
+    ~TaskDepthScope() { parallelTaskDepth--; }
+};
+
+// Persistent worker pool. Spawned lazily on the first parallel_for() that
+// needs it and grown on demand up to the requested worker count, so repeated
+// adviser calls do not pay thread creation per call.
+class WorkerPool {
+    public:
+        static WorkerPool& instance() {
+            static WorkerPool pool;
+            return pool;
+        }
+
+        void ensure_threads(size_t numberThreads) {
+            std::lock_guard<std::mutex> lock(_mutex);
+            while (_threads.size() < numberThreads) {
+                _threads.emplace_back([this] { run(); });
+            }
+        }
+
+        void post(std::function<void()> task) {
+            {
+                std::lock_guard<std::mutex> lock(_mutex);
+                _tasks.push_back(std::move(task));
+            }
+            _condition.notify_one();
+        }
+
+        ~WorkerPool() {
+            {
+                std::lock_guard<std::mutex> lock(_mutex);
+                _stopping = true;
+            }
+            _condition.notify_all();
+            for (auto& thread : _threads) {
+                if (thread.joinable()) {
+                    thread.join();
+                }
+            }
+        }
+
+    private:
+        WorkerPool() = default;
+
+        void run() {
+            while (true) {
+                std::function<void()> task;
+                {
+                    std::unique_lock<std::mutex> lock(_mutex);
+                    _condition.wait(lock, [this] { return _stopping || !_tasks.empty(); });
+                    if (_stopping && _tasks.empty()) {
+                        return;
+                    }
+                    task = std::move(_tasks.front());
+                    _tasks.pop_front();
+                }
+                task();
+            }
+        }
+
+        std::mutex _mutex;
+        std::condition_variable _condition;
+        std::deque<std::function<void()>> _tasks;
+        std::vector<std::thread> _threads;
+        bool _stopping = false;
+};
+
+// State shared by the caller and its helper tasks. Helpers that only get
+// scheduled after every index was claimed find nothing to do and exit
+// without touching `body` (which lives on the caller's stack).
+struct ParallelLoopState {
+    size_t count = 0;
+    const std::function<void(size_t)>* body = nullptr;
+    std::optional<SettingsSnapshot> settingsSnapshot;
+    std::atomic<size_t> nextIndex{0};
+    std::atomic<bool> failed{false};
+    std::mutex mutex;
+    std::condition_variable finished;
+    size_t completed = 0;
+    std::exception_ptr firstException;
+
+    void drain() {
+        TaskDepthScope depthScope;
+        while (true) {
+            size_t index = nextIndex.fetch_add(1, std::memory_order_relaxed);
+            if (index >= count) {
+                return;
+            }
+            if (!failed.load(std::memory_order_relaxed)) {
+                try {
+                    (*body)(index);
+                }
+                catch (...) {
+                    std::lock_guard<std::mutex> lock(mutex);
+                    if (!firstException) {
+                        firstException = std::current_exception();
+                    }
+                    failed.store(true, std::memory_order_relaxed);
+                }
+            }
+            std::lock_guard<std::mutex> lock(mutex);
+            if (++completed == count) {
+                finished.notify_all();
+            }
+        }
+    }
+};
+
+std::mutex parallelRegionMutex;
+size_t parallelRegionDepth = 0;
+bool parallelRegionFroze = false;
+
+} // namespace
+
+size_t get_parallel_number_workers() {
+#if defined(__EMSCRIPTEN__) && !defined(__EMSCRIPTEN_PTHREADS__)
+    return 1;
+#else
+    if (parallelTaskDepth > 0) {
+        return 1;
+    }
+    size_t requested = Settings::GetInstance().get_parallel_number_threads();
+    if (requested == 0) {
+        requested = std::max(1u, std::thread::hardware_concurrency());
+    }
+    return requested;
+#endif
+}
+
+bool inside_parallel_worker() {
+    return parallelTaskDepth > 0;
+}
+
+ParallelRegion::ParallelRegion() {
+    std::lock_guard<std::mutex> lock(parallelRegionMutex);
+    if (parallelRegionDepth++ > 0) {
+        return;
+    }
+    parallelRegionFroze = false;
+    if (databases_frozen()) {
+        // Somebody upstream (e.g. a caller fanning out its own threads)
+        // already owns the freeze; leave it to them.
+        return;
+    }
+    if (!LibraryContext::Scope::anyActive()) {
+        load_all_databases();
+    }
+    set_databases_frozen(true);
+    parallelRegionFroze = true;
+}
+
+ParallelRegion::~ParallelRegion() {
+    std::lock_guard<std::mutex> lock(parallelRegionMutex);
+    if (--parallelRegionDepth > 0) {
+        return;
+    }
+    if (parallelRegionFroze) {
+        set_databases_frozen(false);
+        parallelRegionFroze = false;
+    }
+}
+
+namespace {
+
+void run_parallel_loop(size_t count, size_t numberWorkers, SettingsSnapshot settingsSnapshot, const std::function<void(size_t)>& body) {
+    ParallelRegion region;
+
+    auto state = std::make_shared<ParallelLoopState>();
+    state->count = count;
+    state->body = &body;
+    state->settingsSnapshot = std::move(settingsSnapshot);
+
+    auto& pool = WorkerPool::instance();
+    pool.ensure_threads(numberWorkers - 1);
+    for (size_t helper = 0; helper + 1 < numberWorkers; ++helper) {
+        pool.post([state] {
+            SettingsSnapshot::Scope settingsScope(*state->settingsSnapshot);
+            state->drain();
+        });
+    }
+    state->drain();
+
+    {
+        std::unique_lock<std::mutex> lock(state->mutex);
+        state->finished.wait(lock, [&state] { return state->completed == state->count; });
+    }
+    if (state->firstException) {
+        std::rethrow_exception(state->firstException);
+    }
+}
+
+} // namespace
+
+void parallel_for(size_t count, const std::function<void(size_t)>& body) {
+    if (count == 0) {
+        return;
+    }
+    size_t numberWorkers = std::min(get_parallel_number_workers(), count);
+    if (numberWorkers <= 1) {
+        for (size_t index = 0; index < count; ++index) {
+            body(index);
+        }
+        return;
+    }
+    run_parallel_loop(count, numberWorkers, SettingsSnapshot::capture(), body);
+}
+
+void parallel_for(size_t count, const SettingsSnapshot& settingsSnapshot, const std::function<void(size_t)>& body) {
+    if (count == 0) {
+        return;
+    }
+    size_t numberWorkers = std::min(get_parallel_number_workers(), count);
+    // The caller drains indices too, and may have diverged from the snapshot
+    // it passed.
+    SettingsSnapshot::Scope settingsScope(settingsSnapshot);
+    if (numberWorkers <= 1) {
+        for (size_t index = 0; index < count; ++index) {
+            body(index);
+        }
+        return;
+    }
+    run_parallel_loop(count, numberWorkers, settingsSnapshot, body);
+}
+
+} // namespace OpenMagnetics
@@ -0,0 +1,55 @@
+#pragma once
+#include <cstddef>
+#include <functional>
+
+#include "support/Settings.h"
+
+namespace OpenMagnetics {
+
+// Fan-out helper for embarrassingly parallel loops (candidate evaluation,
+// frequency sweeps, per-operating-point simulation).
+//
+// THREAD-SAFETY CONTRACT: builds on the ABT #113 rules in support/Utils.h.
+//   * parallel_for() opens a ParallelRegion: every shared catalog is
+//     force-loaded on the calling thread and frozen until the loop joins.
+//   * Each task runs with the CALLER's Settings (Settings is a thread_local
+//     singleton, so a bare worker would see defaults): a SettingsSnapshot is
+//     captured at the call, or passed in, and installed on every helper for
+//     the duration of its task. A SettingsGuard on the caller therefore
+//     reaches the workers too.
+//   * The body must only write to state owned by index i (e.g. results[i]);
+//     results are then identical to the serial loop regardless of thread
+//     count or scheduling.
+//   * The first exception thrown by any index is rethrown on the calling
+//     thread after every claimed index has finished.
+//   * Nested calls (a body calling parallel_for) and single-worker
+//     configurations run serially on the calling thread.
+//
+// WASM builds without pthreads always run serially.
+
+// Number of threads parallel_for() may use, including the calling thread.
+// Reads Settings::get_parallel_number_threads() (0 = hardware concurrency).
+size_t get_parallel_number_workers();
+
+// True while the calling thread is executing a parallel_for() task.
+bool inside_parallel_worker();
+
+// RAII: loads and freezes the shared catalogs for the lifetime of the
+// outermost region on this process; nested regions are no-ops. Regions
+// opened inside a LibraryContext::Scope do not load (the scoped, possibly
+// empty catalogs are authoritative), they only freeze.
+class ParallelRegion {
+    public:
+        ParallelRegion();
+        ~ParallelRegion();
+        ParallelRegion(const ParallelRegion&) = delete;
+        ParallelRegion& operator=(const ParallelRegion&) = delete;
+};
+
+void parallel_for(size_t count, const std::function<void(size_t)>& body);
+
+// Same, with the Settings the tasks run under given explicitly. Lets a
+// caller issuing many loops capture its configuration once.
+void parallel_for(size_t count, const SettingsSnapshot& settingsSnapshot, const std::function<void(size_t)>& body);
+
+} // namespace OpenMagnetics
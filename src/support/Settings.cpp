@@ -17,18 +17,31 @@ namespace OpenMagnetics {
         //
         // WRINKLE: a freshly spawned worker thread starts with a
         // DEFAULT-CONSTRUCTED Settings, NOT a copy of the spawning thread's.
-        // Workers that must inherit the parent configuration copy it
-        // explicitly at thread start:
+        // Workers that must inherit the parent configuration install a
+        // SettingsSnapshot at thread start (parallel_for() does it for its
+        // own tasks):
         //
-        //     const Settings parentSnapshot = Settings::GetInstance(); // parent
-        //     std::thread worker([parentSnapshot] {
-        //         Settings::GetInstance() = parentSnapshot;            // worker
+        //     auto snapshot = SettingsSnapshot::capture();             // parent
+        //     std::thread worker([snapshot] {
+        //         SettingsSnapshot::Scope scope(snapshot);            // worker
         //         ...
         //     });
         static thread_local Settings instance;
         return instance;
     }
 
+    SettingsSnapshot SettingsSnapshot::capture() {
+        return SettingsSnapshot(std::make_shared<const Settings>(Settings::GetInstance()));
+    }
+
+    SettingsSnapshot::Scope::Scope(const SettingsSnapshot& snapshot) : _previous(Settings::GetInstance()) {
+        Settings::GetInstance() = snapshot.get();
+    }
+
+    SettingsSnapshot::Scope::~Scope() {
+        Settings::GetInstance() = _previous;
+    }
+
     Settings::Settings() {
         _inputsNumberPointsSampledWaveforms = constants.numberPointsSampledWaveforms;
         _painterMirroringDimension = defaults.magneticFieldMirroringDimension;
@@ -81,6 +94,7 @@ namespace OpenMagnetics {
         _inputsNumberPointsSampledWaveforms = Constants().numberPointsSampledWaveforms;
 
         _magnetizingInductanceIncludeAirInductance = false;
+        _magnetizingInductanceMemoSize = 0;
 
         _coilAllowMarginTape = true;
         _coilAllowInsulatedWire = true;
@@ -173,6 +187,9 @@ namespace OpenMagnetics {
         _harmonicAmplitudeThreshold = Defaults().harmonicAmplitudeThreshold;
 
         _verbose = false;
+        _parallelNumberThreads = 0;
+        _adviserResultCacheSize = 0;
+        _adviserResultCacheDirectory = std::nullopt;
 
         _preferredCoreMaterialFerriteManufacturer = "Fair-Rite";
         _preferredCoreMaterialPowderManufacturer = "Micrometals";
@@ -188,6 +205,8 @@ namespace OpenMagnetics {
         _coreThermalResistanceModel = Defaults().coreThermalResistanceModelDefault;
         _windingSkinEffectLossesModel = WindingSkinEffectLossesModels::DOWELL;
         _windingProximityEffectLossesModel = WindingProximityEffectLossesModels::FERREIRA;
+        _windingLossesTabulated = false;
+        _windingLossesTabulatedTolerance = 0.005;
         _strayCapacitanceModel = StrayCapacitanceModels::ALBACH;
         _electricFieldOutputUnit = ElectricFieldOutputUnit::JOULES_PER_CUBIC_METER;
 
@@ -196,6 +215,8 @@ namespace OpenMagnetics {
         // Previously these survived reset(), leaking setter state across
         // tests/sessions (one cause of order-dependent adviser test results)
         _coreLossesModelNames = {Defaults().coreLossesModelDefault, CoreLossesModels::PROPRIETARY, CoreLossesModels::LOSS_FACTOR, CoreLossesModels::STEINMETZ, CoreLossesModels::ROSHEN};
+        _coreLossesTabulated = false;
+        _coreLossesTabulatedTolerance = 0.02;
         _circuitSimulatorCurveFittingMode = 0;
         _circuitSimulatorFracpoleOptions = std::nullopt;
         _circuitSimulatorIncludeSaturation = false;
@@ -204,6 +225,10 @@ namespace OpenMagnetics {
         _circuitSimulatorIncludeSteinmetzCoreLoss = false;
         _circuitSimulatorCoreLossTopology = 1;
 
+        _magneticSimulatorThermalCoupling = false;
+        _magneticSimulatorThermalCouplingTolerance = 1.0;
+        _magneticSimulatorThermalCouplingMaximumIterations = 5;
+
         if (previousToroidalCores != _useToroidalCores
                 || previousConcentricCores != _useConcentricCores
                 || previousOnlyCoresInStock != _useOnlyCoresInStock) {
@@ -212,6 +237,96 @@ namespace OpenMagnetics {
         }
     }
 
+    std::string Settings::get_fingerprint() const {
+        json fingerprint;
+        fingerprint["useToroidalCores"] = _useToroidalCores;
+        fingerprint["useConcentricCores"] = _useConcentricCores;
+        fingerprint["useOnlyCoresInStock"] = _useOnlyCoresInStock;
+        fingerprint["usePowderCores"] = _usePowderCores;
+        fingerprint["inputsTrimHarmonics"] = _inputsTrimHarmonics;
+        fingerprint["inputsNumberPointsSampledWaveforms"] = _inputsNumberPointsSampledWaveforms;
+        fingerprint["magnetizingInductanceIncludeAirInductance"] = _magnetizingInductanceIncludeAirInductance;
+        fingerprint["coilAllowMarginTape"] = _coilAllowMarginTape;
+        fingerprint["coilAllowInsulatedWire"] = _coilAllowInsulatedWire;
+        fingerprint["coilFillSectionsWithMarginTape"] = _coilFillSectionsWithMarginTape;
+        fingerprint["coilWindEvenIfNotFit"] = _coilWindEvenIfNotFit;
+        fingerprint["coilDelimitAndCompact"] = _coilDelimitAndCompact;
+        fingerprint["coilTryRewind"] = _coilTryRewind;
+        fingerprint["coilIncludeAdditionalCoordinates"] = _coilIncludeAdditionalCoordinates;
+        fingerprint["coilEqualizeMargins"] = _coilEqualizeMargins;
+        fingerprint["coilOnlyOneTurnPerLayerInContiguousRectangular"] = _coilOnlyOneTurnPerLayerInContiguousRectangular;
+        fingerprint["coilUseRealWindingGeometry"] = _coilUseRealWindingGeometry;
+        fingerprint["coilAllowCoatingSquish"] = _coilAllowCoatingSquish;
+        fingerprint["coilAllowHorizontalOverflow"] = _coilAllowHorizontalOverflow;
+        fingerprint["coilMaximumLayersPlanar"] = _coilMaximumLayersPlanar;
+        fingerprint["coilEnableUserWindingLossesModels"] = _coilEnableUserWindingLossesModels;
+        fingerprint["coilMesherInsideTurnsFactor"] = _coilMesherInsideTurnsFactor;
+        fingerprint["corePerColumnWindingWindows"] = _corePerColumnWindingWindows;
+        fingerprint["effectiveParameterStandard"] = std::string(magic_enum::enum_name(_effectiveParameterStandard));
+        fingerprint["nanocrystallineStackingFactor"] = _nanocrystallineStackingFactor;
+        fingerprint["magneticFieldNumberPointsX"] = _magneticFieldNumberPointsX;
+        fingerprint["magneticFieldNumberPointsY"] = _magneticFieldNumberPointsY;
+        fingerprint["magneticFieldMirroringDimension"] = _magneticFieldMirroringDimension;
+        fingerprint["magneticFieldIncludeFringing"] = _magneticFieldIncludeFringing;
+        fingerprint["leakageInductanceGridAutoScaling"] = _leakageInductanceGridAutoScaling;
+        fingerprint["leakageInductanceGridPrecisionLevelPlanar"] = _leakageInductanceGridPrecisionLevelPlanar;
+        fingerprint["leakageInductanceGridPrecisionLevelWound"] = _leakageInductanceGridPrecisionLevelWound;
+        fingerprint["coilAdviserAllowLateralPlacement"] = _coilAdviserAllowLateralPlacement;
+        fingerprint["coilAdviserMaximumNumberWires"] = _coilAdviserMaximumNumberWires;
+        fingerprint["coreAdviserIncludeStacks"] = _coreAdviserIncludeStacks;
+        fingerprint["coreAdviserIncludeDistributedGaps"] = _coreAdviserIncludeDistributedGaps;
+        fingerprint["coreAdviserIncludeMargin"] = _coreAdviserIncludeMargin;
+        fingerprint["coreAdviserEnableIntermediatePruning"] = _coreAdviserEnableIntermediatePruning;
+        fingerprint["coreAdviserMaximumMagneticsAfterFiltering"] = _coreAdviserMaximumMagneticsAfterFiltering;
+        fingerprint["coreAdviserEnableTemperatureFilter"] = _coreAdviserEnableTemperatureFilter;
+        fingerprint["coreAdviserMaximumTemperature"] = _coreAdviserMaximumTemperature;
+        fingerprint["coreAdviserSaturationMargin"] = _coreAdviserSaturationMargin;
+        fingerprint["coreAdviserSaturationDeratingTemperature"] = _coreAdviserSaturationDeratingTemperature;
+        fingerprint["gappingStrategy"] = std::string(magic_enum::enum_name(_gappingStrategy));
+        fingerprint["wireAdviserIncludePlanar"] = _wireAdviserIncludePlanar;
+        fingerprint["wireAdviserIncludeFoil"] = _wireAdviserIncludeFoil;
+        fingerprint["wireAdviserIncludeRectangular"] = _wireAdviserIncludeRectangular;
+        fingerprint["wireAdviserIncludeLitz"] = _wireAdviserIncludeLitz;
+        fingerprint["wireAdviserIncludeRound"] = _wireAdviserIncludeRound;
+        fingerprint["wireAdviserAllowRectangularInToroidalCores"] = _wireAdviserAllowRectangularInToroidalCores;
+        fingerprint["harmonicAmplitudeThresholdQuickMode"] = _harmonicAmplitudeThresholdQuickMode;
+        fingerprint["harmonicAmplitudeThreshold"] = _harmonicAmplitudeThreshold;
+        for (auto model : _coreLossesModelNames) {
+            fingerprint["coreLossesModelNames"].push_back(std::string(magic_enum::enum_name(model)));
+        }
+        fingerprint["coreLossesTabulated"] = _coreLossesTabulated;
+        fingerprint["coreLossesTabulatedTolerance"] = _coreLossesTabulatedTolerance;
+        fingerprint["magneticFieldStrengthModel"] = std::string(magic_enum::enum_name(_magneticFieldStrengthModel));
+        fingerprint["magneticFieldStrengthFringingEffectModel"] = std::string(magic_enum::enum_name(_magneticFieldStrengthFringingEffectModel));
+        fingerprint["leakageInductanceMagneticFieldStrengthModel"] = std::string(magic_enum::enum_name(_leakageInductanceMagneticFieldStrengthModel));
+        fingerprint["reluctanceModel"] = std::string(magic_enum::enum_name(_reluctanceModel));
+        fingerprint["coreTemperatureModel"] = std::string(magic_enum::enum_name(_coreTemperatureModel));
+        fingerprint["coreThermalResistanceModel"] = std::string(magic_enum::enum_name(_coreThermalResistanceModel));
+        fingerprint["windingSkinEffectLossesModel"] = std::string(magic_enum::enum_name(_windingSkinEffectLossesModel));
+        fingerprint["windingProximityEffectLossesModel"] = std::string(magic_enum::enum_name(_windingProximityEffectLossesModel));
+        fingerprint["windingLossesTabulated"] = _windingLossesTabulated;
+        fingerprint["windingLossesTabulatedTolerance"] = _windingLossesTabulatedTolerance;
+        fingerprint["strayCapacitanceModel"] = std::string(magic_enum::enum_name(_strayCapacitanceModel));
+        fingerprint["electricFieldOutputUnit"] = std::string(magic_enum::enum_name(_electricFieldOutputUnit));
+        fingerprint["circuitSimulatorCurveFittingMode"] = _circuitSimulatorCurveFittingMode;
+        if (_circuitSimulatorFracpoleOptions) {
+            fingerprint["circuitSimulatorFracpoleOptions"] = _circuitSimulatorFracpoleOptions.value();
+        }
+        fingerprint["circuitSimulatorIncludeSaturation"] = _circuitSimulatorIncludeSaturation;
+        fingerprint["circuitSimulatorIncludeMutualResistance"] = _circuitSimulatorIncludeMutualResistance;
+        fingerprint["circuitSimulatorIncludeStrayCapacitance"] = _circuitSimulatorIncludeStrayCapacitance;
+        fingerprint["circuitSimulatorIncludeSteinmetzCoreLoss"] = _circuitSimulatorIncludeSteinmetzCoreLoss;
+        fingerprint["circuitSimulatorCoreLossTopology"] = _circuitSimulatorCoreLossTopology;
+        fingerprint["magneticSimulatorThermalCoupling"] = _magneticSimulatorThermalCoupling;
+        fingerprint["magneticSimulatorThermalCouplingTolerance"] = _magneticSimulatorThermalCouplingTolerance;
+        fingerprint["magneticSimulatorThermalCouplingMaximumIterations"] = _magneticSimulatorThermalCouplingMaximumIterations;
+        fingerprint["preferredCoreMaterialFerriteManufacturer"] = _preferredCoreMaterialFerriteManufacturer;
+        fingerprint["preferredCoreMaterialPowderManufacturer"] = _preferredCoreMaterialPowderManufacturer;
+        fingerprint["coreCrossReferencerAllowDifferentCoreMaterialType"] = _coreCrossReferencerAllowDifferentCoreMaterialType;
+        // nlohmann::json objects are key-sorted, so the dump is canonical.
+        return fingerprint.dump();
+    }
+
     bool Settings::get_verbose() const {
         return _verbose;
     }
@@ -219,6 +334,27 @@ namespace OpenMagnetics {
         _verbose = value;
     }
 
+    size_t Settings::get_parallel_number_threads() const {
+        return _parallelNumberThreads;
+    }
+    void Settings::set_parallel_number_threads(size_t value) {
+        _parallelNumberThreads = value;
+    }
+
+    size_t Settings::get_adviser_result_cache_size() const {
+        return _adviserResultCacheSize;
+    }
+    void Settings::set_adviser_result_cache_size(size_t value) {
+        _adviserResultCacheSize = value;
+    }
+
+    std::optional<std::string> Settings::get_adviser_result_cache_directory() const {
+        return _adviserResultCacheDirectory;
+    }
+    void Settings::set_adviser_result_cache_directory(std::optional<std::string> value) {
+        _adviserResultCacheDirectory = value;
+    }
+
     bool Settings::get_use_toroidal_cores() const {
         return _useToroidalCores;
     }
@@ -263,6 +399,13 @@ namespace OpenMagnetics {
         _magnetizingInductanceIncludeAirInductance = value;
     }
 
+    size_t Settings::get_magnetizing_inductance_memo_size() const {
+        return _magnetizingInductanceMemoSize;
+    }
+    void Settings::set_magnetizing_inductance_memo_size(size_t value) {
+        _magnetizingInductanceMemoSize = value;
+    }
+
     bool Settings::get_coil_allow_margin_tape() const {
         return _coilAllowMarginTape;
     }
@@ -885,6 +1028,20 @@ namespace OpenMagnetics {
         _coreLossesModelNames = {value, CoreLossesModels::PROPRIETARY, CoreLossesModels::LOSS_FACTOR, CoreLossesModels::STEINMETZ, CoreLossesModels::ROSHEN};
     }
 
+    bool Settings::get_core_losses_tabulated() const {
+        return _coreLossesTabulated;
+    }
+    void Settings::set_core_losses_tabulated(bool value) {
+        _coreLossesTabulated = value;
+    }
+
+    double Settings::get_core_losses_tabulated_tolerance() const {
+        return _coreLossesTabulatedTolerance;
+    }
+    void Settings::set_core_losses_tabulated_tolerance(double value) {
+        _coreLossesTabulatedTolerance = value;
+    }
+
     std::string Settings::get_preferred_core_material_ferrite_manufacturer() const {
         return _preferredCoreMaterialFerriteManufacturer;
     }
@@ -963,6 +1120,20 @@ namespace OpenMagnetics {
         _windingProximityEffectLossesModel = value;
     }
 
+    bool Settings::get_winding_losses_tabulated() const {
+        return _windingLossesTabulated;
+    }
+    void Settings::set_winding_losses_tabulated(bool value) {
+        _windingLossesTabulated = value;
+    }
+
+    double Settings::get_winding_losses_tabulated_tolerance() const {
+        return _windingLossesTabulatedTolerance;
+    }
+    void Settings::set_winding_losses_tabulated_tolerance(double value) {
+        _windingLossesTabulatedTolerance = value;
+    }
+
     StrayCapacitanceModels Settings::get_stray_capacitance_model() const {
         return _strayCapacitanceModel;
     }
@@ -1034,4 +1205,25 @@ namespace OpenMagnetics {
         _circuitSimulatorCoreLossTopology = value;
     }
 
+    bool Settings::get_magnetic_simulator_thermal_coupling() const {
+        return _magneticSimulatorThermalCoupling;
+    }
+    void Settings::set_magnetic_simulator_thermal_coupling(bool value) {
+        _magneticSimulatorThermalCoupling = value;
+    }
+
+    double Settings::get_magnetic_simulator_thermal_coupling_tolerance() const {
+        return _magneticSimulatorThermalCouplingTolerance;
+    }
+    void Settings::set_magnetic_simulator_thermal_coupling_tolerance(double value) {
+        _magneticSimulatorThermalCouplingTolerance = value;
+    }
+
+    size_t Settings::get_magnetic_simulator_thermal_coupling_maximum_iterations() const {
+        return _magneticSimulatorThermalCouplingMaximumIterations;
+    }
+    void Settings::set_magnetic_simulator_thermal_coupling_maximum_iterations(size_t value) {
+        _magneticSimulatorThermalCouplingMaximumIterations = value;
+    }
+
 } // namespace OpenMagnetics
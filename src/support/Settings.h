@@ -2,6 +2,7 @@
 #include "MAS.hpp"
 #include "Definitions.h"
 #include "Models.h"
+#include <memory>
 
 
 
@@ -35,6 +36,8 @@ class Settings
         size_t _inputsNumberPointsSampledWaveforms;
 
         bool _magnetizingInductanceIncludeAirInductance = false;
+        // Per-thread memo of MagnetizingInductance solves; 0 entries disables it.
+        size_t _magnetizingInductanceMemoSize = 0;
 
         bool _coilAllowMarginTape = true;
         bool _coilAllowInsulatedWire = true;
@@ -171,6 +174,10 @@ class Settings
 
 
         std::vector<CoreLossesModels> _coreLossesModelNames;
+        // Tabulated core-loss surfaces (CoreLossesTabulatedModel) for the
+        // adviser's material ranking; off by default.
+        bool _coreLossesTabulated = false;
+        double _coreLossesTabulatedTolerance = 0.02;
 
         // Centralized model configuration
         MagneticFieldStrengthModels _magneticFieldStrengthModel;
@@ -181,6 +188,10 @@ class Settings
         CoreThermalResistanceModels _coreThermalResistanceModel;
         WindingSkinEffectLossesModels _windingSkinEffectLossesModel;
         WindingProximityEffectLossesModels _windingProximityEffectLossesModel;
+        // Per-wire skin/proximity factor tables (WireFrequencyResponseTable);
+        // off by default.
+        bool _windingLossesTabulated = false;
+        double _windingLossesTabulatedTolerance = 0.005;
         StrayCapacitanceModels _strayCapacitanceModel;
         ElectricFieldOutputUnit _electricFieldOutputUnit;
 
@@ -213,8 +224,26 @@ class Settings
         // Circuit simulator core loss topology (0=RIDLEY RL stages, 1=ROSANO R/RL/RLC branches)
         int _circuitSimulatorCoreLossTopology = 1;  // Default to ROSANO
 
+        // MagneticSimulator electro-thermal coupling: when enabled, each operating
+        // point iterates losses <-> full thermal network until the hot spot moves
+        // less than the tolerance (deg C), with at most the given number of
+        // full-fidelity loss evaluations. Disabled = losses at ambient.
+        bool _magneticSimulatorThermalCoupling = false;
+        double _magneticSimulatorThermalCouplingTolerance = 1.0;
+        size_t _magneticSimulatorThermalCouplingMaximumIterations = 5;
+
         bool _verbose = false;
 
+        // Threads used by parallel_for() (support/Parallel.h), including the
+        // calling thread. 0 = std::thread::hardware_concurrency(); 1 = serial.
+        size_t _parallelNumberThreads = 0;
+
+        // MagneticAdviser result cache (advisers/AdviserResultCache.h).
+        // 0 entries disables it; the directory, when set, adds a persistent
+        // tier shared between processes.
+        size_t _adviserResultCacheSize = 0;
+        std::optional<std::string> _adviserResultCacheDirectory = std::nullopt;
+
         std::string _preferredCoreMaterialFerriteManufacturer = "Fair-Rite";
         std::string _preferredCoreMaterialPowderManufacturer = "Micrometals";
 
@@ -227,8 +256,9 @@ class Settings
         // singleton — new threads start default-constructed):
         //     const Settings parentSnapshot = Settings::GetInstance(); // parent
         //     Settings::GetInstance() = parentSnapshot;                // worker
-        // Direct construction stays private: instances other than snapshots
-        // of GetInstance() are not meant to exist.
+        // SettingsSnapshot (below) wraps that recipe. Direct construction
+        // stays private: instances other than snapshots of GetInstance() are
+        // not meant to exist.
         Settings(const Settings& other) = default;
         Settings& operator=(const Settings& other) = default;
         Settings(Settings&& other) = delete;
@@ -241,9 +271,24 @@ class Settings
 
         void reset();
 
+        // Canonical string of every setting that can change a computed
+        // result. Painter colours, logging, threading and cache settings are
+        // left out: they change how a result is produced or shown, not what
+        // it is.
+        std::string get_fingerprint() const;
+
         bool get_verbose() const;
         void set_verbose(bool value);
 
+        size_t get_parallel_number_threads() const;
+        void set_parallel_number_threads(size_t value);
+
+        size_t get_adviser_result_cache_size() const;
+        void set_adviser_result_cache_size(size_t value);
+
+        std::optional<std::string> get_adviser_result_cache_directory() const;
+        void set_adviser_result_cache_directory(std::optional<std::string> value);
+
         bool get_use_toroidal_cores() const;
         void set_use_toroidal_cores(bool value);
 
@@ -259,6 +304,9 @@ class Settings
         bool get_magnetizing_inductance_include_air_inductance() const;
         void set_magnetizing_inductance_include_air_inductance(bool value);
 
+        size_t get_magnetizing_inductance_memo_size() const;
+        void set_magnetizing_inductance_memo_size(size_t value);
+
         bool get_coil_allow_margin_tape() const;
         void set_coil_allow_margin_tape(bool value);
 
@@ -499,6 +547,12 @@ class Settings
         std::vector<CoreLossesModels> get_core_losses_model_names() const;
         void set_core_losses_preferred_model_name(CoreLossesModels value);
 
+        bool get_core_losses_tabulated() const;
+        void set_core_losses_tabulated(bool value);
+
+        double get_core_losses_tabulated_tolerance() const;
+        void set_core_losses_tabulated_tolerance(double value);
+
         std::string get_preferred_core_material_ferrite_manufacturer() const;
         void set_preferred_core_material_ferrite_manufacturer(std::string value);
 
@@ -533,6 +587,12 @@ class Settings
         WindingProximityEffectLossesModels get_winding_proximity_effect_losses_model() const;
         void set_winding_proximity_effect_losses_model(WindingProximityEffectLossesModels value);
 
+        bool get_winding_losses_tabulated() const;
+        void set_winding_losses_tabulated(bool value);
+
+        double get_winding_losses_tabulated_tolerance() const;
+        void set_winding_losses_tabulated_tolerance(double value);
+
         StrayCapacitanceModels get_stray_capacitance_model() const;
         void set_stray_capacitance_model(StrayCapacitanceModels value);
 
@@ -562,6 +622,15 @@ class Settings
         int get_circuit_simulator_core_loss_topology() const;
         void set_circuit_simulator_core_loss_topology(int value);
 
+        bool get_magnetic_simulator_thermal_coupling() const;
+        void set_magnetic_simulator_thermal_coupling(bool value);
+
+        double get_magnetic_simulator_thermal_coupling_tolerance() const;
+        void set_magnetic_simulator_thermal_coupling_tolerance(double value);
+
+        size_t get_magnetic_simulator_thermal_coupling_maximum_iterations() const;
+        void set_magnetic_simulator_thermal_coupling_maximum_iterations(size_t value);
+
 
     };
 
@@ -592,4 +661,47 @@ private:
     T _previousValue;
 };
 
+// Immutable copy of one thread's Settings, for handing a configuration to
+// work that runs on other threads. Settings is a thread_local singleton, so
+// a worker would otherwise see defaults (and a SettingsGuard on the caller
+// would not reach it). parallel_for() captures one per call and installs it
+// on every helper for the duration of each task; library code that spawns
+// its own threads should do the same:
+//
+//     auto snapshot = SettingsSnapshot::capture();              // caller
+//     std::thread worker([snapshot] {
+//         SettingsSnapshot::Scope scope(snapshot);             // worker
+//         ...
+//     });
+//
+// Copying a SettingsSnapshot only copies a shared pointer. get() reads the
+// captured values, whatever the calling thread's Settings hold; code that
+// runs inside a Scope reads the same values through GetInstance().
+class SettingsSnapshot {
+    public:
+        // Copies the calling thread's Settings.
+        static SettingsSnapshot capture();
+
+        const Settings& get() const { return *_settings; }
+        const Settings* operator->() const { return _settings.get(); }
+
+        // RAII: makes the snapshot the calling thread's Settings, and puts
+        // back what the thread had before on destruction. Scopes nest.
+        class Scope {
+            public:
+                explicit Scope(const SettingsSnapshot& snapshot);
+                ~Scope();
+                Scope(const Scope&) = delete;
+                Scope& operator=(const Scope&) = delete;
+
+            private:
+                Settings _previous;
+        };
+
+    private:
+        explicit SettingsSnapshot(std::shared_ptr<const Settings> settings) : _settings(std::move(settings)) {}
+
+        std::shared_ptr<const Settings> _settings;
+};
+
 } // namespace OpenMagnetics
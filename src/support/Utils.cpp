@@ -2,10 +2,12 @@
 #include "physical_models/MagnetizingInductance.h"
 #include "processors/MagneticSimulator.h"
 #include "support/Utils.h"
+#include "support/BesselKernels.h"
 #include "support/Logger.h"
 #include "json.hpp"
 
 #include <atomic>
+#include <cstdio>
 #include <math.h>
 #include <cmath>
 #include <filesystem>
@@ -13,7 +15,9 @@
 #include <iostream>
 #include <cfloat>
 #include <limits>
+#include <mutex>
 #include <numbers>
+#include <optional>
 #include <streambuf>
 #include <vector>
 #include <cmrc/cmrc.hpp>
@@ -121,6 +125,83 @@ void set_databases_frozen(bool frozen) {
     _databasesFrozen.store(frozen, std::memory_order_release);
 }
 
+static std::atomic<uint64_t> _databasesGeneration{0};
+
+uint64_t get_databases_generation() {
+    return _databasesGeneration.load(std::memory_order_acquire);
+}
+
+// Catalogue digest (see get_databases_digest()). The built-in part hashes the
+// embedded resources once; the loaded part folds in every caller-supplied
+// payload since the last clear_databases().
+namespace {
+
+constexpr uint64_t databasesDigestSeed = 14695981039346656037ull;
+
+uint64_t fold_databases_digest(uint64_t digest, std::string_view content) {
+    for (unsigned char character : content) {
+        digest ^= character;
+        digest *= 1099511628211ull;
+    }
+    return digest;
+}
+
+std::mutex _databasesDigestMutex;
+uint64_t _loadedDatabasesDigest = databasesDigestSeed;
+bool _databasesDigestKnown = true;
+
+const std::string& get_builtin_databases_digest() {
+    static const std::string builtinDigest = [] {
+        auto fs = cmrc::data::get_filesystem();
+        uint64_t digest = databasesDigestSeed;
+        for (auto resourcePath : {"MAS/data/cores.ndjson", "MAS/data/cores_stock.ndjson", "MAS/data/core_materials.ndjson",
+                                  "MAS/data/core_shapes.ndjson", "MAS/data/wires.ndjson", "MAS/data/bobbins.ndjson",
+                                  "MAS/data/insulation_materials.ndjson", "MAS/data/wire_materials.ndjson"}) {
+            digest = fold_databases_digest(digest, resourcePath);
+            if (fs.exists(resourcePath)) {
+                auto data = fs.open(resourcePath);
+                digest = fold_databases_digest(digest, std::string_view(data.begin(), static_cast<size_t>(data.end() - data.begin())));
+            }
+        }
+        char buffer[17];
+        std::snprintf(buffer, sizeof(buffer), "%016llx", static_cast<unsigned long long>(digest));
+        return std::string(buffer);
+    }();
+    return builtinDigest;
+}
+
+// A catalogue change whose content is known: bumps the generation and keeps
+// the digest content-addressed.
+void record_databases_content(std::string_view source, std::string_view content) {
+    _databasesGeneration.fetch_add(1, std::memory_order_acq_rel);
+    std::lock_guard<std::mutex> lock(_databasesDigestMutex);
+    _loadedDatabasesDigest = fold_databases_digest(_loadedDatabasesDigest, source);
+    _loadedDatabasesDigest = fold_databases_digest(_loadedDatabasesDigest, content);
+}
+
+} // namespace
+
+void bump_databases_generation() {
+    _databasesGeneration.fetch_add(1, std::memory_order_acq_rel);
+    // An edit made in place: its content is unknown until the next clear.
+    std::lock_guard<std::mutex> lock(_databasesDigestMutex);
+    _databasesDigestKnown = false;
+}
+
+std::optional<std::string> get_databases_digest() {
+    uint64_t loadedDigest;
+    {
+        std::lock_guard<std::mutex> lock(_databasesDigestMutex);
+        if (!_databasesDigestKnown) {
+            return std::nullopt;
+        }
+        loadedDigest = _loadedDatabasesDigest;
+    }
+    char buffer[17];
+    std::snprintf(buffer, sizeof(buffer), "%016llx", static_cast<unsigned long long>(loadedDigest));
+    return get_builtin_databases_digest() + "-" + buffer;
+}
+
 static void throw_if_databases_frozen(const char* operation) {
     if (databases_frozen()) {
         throw std::runtime_error(
@@ -228,17 +309,34 @@ std::string read_log() {
     return contents;
 }
 
-void logEntry(std::string entry, std::string module, uint8_t entryVerbosity) {
+namespace {
+LogLevel log_entry_level(uint8_t entryVerbosity) {
+    return (entryVerbosity == 0) ? LogLevel::ERROR
+         : (entryVerbosity == 1) ? LogLevel::WARNING
+         : (entryVerbosity == 2) ? LogLevel::INFO
+         : LogLevel::DEBUG;
+}
+}
+
+bool log_entry_enabled(uint8_t entryVerbosity) {
+    return Logger::getInstance().isEnabled(log_entry_level(entryVerbosity));
+}
+
+void logEntry(std::string_view entry, std::string_view module, uint8_t entryVerbosity) {
     auto& logger = Logger::getInstance();
-    LogLevel level = (entryVerbosity == 0) ? LogLevel::ERROR 
-                   : (entryVerbosity == 1) ? LogLevel::WARNING
-                   : (entryVerbosity == 2) ? LogLevel::INFO
-                   : LogLevel::DEBUG;
-    logger.log(level, module.empty() ? "OpenMagnetics" : module, entry);
+    LogLevel level = log_entry_level(entryVerbosity);
+    // Most calls are below the active level; build no strings for them.
+    if (!logger.isEnabled(level)) {
+        return;
+    }
+    logger.log(level, module.empty() ? std::string("OpenMagnetics") : std::string(module), std::string(entry));
 }
 
 void load_cores(std::optional<std::string> fileToLoad) {
     throw_if_databases_frozen("load_cores");
+    if (fileToLoad) {
+        record_databases_content("load_cores", fileToLoad.value());
+    }
     bool includeToroidalCores = settings.get_use_toroidal_cores();
     bool includeConcentricCores = settings.get_use_concentric_cores();
     bool useOnlyCoresInStock = settings.get_use_only_cores_in_stock();
@@ -314,6 +412,12 @@ void clear_loaded_core_shapes() {
 
 void clear_databases() {
     throw_if_databases_frozen("clear_databases");
+    _databasesGeneration.fetch_add(1, std::memory_order_acq_rel);
+    {
+        std::lock_guard<std::mutex> lock(_databasesDigestMutex);
+        _loadedDatabasesDigest = databasesDigestSeed;
+        _databasesDigestKnown = true;
+    }
     coreDatabase.clear();
     coreMaterialDatabase.clear();
     coreShapeDatabase.clear();
@@ -326,6 +430,9 @@ void clear_databases() {
 
 void load_core_materials(std::optional<std::string> fileToLoad) {
     throw_if_databases_frozen("load_core_materials");
+    if (fileToLoad) {
+        record_databases_content("load_core_materials", fileToLoad.value());
+    }
     if (!_addInternalData) {
         return;
     }
@@ -338,6 +445,7 @@ void load_core_materials(std::optional<std::string> fileToLoad) {
 
 void load_advanced_core_materials(std::string fileToLoad, bool onlyDataFromManufacturer) {
     throw_if_databases_frozen("load_advanced_core_materials");
+    record_databases_content(onlyDataFromManufacturer ? "load_advanced_core_materials|manufacturer" : "load_advanced_core_materials", fileToLoad);
     parse_ndjson(fileToLoad, [onlyDataFromManufacturer](const json& jf) {
         auto it = coreMaterialDatabase.find(jf["name"]);
         if (it == coreMaterialDatabase.end()) return;
@@ -467,6 +575,9 @@ static void check_core_shape_geometry(const CoreShape& coreShape) {
 
 void load_core_shapes(bool withAliases, std::optional<std::string> fileToLoad) {
     throw_if_databases_frozen("load_core_shapes");
+    if (fileToLoad) {
+        record_databases_content(withAliases ? "load_core_shapes|aliases" : "load_core_shapes", fileToLoad.value());
+    }
     if (!_addInternalData) {
         return;
     }
@@ -523,6 +634,9 @@ void load_core_shapes(bool withAliases, std::optional<std::string> fileToLoad) {
 
 void load_wires(std::optional<std::string> fileToLoad) {
     throw_if_databases_frozen("load_wires");
+    if (fileToLoad) {
+        record_databases_content("load_wires", fileToLoad.value());
+    }
     if (!_addInternalData) {
         return;
     }
@@ -571,6 +685,7 @@ void load_wire_materials() {
 
 void load_databases(json data, bool withAliases, bool addInternalData) {
     throw_if_databases_frozen("load_databases");
+    record_databases_content(std::string("load_databases|") + (withAliases ? "aliases|" : "") + (addInternalData ? "internal|" : ""), data.dump());
     _addInternalData = addInternalData;
     if (addInternalData) {
         if (coreMaterialDatabase.empty()) {
@@ -2014,11 +2129,19 @@ std::complex<double> modified_bessel_second_kind(double order, std::complex<doub
     }
 }
 
+// Integer orders (all the winding models use) go through the double-precision
+// kernel in support/BesselKernels.h; the generic series is kept for the rest.
 double kelvin_function_real(double order, double x) {
+    if (order >= 0 && order == std::round(order)) {
+        return bessel_first_kind_integer_order(static_cast<int>(order), x * std::polar(1.0, 0.75 * std::numbers::pi)).real();
+    }
     return bessel_first_kind(order, x * exp(3.0 / 4 * std::numbers::pi * std::complex<double>{0.0, 1.0})).real();
 }
 
 double kelvin_function_imaginary(double order, double x) {
+    if (order >= 0 && order == std::round(order)) {
+        return bessel_first_kind_integer_order(static_cast<int>(order), x * std::polar(1.0, 0.75 * std::numbers::pi)).imag();
+    }
     return bessel_first_kind(order, x * exp(3.0 / 4 * std::numbers::pi * std::complex<double>{0.0, 1.0})).imag();
 }
 
@@ -2177,13 +2300,11 @@ std::string to_title_case(std::string text) {
 std::complex<double> modified_bessel_ratio_I1_I0(std::complex<double> z) {
     // The truncated series in modified_bessel_first_kind (float tgammaf overflow
     // at k~21) silently diverges for |z| >~ 20-25, producing NEGATIVE skin
-    // factors. Beyond that, use the asymptotic expansion
+    // factors. The kernel uses a continued fraction below |z| = 20 and the
+    // asymptotic expansion
     //   I1(z)/I0(z) = 1 - 1/(2z) - 1/(8z^2) - ...
-    // which is accurate to <0.1% at |z| = 20.
-    if (std::abs(z) < 20.0) {
-        return modified_bessel_first_kind(1, z) / modified_bessel_first_kind(0, z);
-    }
-    return std::complex<double>(1.0, 0) - 1.0 / (2.0 * z) - 1.0 / (8.0 * z * z);
+    // (accurate to <0.1% at |z| = 20) above it.
+    return modified_bessel_ratio_I1_I0_kernel(z);
 }
 
 double wound_distance_to_angle(double distance, double radius) {
@@ -14,6 +14,8 @@
 #include <complex>
 #include "spline.h"
 #include <exception>
+#include <string_view>
+#include <type_traits>
 
 #include "Defaults.h"
 #include "Constants.h"
@@ -142,7 +144,20 @@ std::optional<InductanceFluxCacheEntry> get_cached_inductance_flux(
 
 // Legacy logging interface - prefer using Logger directly
 // Verbosity levels: 0=ERROR, 1=WARNING, 2=INFO, 3+=DEBUG
-void logEntry(std::string entry, std::string module = "", uint8_t entryVerbosity = 1);
+void logEntry(std::string_view entry, std::string_view module = "", uint8_t entryVerbosity = 1);
+// Whether a logEntry at this verbosity would reach the sinks.
+bool log_entry_enabled(uint8_t entryVerbosity);
+// Lazy logEntry for hot loops: makeEntry builds the message and only runs when
+// the entry passes the level check, e.g.
+//   logEntry([&] { return "core: " + coreName; }, "MagneticAdviser", 2);
+template <typename MakeEntry>
+    requires std::is_invocable_v<MakeEntry&>
+void logEntry(MakeEntry&& makeEntry, std::string_view module = "", uint8_t entryVerbosity = 1) {
+    if (log_entry_enabled(entryVerbosity)) {
+        std::string entry = makeEntry();
+        logEntry(std::string_view(entry), module, entryVerbosity);
+    }
+}
 std::string read_log();
 
 bool check_requirement(DimensionWithTolerance requirement, double value);
@@ -181,6 +196,23 @@ bool databases_frozen();
 void set_databases_frozen(bool frozen);
 void load_all_databases();
 
+// Catalogue generation: bumped by every call that changes what a catalogue
+// CONTAINS (clear_databases, load_databases, and the load_* variants reading
+// caller-supplied data). Reloads of the built-in catalogues are not counted:
+// they are determined by Settings, which derived-result caches key on
+// separately. Code that edits coreDatabase & co. in place must call
+// bump_databases_generation() itself.
+uint64_t get_databases_generation();
+void bump_databases_generation();
+
+// Content digest of the catalogues: the embedded built-in resources plus every
+// caller-supplied payload loaded since the last clear_databases(). Unlike the
+// generation it is the same in every process that loaded the same data, so it
+// can key results shared across processes. nullopt after an in-place edit
+// (bump_databases_generation()), whose content is unknown, until the next
+// clear_databases().
+std::optional<std::string> get_databases_digest();
+
 void clear_loaded_cores();
 void clear_loaded_core_shapes();
 void clear_databases();
@@ -0,0 +1,40 @@
+#include "support/WorkCounters.h"
+
+#include <array>
+#include <atomic>
+
+namespace OpenMagnetics {
+
+namespace {
+
+std::array<std::atomic<uint64_t>, static_cast<size_t>(WorkCounter::NUMBER_COUNTERS)> workCounters{};
+
+} // namespace
+
+void count_work(WorkCounter counter, uint64_t amount) {
+    workCounters[static_cast<size_t>(counter)].fetch_add(amount, std::memory_order_relaxed);
+}
+
+uint64_t get_work_count(WorkCounter counter) {
+    return workCounters[static_cast<size_t>(counter)].load(std::memory_order_relaxed);
+}
+
+void reset_work_counters() {
+    for (auto& counter : workCounters) {
+        counter.store(0, std::memory_order_relaxed);
+    }
+}
+
+std::string to_string(WorkCounter counter) {
+    switch (counter) {
+        case WorkCounter::COIL_WIND: return "coilWind";
+        case WorkCounter::MAGNETIC_FIELD_EVALUATION: return "magneticFieldEvaluation";
+        case WorkCounter::WINDING_LOSSES_EVALUATION: return "windingLossesEvaluation";
+        case WorkCounter::CORE_LOSSES_EVALUATION: return "coreLossesEvaluation";
+        case WorkCounter::TEMPERATURE_SOLVE: return "temperatureSolve";
+        case WorkCounter::NUMBER_COUNTERS: break;
+    }
+    return "unknown";
+}
+
+} // namespace OpenMagnetics
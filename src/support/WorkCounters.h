@@ -0,0 +1,33 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace OpenMagnetics {
+
+// Process-wide tallies of the expensive steps of a design run, for the
+// performance regression tests (tests/TestPerformanceRegression.cpp) and
+// for profiling a caller's own workload.
+//
+// Each counter is bumped once per call of a coarse entry point, never per
+// point or per turn, so the cost is one relaxed atomic add. Core losses are
+// counted in the models themselves, so direct model calls (the advisers'
+// scoring filters, the gap optimizer) count as well as MagneticSimulator's;
+// material-level get_core_volumetric_losses() queries are not counted. Totals do not
+// depend on thread count or scheduling: parallel_for() runs the same calls
+// whatever the order, so a fixed input always gives the same counts.
+enum class WorkCounter : uint8_t {
+    COIL_WIND,                  // Coil::wind(proportions, pattern, repetitions)
+    MAGNETIC_FIELD_EVALUATION,  // MagneticField::calculate_magnetic_field_strength_field()
+    WINDING_LOSSES_EVALUATION,  // WindingLosses::calculate_losses()
+    CORE_LOSSES_EVALUATION,     // CoreLossesModel::get_core_losses(), per exact model
+    TEMPERATURE_SOLVE,          // Temperature::calculateTemperatures()
+    NUMBER_COUNTERS
+};
+
+void count_work(WorkCounter counter, uint64_t amount = 1);
+uint64_t get_work_count(WorkCounter counter);
+void reset_work_counters();
+std::string to_string(WorkCounter counter);
+
+} // namespace OpenMagnetics
@@ -0,0 +1,214 @@
+// =============================================================================
+// TestAdviserResultCache.cpp
+// =============================================================================
+// AdviserResultCache (in-process LRU + on-disk tier) and its use by
+// MagneticAdviser::get_advised_magnetic.
+//
+// FIXTURE
+//   Same inductor as TestMagneticAdviserPareto.cpp: single winding, 100 uH,
+//   600 Vpp sinusoidal @ 100 kHz, 25 C.
+// =============================================================================
+
+#include <chrono>
+#include <filesystem>
+#include <string>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "advisers/AdviserResultCache.h"
+#include "advisers/MagneticAdviser.h"
+#include "constructive_models/Mas.h"
+#include "processors/Inputs.h"
+#include "support/Settings.h"
+#include "support/Utils.h"
+
+#include "TestingUtils.h"
+
+using namespace MAS;
+using namespace OpenMagnetics;
+
+namespace {
+
+OpenMagnetics::Inputs make_inductor_inputs() {
+    return OpenMagnetics::Inputs::create_quick_operating_point(
+        100000, 10e-5, 25, WaveformLabel::SINUSOIDAL, 600, 0.5, 0, {});
+}
+
+AdviserResultCache::Results make_results(const std::string& reference, double scoring) {
+    auto magnetic = OpenMagneticsTesting::get_quick_magnetic("ETD 29", OpenMagneticsTesting::get_ground_gap(0.0005), {20});
+    MagneticManufacturerInfo manufacturerInfo;
+    manufacturerInfo.set_reference(reference);
+    magnetic.set_manufacturer_info(manufacturerInfo);
+    Mas mas;
+    mas.set_inputs(make_inductor_inputs());
+    mas.set_magnetic(magnetic);
+    return {{mas, scoring}};
+}
+
+// The same request with only the waveforms: no processed data or harmonics.
+OpenMagnetics::Inputs strip_processed(const OpenMagnetics::Inputs& inputs) {
+    json inputsJson;
+    to_json(inputsJson, inputs);
+    for (auto& operatingPoint : inputsJson["operatingPoints"]) {
+        for (auto& excitation : operatingPoint["excitationsPerWinding"]) {
+            excitation.erase("magneticFieldStrength");
+            excitation.erase("magneticFluxDensity");
+            excitation.erase("magnetizingCurrent");
+            for (auto signal : {"current", "voltage"}) {
+                if (excitation.contains(signal)) {
+                    excitation[signal].erase("processed");
+                    excitation[signal].erase("harmonics");
+                }
+            }
+        }
+    }
+    return OpenMagnetics::Inputs(inputsJson, false);
+}
+
+} // namespace
+
+TEST_CASE("Test_AdviserResultCache_Lru_Eviction_And_Invalidation", "[adviser][magnetic-adviser][cache]") {
+    settings.reset();
+    settings.set_adviser_result_cache_size(2);
+    auto& cache = AdviserResultCache::instance();
+    cache.clear();
+
+    auto keyA = AdviserResultCache::make_key(json{{"request", "a"}});
+    auto keyB = AdviserResultCache::make_key(json{{"request", "b"}});
+    auto keyC = AdviserResultCache::make_key(json{{"request", "c"}});
+    CHECK(keyA.hash != keyB.hash);
+    CHECK(AdviserResultCache::make_key(json{{"request", "a"}}).hash == keyA.hash);
+
+    cache.store(keyA, make_results("A", 1.0));
+    cache.store(keyB, make_results("B", 2.0));
+    // Touch A so that B is the least recently used entry.
+    REQUIRE(cache.read(keyA).has_value());
+    cache.store(keyC, make_results("C", 3.0));
+
+    CHECK(cache.size() == 2);
+    CHECK(!cache.read(keyB).has_value());
+    auto hit = cache.read(keyA);
+    REQUIRE(hit.has_value());
+    CHECK(hit->front().first.get_magnetic().get_reference() == "A");
+    CHECK(hit->front().second == 1.0);
+
+    SECTION("A settings change changes the key") {
+        settings.set_reluctance_model(ReluctanceModels::MUEHLETHALER);
+        CHECK(AdviserResultCache::make_key(json{{"request", "a"}}).hash != keyA.hash);
+    }
+    SECTION("Loading other catalogue data changes the key") {
+        load_databases(json{{"cores", json::array()}});
+        auto reloadedKey = AdviserResultCache::make_key(json{{"request", "a"}});
+        CHECK(reloadedKey.hash != keyA.hash);
+        CHECK(!cache.read(reloadedKey).has_value());
+        clear_databases();
+    }
+    SECTION("An in-place catalogue edit changes the key") {
+        bump_databases_generation();
+        auto reloadedKey = AdviserResultCache::make_key(json{{"request", "a"}});
+        CHECK(reloadedKey.hash != keyA.hash);
+        CHECK(!cache.read(reloadedKey).has_value());
+    }
+
+    cache.clear();
+    settings.reset();
+}
+
+TEST_CASE("Test_AdviserResultCache_Disk_Round_Trip", "[adviser][magnetic-adviser][cache]") {
+    settings.reset();
+    auto directory = std::filesystem::temp_directory_path() / "mkf_adviser_result_cache_test";
+    std::filesystem::remove_all(directory);
+    settings.set_adviser_result_cache_directory(directory.string());
+    settings.set_adviser_result_cache_size(0);
+    auto& cache = AdviserResultCache::instance();
+    cache.clear();
+    clear_databases();
+
+    auto key = AdviserResultCache::make_key(json{{"request", "disk"}});
+    REQUIRE(key.persistent);
+    cache.store(key, make_results("D", 0.5));
+    CHECK(cache.size() == 0);
+    CHECK(std::filesystem::exists(directory / (key.hash + ".json")));
+
+    auto hit = cache.read(key);
+    REQUIRE(hit.has_value());
+    CHECK(hit->front().first.get_magnetic().get_reference() == "D");
+    CHECK(hit->front().second == 0.5);
+
+    SECTION("The key names the catalogue contents, not this process's generation") {
+        clear_databases();
+        auto reloadedKey = AdviserResultCache::make_key(json{{"request", "disk"}});
+        CHECK(reloadedKey.hash == key.hash);
+        CHECK(cache.read(reloadedKey).has_value());
+    }
+    SECTION("Keys made after an in-place edit stay off disk") {
+        bump_databases_generation();
+        auto editedKey = AdviserResultCache::make_key(json{{"request", "disk"}});
+        CHECK(!editedKey.persistent);
+        cache.store(editedKey, make_results("E", 0.25));
+        CHECK(!std::filesystem::exists(directory / (editedKey.hash + ".json")));
+        CHECK(!cache.read(editedKey).has_value());
+        clear_databases();
+    }
+
+    std::filesystem::remove_all(directory);
+    settings.reset();
+}
+
+TEST_CASE("Test_AdviserResultCache_Repeated_Advise", "[adviser][magnetic-adviser][cache][heavy]") {
+    settings.reset();
+    settings.set_adviser_result_cache_size(4);
+    AdviserResultCache::instance().clear();
+    auto inputs = make_inductor_inputs();
+
+    MagneticAdviser adviser;
+    auto start = std::chrono::steady_clock::now();
+    auto first = adviser.get_advised_magnetic(inputs, 2);
+    auto searchDuration = std::chrono::steady_clock::now() - start;
+    REQUIRE(!first.empty());
+    CHECK(AdviserResultCache::instance().size() == 1);
+
+    MagneticAdviser repeatedAdviser;
+    start = std::chrono::steady_clock::now();
+    auto repeated = repeatedAdviser.get_advised_magnetic(inputs, 2);
+    auto cachedDuration = std::chrono::steady_clock::now() - start;
+    REQUIRE(repeated.size() == first.size());
+    for (size_t i = 0; i < first.size(); ++i) {
+        CHECK(repeated[i].first.get_magnetic().get_reference() == first[i].first.get_magnetic().get_reference());
+        CHECK(repeated[i].second == first[i].second);
+    }
+    CHECK(cachedDuration < searchDuration);
+
+    // A different result count is a different request.
+    repeatedAdviser.get_advised_magnetic(inputs, 1);
+    CHECK(AdviserResultCache::instance().size() == 2);
+
+    AdviserResultCache::instance().clear();
+    settings.reset();
+}
+
+TEST_CASE("Test_AdviserResultCache_Raw_And_Processed_Inputs_Share_Entry", "[adviser][magnetic-adviser][cache][heavy]") {
+    settings.reset();
+    settings.set_adviser_result_cache_size(4);
+    AdviserResultCache::instance().clear();
+    auto inputs = make_inductor_inputs();
+    inputs.process();
+    auto rawInputs = strip_processed(inputs);
+    REQUIRE(!rawInputs.get_operating_points()[0].get_excitations_per_winding()[0].get_current()->get_processed());
+
+    MagneticAdviser adviser;
+    auto fromRaw = adviser.get_advised_magnetic(rawInputs, 2);
+    REQUIRE(!fromRaw.empty());
+    CHECK(AdviserResultCache::instance().size() == 1);
+
+    auto fromProcessed = adviser.get_advised_magnetic(inputs, 2);
+    CHECK(AdviserResultCache::instance().size() == 1);
+    REQUIRE(fromProcessed.size() == fromRaw.size());
+    for (size_t i = 0; i < fromRaw.size(); ++i) {
+        CHECK(fromProcessed[i].first.get_magnetic().get_reference() == fromRaw[i].first.get_magnetic().get_reference());
+    }
+
+    AdviserResultCache::instance().clear();
+    settings.reset();
+}
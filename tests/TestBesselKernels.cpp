@@ -0,0 +1,90 @@
+// =============================================================================
+// TestBesselKernels.cpp
+// =============================================================================
+// support/BesselKernels against the generic series in support/Utils, over the
+// arguments the skin and proximity models use: x = d / (delta sqrt 2) from
+// thin Litz strands (0.01) to thick round wire at high harmonics (~20), where
+// the generic series is still trustworthy (it stops at a 1e-4 increment).
+// =============================================================================
+
+#include <cmath>
+#include <complex>
+#include <numbers>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+
+#include "support/BesselKernels.h"
+#include "support/Utils.h"
+
+using namespace OpenMagnetics;
+
+namespace {
+
+std::vector<double> practical_arguments() {
+    std::vector<double> arguments;
+    for (double x = 0.01; x < 20; x *= 1.1) {
+        arguments.push_back(x);
+    }
+    return arguments;
+}
+
+} // namespace
+
+TEST_CASE("Test_Kelvin_Functions_Match_Generic_Series", "[support][bessel-kernels]") {
+    auto arguments = practical_arguments();
+    for (int order : {0, 1, 2}) {
+        auto batch = kelvin_functions(order, arguments);
+        REQUIRE(batch.size() == arguments.size());
+        for (size_t i = 0; i < arguments.size(); ++i) {
+            double x = arguments[i];
+            INFO("order " << order << ", x " << x);
+            auto reference = bessel_first_kind(order, x * std::polar(1.0, 0.75 * std::numbers::pi));
+            double scale = std::abs(reference);
+            auto kelvin = kelvin_functions(order, x);
+            CHECK(std::abs(kelvin.ber - reference.real()) <= 1e-3 * scale);
+            CHECK(std::abs(kelvin.bei - reference.imag()) <= 1e-3 * scale);
+            CHECK(batch[i].ber == kelvin.ber);
+            CHECK(batch[i].bei == kelvin.bei);
+
+            // Derivatives against a central difference of the kernel itself.
+            double step = 1e-6 * x;
+            auto above = kelvin_functions(order, x + step);
+            auto below = kelvin_functions(order, x - step);
+            double derivativeScale = std::abs(kelvin.derivativeBer) + std::abs(kelvin.derivativeBei) + 1e-12;
+            CHECK(std::abs(kelvin.derivativeBer - (above.ber - below.ber) / (2 * step)) <= 1e-5 * derivativeScale);
+            CHECK(std::abs(kelvin.derivativeBei - (above.bei - below.bei) / (2 * step)) <= 1e-5 * derivativeScale);
+        }
+    }
+}
+
+TEST_CASE("Test_Kelvin_Functions_Continuous_At_Asymptotic_Crossover", "[support][bessel-kernels]") {
+    for (int order : {0, 1, 2}) {
+        auto below = kelvin_functions(order, 30 - 1e-9);
+        auto above = kelvin_functions(order, 30);
+        double scale = std::hypot(above.ber, above.bei);
+        CHECK(std::abs(above.ber - below.ber) <= 1e-9 * scale);
+        CHECK(std::abs(above.bei - below.bei) <= 1e-9 * scale);
+    }
+}
+
+TEST_CASE("Test_Modified_Bessel_Ratio_Kernel_Matches_Generic_Series", "[support][bessel-kernels]") {
+    // Near |z| = 20 the generic ratio itself drifts (float gamma overflow), so
+    // the comparison stops at 15; the kernel's own accuracy holds up to 20.
+    std::vector<std::complex<double>> arguments;
+    for (double x : practical_arguments()) {
+        if (std::abs(std::complex<double>(x, x)) < 15) {
+            arguments.push_back({x, x});
+        }
+    }
+    auto batch = modified_bessel_ratio_I1_I0_kernel(arguments);
+    for (size_t i = 0; i < arguments.size(); ++i) {
+        auto z = arguments[i];
+        INFO("z " << z);
+        auto reference = modified_bessel_first_kind(1, z) / modified_bessel_first_kind(0, z);
+        CHECK(std::abs(batch[i] - reference) <= 1e-3 * std::abs(reference));
+        CHECK(batch[i] == modified_bessel_ratio_I1_I0(z));
+    }
+    CHECK(modified_bessel_ratio_I1_I0_kernel(std::complex<double>(0, 0)) == std::complex<double>(0, 0));
+}
@@ -0,0 +1,130 @@
+// =============================================================================
+// TestCircuitSimulatorCurveFitting.cpp
+// =============================================================================
+// The analytic Jacobians handed to eigen_levmar_der() against central
+// differences of the matching *_func, and the memo in front of the AC- and
+// core-resistance fits.
+// =============================================================================
+
+#include <cmath>
+#include <functional>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "processors/CircuitSimulatorInterface.h"
+#include "TestingUtils.h"
+
+using namespace OpenMagnetics;
+
+namespace {
+
+using LevmarFunction = void (*)(double *p, double *x, int m, int n, void *data);
+using LevmarJacobian = void (*)(double *p, double *jac, int m, int n, void *data);
+
+void check_jacobian(LevmarFunction func, LevmarJacobian jacobian, std::vector<double> parameters, size_t numberResiduals, void* data) {
+    int m = static_cast<int>(parameters.size());
+    int n = static_cast<int>(numberResiduals);
+    std::vector<double> analytic(numberResiduals * parameters.size());
+    jacobian(parameters.data(), analytic.data(), m, n, data);
+
+    for (int j = 0; j < m; ++j) {
+        double step = 1e-6 * std::fabs(parameters[j]);
+        auto above = parameters;
+        auto below = parameters;
+        above[j] += step;
+        below[j] -= step;
+        std::vector<double> residualsAbove(numberResiduals);
+        std::vector<double> residualsBelow(numberResiduals);
+        func(above.data(), residualsAbove.data(), m, n, data);
+        func(below.data(), residualsBelow.data(), m, n, data);
+        for (int i = 0; i < n; ++i) {
+            INFO("residual " << i << ", parameter " << j);
+            double numeric = (residualsAbove[i] - residualsBelow[i]) / (2 * step);
+            double derivative = analytic[i * m + j];
+            CHECK(std::fabs(derivative - numeric) <= 1e-5 * std::fabs(derivative) + 1e-9 * std::fabs(residualsAbove[i]) / std::fabs(parameters[j]));
+        }
+    }
+}
+
+std::vector<double> sweep_frequencies() {
+    std::vector<double> frequencies;
+    for (double frequency = 1e3; frequency < 3e6; frequency *= 2) {
+        frequencies.push_back(frequency);
+    }
+    return frequencies;
+}
+
+} // namespace
+
+TEST_CASE("Test_Curve_Fitting_Jacobians_Match_Central_Differences", "[processor][circuit-simulator-exporter][curve-fitting]") {
+    auto frequencies = sweep_frequencies();
+    std::vector<double> dcResistanceAndFrequencies = {0.05};
+    dcResistanceAndFrequencies.insert(dcResistanceAndFrequencies.end(), frequencies.begin(), frequencies.end());
+    size_t numberFrequencies = frequencies.size();
+
+    SECTION("Analytical") {
+        check_jacobian(CircuitSimulatorExporter::analytical_func, CircuitSimulatorExporter::analytical_jacobian,
+                       {0.05, 1e-4, 1e-8}, numberFrequencies, frequencies.data());
+    }
+    SECTION("Ladder") {
+        // Every stage settles well inside the 1e-4 s bound of ladder_model().
+        check_jacobian(CircuitSimulatorExporter::ladder_func, CircuitSimulatorExporter::ladder_jacobian,
+                       {0.02, 2e-7, 0.05, 1e-7, 0.1, 5e-8, 0.3, 2e-8, 0.8, 1e-8}, numberFrequencies, dcResistanceAndFrequencies.data());
+    }
+    SECTION("Core ladder") {
+        check_jacobian(CircuitSimulatorExporter::core_ladder_func, CircuitSimulatorExporter::core_ladder_jacobian,
+                       {0.3, 1e-6, 0.7, 2e-6, 1.5, 5e-7}, numberFrequencies, dcResistanceAndFrequencies.data());
+    }
+    SECTION("Core Rosano") {
+        check_jacobian(CircuitSimulatorExporter::core_rosano_func, CircuitSimulatorExporter::core_rosano_jacobian,
+                       {0.5, 20, 1e-5, 200, 5e-5, 1e-9}, numberFrequencies, frequencies.data());
+    }
+    SECTION("Winding Rosano") {
+        check_jacobian(CircuitSimulatorExporter::winding_rosano_func, CircuitSimulatorExporter::winding_rosano_jacobian,
+                       {0.01, 1e-6, 0.02, 3e-7, 0.05, 1e-7, 0.1, 3e-8, 0.2, 1e-8, 0.4, 3e-9}, numberFrequencies, dcResistanceAndFrequencies.data());
+    }
+    SECTION("Fractional pole") {
+        check_jacobian(CircuitSimulatorExporter::fracpole_skin_func, CircuitSimulatorExporter::fracpole_skin_jacobian,
+                       {1e-4, 0.6}, numberFrequencies, dcResistanceAndFrequencies.data());
+    }
+}
+
+TEST_CASE("Test_Curve_Fitting_Jacobian_Zero_Out_Of_Domain", "[processor][circuit-simulator-exporter][curve-fitting]") {
+    std::vector<double> dcResistanceAndFrequencies = {0.05, 1e3, 1e5};
+    // A negative resistance puts every point on the 1e30 penalty.
+    std::vector<double> parameters = {-0.3, 1e-6, 0.7, 2e-6, 1.5, 5e-7};
+    std::vector<double> jacobian(2 * parameters.size(), 1);
+    CircuitSimulatorExporter::core_ladder_jacobian(parameters.data(), jacobian.data(), 6, 2, dcResistanceAndFrequencies.data());
+    for (auto derivative : jacobian) {
+        CHECK(derivative == 0);
+    }
+}
+
+TEST_CASE("Test_Curve_Fitting_Memo_Returns_Same_Coefficients", "[processor][circuit-simulator-exporter][curve-fitting]") {
+    auto gapping = OpenMagneticsTesting::get_residual_gap();
+    auto magnetic = OpenMagneticsTesting::get_quick_magnetic("ETD 39", gapping, {20, 10}, 1, "3C97");
+    auto coil = magnetic.get_coil();
+    coil.wind();
+    magnetic.set_coil(coil);
+
+    CircuitSimulatorExporter::clear_curve_fitting_cache();
+    REQUIRE(CircuitSimulatorExporter::get_curve_fitting_cache_size() == 0);
+
+    auto first = CircuitSimulatorExporter::calculate_ac_resistance_coefficients_per_winding(magnetic, 25, CircuitSimulatorExporterCurveFittingModes::ANALYTICAL);
+    CHECK(CircuitSimulatorExporter::get_curve_fitting_cache_size() == 1);
+    auto second = CircuitSimulatorExporter::calculate_ac_resistance_coefficients_per_winding(magnetic, 25, CircuitSimulatorExporterCurveFittingModes::ANALYTICAL);
+    CHECK(CircuitSimulatorExporter::get_curve_fitting_cache_size() == 1);
+    CHECK(first == second);
+
+    // Another temperature is another fit.
+    CircuitSimulatorExporter::calculate_ac_resistance_coefficients_per_winding(magnetic, 80, CircuitSimulatorExporterCurveFittingModes::ANALYTICAL);
+    CHECK(CircuitSimulatorExporter::get_curve_fitting_cache_size() == 2);
+
+    auto core = CircuitSimulatorExporter::calculate_core_resistance_coefficients(magnetic, 25);
+    CHECK(CircuitSimulatorExporter::get_curve_fitting_cache_size() == 3);
+    CHECK(CircuitSimulatorExporter::calculate_core_resistance_coefficients(magnetic, 25) == core);
+
+    CircuitSimulatorExporter::clear_curve_fitting_cache();
+    CHECK(CircuitSimulatorExporter::get_curve_fitting_cache_size() == 0);
+}
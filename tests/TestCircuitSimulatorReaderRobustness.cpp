@@ -313,3 +313,165 @@ TEST_CASE("Reader: parses the real LTspice flyback export with a differential pr
         REQUIRE(column.data.size() == expectedSamples);
     }
 }
+
+TEST_CASE("Reader: in-place number parsing keeps std::stod's accepted forms",
+          "[processor][circuit-simulation-reader][robustness][smoke-test]") {
+    // Plain decimals go through std::from_chars; a leading '+', hex and
+    // trailing units still parse as std::stod always parsed them.
+    std::string csv =
+        "time,Iout\n"
+        "0,+1.5\n"
+        "1e-6, -2.5e-3 \n"
+        "2e-6,0x10\n"
+        "3e-6,4.5A\n";
+    CircuitSimulationReader reader(csv, true);
+    auto data = reader.get_columns()[1].data;
+    REQUIRE(data.size() == 4);
+    CHECK(data[0] == 1.5);
+    CHECK(data[1] == -2.5e-3);
+    CHECK(data[2] == 16);
+    CHECK(data[3] == 4.5);
+}
+
+TEST_CASE("Reader: column projection keeps the requested and the time columns",
+          "[processor][circuit-simulation-reader][robustness][smoke-test]") {
+    auto csv = build_two_acquisition_csv(50, 50);
+    CircuitSimulationReader::ReadOptions readOptions;
+    readOptions.columnNames = {"I_2"};
+    CircuitSimulationReader projected(csv, readOptions, true);
+    CircuitSimulationReader full(csv, true);
+
+    auto names = projected.extract_column_names();
+    REQUIRE(names == std::vector<std::string>{"Time / s_1", "Time / s_2", "I_2"});
+    CHECK(projected.get_columns()[2].data == full.get_columns()[5].data);
+}
+
+TEST_CASE("Reader: period window keeps only the tail and extracts the same operating point",
+          "[processor][circuit-simulation-reader][robustness][smoke-test]") {
+    // 100 periods of a 10 kHz triangle at 200 samples per period.
+    auto triangle = [](double t, double lo, double hi) {
+        double phase = t * 10e3 - std::floor(t * 10e3);
+        return lo + (hi - lo) * (phase < 0.5? 2 * phase : 2 * (1 - phase));
+    };
+    std::ostringstream csv;
+    csv.precision(12);
+    csv << "Time,V,I\n";
+    for (size_t i = 0; i < 20000; ++i) {
+        double t = i * 5e-7;
+        csv << t << "," << (std::fmod(t * 10e3, 1) < 0.5? 10 : -10) << "," << triangle(t, -50, 50) << "\n";
+    }
+
+    CircuitSimulationReader::ReadOptions readOptions;
+    readOptions.frequency = 10e3;
+    CircuitSimulationReader windowed(csv.str(), readOptions, true);
+    CircuitSimulationReader full(csv.str(), true);
+
+    for (const auto& column : windowed.get_columns()) {
+        CHECK(column.data.size() < 2 * (2 * 200 + 1024));
+    }
+    std::vector<std::map<std::string, std::string>> mapColumnNames = {
+        {{"time", "Time"}, {"current", "I"}, {"voltage", "V"}}};
+    auto windowedCurrent = windowed.extract_operating_point(1, 10e3, mapColumnNames).get_excitations_per_winding()[0].get_current().value();
+    auto fullCurrent = full.extract_operating_point(1, 10e3, mapColumnNames).get_excitations_per_winding()[0].get_current().value();
+    CHECK(windowedCurrent.get_waveform().value().get_data() == fullCurrent.get_waveform().value().get_data());
+    CHECK(windowedCurrent.get_processed().value().get_rms().value() == fullCurrent.get_processed().value().get_rms().value());
+}
+
+// Appends the bytes of a little-endian value, the byte order of SPICE raw files.
+template<typename T>
+static void append_raw_value(std::string& raw, T value) {
+    raw.append(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+static std::string to_utf16(const std::string& text) {
+    std::string wide;
+    for (char c : text) {
+        wide.push_back(c);
+        wide.push_back('\0');
+    }
+    return wide;
+}
+
+TEST_CASE("Reader: ngspice binary raw file matches the same data read as CSV",
+          "[processor][circuit-simulation-reader][robustness][smoke-test]") {
+    // An operating-point plot ahead of the transient one, as ngspice writes
+    // them when both analyses run; the transient plot must be the one read.
+    auto triangle = [](double t, double lo, double hi) {
+        double phase = t * 10e3 - std::floor(t * 10e3);
+        return lo + (hi - lo) * (phase < 0.5? 2 * phase : 2 * (1 - phase));
+    };
+    std::string raw = "Title: test\nDate: today\nPlotname: Operating Point\nFlags: real\nNo. Variables: 1\nNo. Points: 1\n"
+                      "Variables:\n\t0\tv(out)\tvoltage\nBinary:\n";
+    append_raw_value(raw, 12.0);
+    raw += "Title: test\nDate: today\nPlotname: Transient Analysis\nFlags: real\nNo. Variables: 3\nNo. Points: 1000\n"
+           "Variables:\n\t0\ttime\ttime\n\t1\tv(pri)\tvoltage\n\t2\ti(lpri)\tcurrent\nBinary:\n";
+    std::ostringstream csv;
+    csv.precision(17);
+    csv << "time,v(pri),i(lpri)\n";
+    for (size_t i = 0; i < 1000; ++i) {
+        double t = i * 5e-7;
+        double voltage = std::fmod(t * 10e3, 1) < 0.5? 10 : -10;
+        double current = triangle(t, -50, 50);
+        append_raw_value(raw, t);
+        append_raw_value(raw, voltage);
+        append_raw_value(raw, current);
+        csv << t << "," << voltage << "," << current << "\n";
+    }
+    REQUIRE(CircuitSimulationReader::is_spice_raw(raw));
+
+    CircuitSimulationReader rawReader(raw, true);
+    CircuitSimulationReader csvReader(csv.str(), true);
+    REQUIRE(rawReader.extract_column_names() == csvReader.extract_column_names());
+    for (size_t column = 0; column < 3; ++column) {
+        CHECK(rawReader.get_columns()[column].data == csvReader.get_columns()[column].data);
+    }
+    std::vector<std::map<std::string, std::string>> mapColumnNames = {
+        {{"time", "time"}, {"current", "i(lpri)"}, {"voltage", "v(pri)"}}};
+    auto rawCurrent = rawReader.extract_operating_point(1, 10e3, mapColumnNames).get_excitations_per_winding()[0].get_current().value();
+    auto csvCurrent = csvReader.extract_operating_point(1, 10e3, mapColumnNames).get_excitations_per_winding()[0].get_current().value();
+    CHECK(rawCurrent.get_waveform().value().get_data() == csvCurrent.get_waveform().value().get_data());
+}
+
+TEST_CASE("Reader: LTspice raw file with a UTF-16 header and single-precision signals",
+          "[processor][circuit-simulation-reader][robustness][smoke-test]") {
+    // LTspice stores the time axis as double (negative on compressed points)
+    // and the signals as float, point by point or, with fastaccess, vector by
+    // vector.
+    for (bool fastAccess : {false, true}) {
+        std::string raw = to_utf16(std::string("Title: * flyback.asc\nDate: today\nPlotname: Transient Analysis\nFlags: real forward") +
+                                   (fastAccess? " fastaccess" : "") + "\nNo. Variables: 2\nNo. Points:           4\nOffset:   0\n"
+                                   "Command: Linear Technology Corporation LTspice XVII\nVariables:\n\t0\ttime\ttime\n\t1\tI(L1)\tdevice_current\nBinary:\n");
+        std::vector<double> time = {0, 1e-6, 2e-6, 3e-6};
+        std::vector<float> current = {0.5f, 1.5f, 0.5f, 1.5f};
+        if (fastAccess) {
+            for (size_t i = 0; i < 4; ++i) {
+                append_raw_value(raw, i == 2? -time[i] : time[i]);
+            }
+            for (size_t i = 0; i < 4; ++i) {
+                append_raw_value(raw, current[i]);
+            }
+        }
+        else {
+            for (size_t i = 0; i < 4; ++i) {
+                append_raw_value(raw, i == 2? -time[i] : time[i]);
+                append_raw_value(raw, current[i]);
+            }
+        }
+        INFO("fastaccess " << fastAccess);
+        CircuitSimulationReader reader(raw, true);
+        REQUIRE(reader.extract_column_names() == std::vector<std::string>{"time", "I(L1)"});
+        CHECK(reader.get_columns()[0].data == time);
+        CHECK(reader.get_columns()[1].data == std::vector<double>{0.5, 1.5, 0.5, 1.5});
+    }
+}
+
+TEST_CASE("Reader: truncated binary raw file throws with the plot name",
+          "[processor][circuit-simulation-reader][robustness][smoke-test]") {
+    std::string raw = "Title: test\nPlotname: Transient Analysis\nFlags: real\nNo. Variables: 2\nNo. Points: 10\n"
+                      "Variables:\n\t0\ttime\ttime\n\t1\tv(out)\tvoltage\nBinary:\n";
+    for (size_t i = 0; i < 5; ++i) {
+        append_raw_value(raw, i * 1e-6);
+        append_raw_value(raw, 1.0);
+    }
+    REQUIRE_THROWS_WITH(CircuitSimulationReader(raw, true), ContainsSubstring("Transient Analysis"));
+}
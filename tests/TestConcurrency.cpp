@@ -16,6 +16,8 @@
 #include "support/Settings.h"
 #include "support/Utils.h"
 #include "support/LibraryContext.h"
+#include "support/Parallel.h"
+#include "support/Cancellation.h"
 #include "advisers/CoreAdviser.h"
 #include "advisers/MagneticAdviser.h"
 #include "physical_models/WindingLosses.h"
@@ -26,6 +28,7 @@
 
 #include <atomic>
 #include <barrier>
+#include <chrono>
 #include <cmath>
 #include <fstream>
 #include <sstream>
@@ -535,3 +538,152 @@ TEST_CASE("Test_Concurrency_MagneticAdviser_Parallel_Constraints_Isolated", "[co
     }
     settings.reset();
 }
+
+TEST_CASE("Test_Concurrency_Parallel_For_Slots_Settings_And_Exceptions", "[concurrency][parallel]") {
+    settings.reset();
+    settings.set_parallel_number_threads(4);
+    settings.set_coil_delimit_and_compact(false);  // non-default, must reach the workers
+
+    constexpr size_t NUMBER_INDICES = 200;
+    std::vector<double> values(NUMBER_INDICES, 0);
+    std::vector<int> inheritedSetting(NUMBER_INDICES, -1);
+    std::vector<int> frozenInside(NUMBER_INDICES, -1);
+    parallel_for(NUMBER_INDICES, [&](size_t index) {
+        values[index] = std::sqrt(double(index));
+        inheritedSetting[index] = Settings::GetInstance().get_coil_delimit_and_compact()? 1 : 0;
+        frozenInside[index] = databases_frozen()? 1 : 0;
+    });
+    for (size_t index = 0; index < NUMBER_INDICES; ++index) {
+        CHECK(values[index] == std::sqrt(double(index)));
+        CHECK(inheritedSetting[index] == 0);
+        CHECK(frozenInside[index] == 1);
+    }
+    // The region only unfreezes what it froze itself.
+    CHECK(!databases_frozen());
+
+    // Nested loops run serially inside the worker instead of deadlocking.
+    std::vector<size_t> nestedSums(8, 0);
+    parallel_for(nestedSums.size(), [&](size_t outer) {
+        std::vector<size_t> inner(10, 0);
+        parallel_for(inner.size(), [&](size_t index) { inner[index] = outer * index; });
+        for (auto value : inner) {
+            nestedSums[outer] += value;
+        }
+    });
+    for (size_t outer = 0; outer < nestedSums.size(); ++outer) {
+        CHECK(nestedSums[outer] == outer * 45);
+    }
+
+    // The first exception is rethrown on the calling thread.
+    REQUIRE_THROWS_AS(parallel_for(NUMBER_INDICES, [](size_t index) {
+        if (index == 17) {
+            throw std::runtime_error("index 17");
+        }
+    }), std::runtime_error);
+    CHECK(!databases_frozen());
+    settings.reset();
+}
+
+TEST_CASE("Test_Concurrency_Settings_Snapshot_Scope_And_Explicit_Parallel_For", "[concurrency][parallel]") {
+    settings.reset();
+    settings.set_parallel_number_threads(4);
+    settings.set_coil_delimit_and_compact(false);
+    auto snapshot = SettingsSnapshot::capture();
+    CHECK(!snapshot->get_coil_delimit_and_compact());
+
+    // The snapshot is immutable: later changes on the caller do not reach it.
+    settings.set_coil_delimit_and_compact(true);
+    CHECK(!snapshot.get().get_coil_delimit_and_compact());
+
+    // A bare thread sees defaults; a Scope installs the snapshot and puts the
+    // thread's own Settings back when it ends.
+    int insideScope = -1;
+    int afterScope = -1;
+    std::thread worker([&snapshot, &insideScope, &afterScope] {
+        Settings::GetInstance().set_coil_delimit_and_compact(true);
+        {
+            SettingsSnapshot::Scope scope(snapshot);
+            insideScope = Settings::GetInstance().get_coil_delimit_and_compact()? 1 : 0;
+        }
+        afterScope = Settings::GetInstance().get_coil_delimit_and_compact()? 1 : 0;
+    });
+    worker.join();
+    CHECK(insideScope == 0);
+    CHECK(afterScope == 1);
+
+    // Tasks (caller included) run under the snapshot passed in, and the
+    // caller gets its own Settings back afterwards.
+    constexpr size_t NUMBER_INDICES = 100;
+    std::vector<int> seenSetting(NUMBER_INDICES, -1);
+    parallel_for(NUMBER_INDICES, snapshot, [&](size_t index) {
+        seenSetting[index] = Settings::GetInstance().get_coil_delimit_and_compact()? 1 : 0;
+    });
+    for (size_t index = 0; index < NUMBER_INDICES; ++index) {
+        CHECK(seenSetting[index] == 0);
+    }
+    CHECK(settings.get_coil_delimit_and_compact());
+
+    // A guard on the caller reaches the workers of a plain parallel_for.
+    {
+        SettingsGuard<bool> guard(settings, &Settings::get_coil_delimit_and_compact, &Settings::set_coil_delimit_and_compact, false);
+        parallel_for(NUMBER_INDICES, [&](size_t index) {
+            seenSetting[index] = Settings::GetInstance().get_coil_delimit_and_compact()? 1 : 0;
+        });
+    }
+    for (size_t index = 0; index < NUMBER_INDICES; ++index) {
+        CHECK(seenSetting[index] == 0);
+    }
+    settings.reset();
+}
+
+TEST_CASE("Test_Concurrency_MagneticAdviser_Cancellation_And_Deadline", "[concurrency][magnetic-adviser][heavy]") {
+    settings.reset();
+    auto inputs = make_inputs(QUERIES[0]);
+
+    // A deadline already in the past: nothing new is evaluated, the call
+    // returns promptly and says so.
+    {
+        StopCondition stopCondition;
+        stopCondition.set_deadline(StopCondition::Clock::now());
+        MagneticAdviser adviser;
+        adviser.set_stop_condition(stopCondition);
+        auto start = std::chrono::steady_clock::now();
+        adviser.get_advised_magnetic(inputs, 3);
+        CHECK(adviser.get_last_search_truncated());
+        CHECK(std::chrono::steady_clock::now() - start < std::chrono::seconds(30));
+    }
+
+    // Cancelled from the progress callback once a first design is in: the
+    // best design found so far is still returned.
+    {
+        CancellationToken token;
+        StopCondition stopCondition;
+        stopCondition.set_cancellation_token(token);
+        MagneticAdviser adviser;
+        adviser.set_stop_condition(stopCondition);
+        std::vector<AdviserProgress::Stage> stages;
+        size_t bestBeforeCancel = 0;
+        adviser.set_progress_callback([&](const AdviserProgress& progress) {
+            stages.push_back(progress.stage);
+            if (progress.stage == AdviserProgress::Stage::SCORING && !progress.best.empty() && !token.is_cancelled()) {
+                bestBeforeCancel = progress.best.size();
+                token.cancel();
+            }
+        });
+        auto results = adviser.get_advised_magnetic(inputs, 3);
+        REQUIRE(bestBeforeCancel > 0);
+        CHECK(adviser.get_last_search_truncated());
+        CHECK(results.size() >= 1);
+        REQUIRE(!stages.empty());
+        CHECK(stages.front() == AdviserProgress::Stage::CORE_SELECTION);
+        CHECK(stages.back() == AdviserProgress::Stage::FINISHED);
+    }
+
+    // No stop condition: the flag stays down.
+    {
+        MagneticAdviser adviser;
+        adviser.get_advised_magnetic(inputs, 1);
+        CHECK(!adviser.get_last_search_truncated());
+    }
+    settings.reset();
+}
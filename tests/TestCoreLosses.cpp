@@ -13,6 +13,7 @@
 #include <magic_enum.hpp>
 
 #include <cmath>
+#include <catch2/benchmark/catch_benchmark.hpp>
 #include <catch2/catch_test_macros.hpp>
 #include <catch2/generators/catch_generators.hpp>
 #include <catch2/matchers/catch_matchers_floating_point.hpp>
@@ -24,6 +25,7 @@
 #include <vector>
 #include <iomanip>
 #include <set>
+#include <tuple>
 
 using namespace MAS;
 using namespace OpenMagnetics;
@@ -1932,6 +1934,75 @@ TEST_CASE("Test_Ki_3C95_Steinmetz", "[physical-model][core-losses][igse-core-los
     REQUIRE_THAT(ki, Catch::Matchers::WithinAbs(expectedKi, expectedKi * 0.1));
 }
 
+OperatingPointExcitation get_triangular_magnetic_flux_density_excitation(double frequency, double peakToPeak, double dutyCycle) {
+    ProcessedWaveform processed;
+    processed.set_label(WaveformLabel::TRIANGULAR);
+    processed.set_offset(0);
+    processed.set_peak(peakToPeak / 2);
+    processed.set_peak_to_peak(peakToPeak);
+    processed.set_duty_cycle(dutyCycle);
+    SignalDescriptor magneticFluxDensity;
+    magneticFluxDensity.set_processed(processed);
+    magneticFluxDensity.set_waveform(Inputs::create_waveform(WaveformLabel::TRIANGULAR, peakToPeak, frequency, dutyCycle));
+    OperatingPointExcitation excitation;
+    excitation.set_frequency(frequency);
+    excitation.set_magnetic_flux_density(magneticFluxDensity);
+    return excitation;
+}
+
+// Eq. (14) of the iGSE paper for a triangle of duty D:
+// Pv = ki * dB^beta * f^alpha * (D^(1-alpha) + (1-D)^(1-alpha)).
+TEST_CASE("Test_IGSE_Triangular_Matches_Closed_Form", "[physical-model][core-losses][igse-core-losses-model]") {
+    settings.reset();
+    double frequency = 100000;
+    double peakToPeak = 0.2;
+    double temperature = 25;
+    auto coreMaterial = find_core_material_by_name("3C95");
+    auto steinmetzDatum = CoreLossesModel::get_steinmetz_coefficients(coreMaterial, frequency);
+    double alpha = steinmetzDatum.get_alpha();
+    double beta = steinmetzDatum.get_beta();
+    CoreLossesIGSEModel igseModel;
+    double ki = igseModel.get_ki(steinmetzDatum);
+
+    for (double dutyCycle : {0.2, 0.5, 0.7}) {
+        INFO("Duty cycle: " << dutyCycle);
+        auto excitation = get_triangular_magnetic_flux_density_excitation(frequency, peakToPeak, dutyCycle);
+        double expected = ki * pow(peakToPeak, beta) * pow(frequency, alpha) *
+                          (pow(dutyCycle, 1 - alpha) + pow(1 - dutyCycle, 1 - alpha));
+        expected = CoreLossesModel::apply_temperature_coefficients(expected, steinmetzDatum, temperature);
+        REQUIRE_THAT(igseModel.get_core_volumetric_losses(coreMaterial, excitation, temperature),
+                     Catch::Matchers::WithinRel(expected, 0.01));
+    }
+    settings.reset();
+}
+
+TEST_CASE("Benchmark_IGSE_CIGSE_Waveform_Integration", "[physical-model][core-losses][igse-core-losses-model][!benchmark]") {
+    settings.reset();
+    auto coreMaterial = find_core_material_by_name("3C95");
+    std::vector<OperatingPointExcitation> excitations;
+    for (double dutyCycle : {0.1, 0.3, 0.5, 0.8}) {
+        excitations.push_back(get_triangular_magnetic_flux_density_excitation(100000, 0.2, dutyCycle));
+    }
+    auto igseModel = CoreLossesModel::factory(CoreLossesModels::IGSE);
+    auto cigseModel = CoreLossesModel::factory(CoreLossesModels::CIGSE);
+
+    BENCHMARK("iGSE triangular corpus") {
+        double volumetricLosses = 0;
+        for (auto& excitation : excitations) {
+            volumetricLosses += igseModel->get_core_volumetric_losses(coreMaterial, excitation, 25);
+        }
+        return volumetricLosses;
+    };
+    BENCHMARK("ciGSE triangular corpus") {
+        double volumetricLosses = 0;
+        for (auto& excitation : excitations) {
+            volumetricLosses += cigseModel->get_core_volumetric_losses(coreMaterial, excitation, 25);
+        }
+        return volumetricLosses;
+    };
+    settings.reset();
+}
+
 // Regression test for composite waveforms where excitation frequency (e.g. 60 Hz)
 // differs from switching frequency (e.g. 60 kHz). Previously, standardize_waveform
 // was called with the switching frequency, compressing the time axis and inflating
@@ -3866,3 +3937,92 @@ TEST_CASE("Test_Subcircuit_Export_Accepts_LossFactor_Materials", "[processor][ci
     CHECK(simbaSubcircuit.size() > 50);
     settings.reset();
 }
+
+TEST_CASE("Test_Core_Losses_Tabulated_Within_Tolerance", "[physical-model][core-losses][tabulated]") {
+    settings.reset();
+    settings.set_core_losses_tabulated(true);
+    double tolerance = settings.get_core_losses_tabulated_tolerance();
+    auto exactModel = CoreLossesModel::factory(CoreLossesModels::STEINMETZ);
+    auto tabulatedModel = std::dynamic_pointer_cast<CoreLossesTabulatedModel>(CoreLossesTabulatedModel::wrap_if_enabled(exactModel));
+    REQUIRE(tabulatedModel);
+    CHECK(CoreLossesTabulatedModel::wrap_if_enabled(tabulatedModel) == tabulatedModel);
+    auto coreMaterial = find_core_material_by_name("N87");
+
+    auto make_excitation = [](double frequency, double peak) {
+        json excitationJson;
+        excitationJson["frequency"] = frequency;
+        excitationJson["magneticFluxDensity"]["processed"]["label"] = WaveformLabel::SINUSOIDAL;
+        excitationJson["magneticFluxDensity"]["processed"]["offset"] = 0;
+        excitationJson["magneticFluxDensity"]["processed"]["peak"] = peak;
+        excitationJson["magneticFluxDensity"]["processed"]["peakToPeak"] = 2 * peak;
+        return OperatingPointExcitation(excitationJson);
+    };
+
+    // Off-node points: none of them falls on a grid line of f, B or T.
+    std::vector<std::tuple<double, double, double>> points{
+        {63000, 0.047, 27}, {117000, 0.093, 83}, {231000, 0.031, 101}, {412000, 0.0173, 46},
+    };
+    for (auto& [frequency, peak, temperature] : points) {
+        auto excitation = make_excitation(frequency, peak);
+        double exact = exactModel->get_core_volumetric_losses(coreMaterial, excitation, temperature);
+        double tabulated = tabulatedModel->get_core_volumetric_losses(coreMaterial, excitation, temperature);
+        CHECK(std::abs(tabulated - exact) <= tolerance * exact);
+    }
+    // N87 is smooth around these points: the surface, not the fallback, answered.
+    CHECK(tabulatedModel->get_number_interpolated_queries() > 0);
+
+    // Queries in already built cells evaluate no node again: a smooth cell costs
+    // nothing, one that failed validation costs the single exact fallback.
+    size_t numberExactEvaluations = tabulatedModel->get_number_exact_evaluations();
+    size_t numberInterpolatedQueries = tabulatedModel->get_number_interpolated_queries();
+    for (auto& [frequency, peak, temperature] : points) {
+        tabulatedModel->get_core_volumetric_losses(coreMaterial, make_excitation(frequency * 1.001, peak * 1.001), temperature + 0.1);
+    }
+    size_t numberNewExactEvaluations = tabulatedModel->get_number_exact_evaluations() - numberExactEvaluations;
+    size_t numberNewInterpolatedQueries = tabulatedModel->get_number_interpolated_queries() - numberInterpolatedQueries;
+    CHECK(numberNewExactEvaluations <= points.size());
+    CHECK(numberNewInterpolatedQueries > 0);
+    CHECK(numberNewExactEvaluations + numberNewInterpolatedQueries == points.size());
+
+    // A full waveform is not tabulated: the exact model answers it.
+    auto excitation = make_excitation(100000, 0.05);
+    auto waveform = Inputs::create_waveform(WaveformLabel::SINUSOIDAL, 0.1, 100000);
+    auto magneticFluxDensity = excitation.get_magnetic_flux_density().value();
+    magneticFluxDensity.set_waveform(waveform);
+    excitation.set_magnetic_flux_density(magneticFluxDensity);
+    CHECK(tabulatedModel->get_core_volumetric_losses(coreMaterial, excitation, 25) ==
+          exactModel->get_core_volumetric_losses(coreMaterial, excitation, 25));
+    settings.reset();
+}
+
+TEST_CASE("Test_Core_Losses_Tabulated_Shared_Across_Calls", "[physical-model][core-losses][tabulated]") {
+    settings.reset();
+    settings.set_core_losses_tabulated(true);
+    auto sharedModel = std::dynamic_pointer_cast<CoreLossesTabulatedModel>(CoreLossesTabulatedModel::get_shared(CoreLossesModels::STEINMETZ));
+    REQUIRE(sharedModel);
+    CHECK(CoreLossesTabulatedModel::get_shared(CoreLossesModels::STEINMETZ) == sharedModel);
+    CHECK(CoreLossesTabulatedModel::get_shared(CoreLossesModels::PROPRIETARY) != sharedModel);
+
+    json excitationJson;
+    excitationJson["frequency"] = 117000;
+    excitationJson["magneticFluxDensity"]["processed"]["label"] = WaveformLabel::SINUSOIDAL;
+    excitationJson["magneticFluxDensity"]["processed"]["offset"] = 0;
+    excitationJson["magneticFluxDensity"]["processed"]["peak"] = 0.093;
+    excitationJson["magneticFluxDensity"]["processed"]["peakToPeak"] = 0.186;
+    OperatingPointExcitation excitation(excitationJson);
+    auto coreMaterial = find_core_material_by_name("N87");
+
+    // A second caller finds the cell already built: no exact evaluation at all.
+    sharedModel->get_core_volumetric_losses(coreMaterial, excitation, 83);
+    size_t numberExactEvaluations = sharedModel->get_number_exact_evaluations();
+    CoreLossesTabulatedModel::get_shared(CoreLossesModels::STEINMETZ)->get_core_volumetric_losses(coreMaterial, excitation, 83);
+    CHECK(sharedModel->get_number_exact_evaluations() == numberExactEvaluations);
+
+    // A settings change starts over.
+    settings.set_core_losses_tabulated_tolerance(settings.get_core_losses_tabulated_tolerance() / 2);
+    CHECK(CoreLossesTabulatedModel::get_shared(CoreLossesModels::STEINMETZ) != sharedModel);
+
+    settings.set_core_losses_tabulated(false);
+    CHECK(!std::dynamic_pointer_cast<CoreLossesTabulatedModel>(CoreLossesTabulatedModel::get_shared(CoreLossesModels::STEINMETZ)));
+    settings.reset();
+}
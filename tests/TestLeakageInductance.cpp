@@ -5,6 +5,7 @@
 #include "physical_models/MagnetizingInductance.h"
 #include "support/Painter.h"
 #include "support/Utils.h"
+#include "support/Exceptions.h"
 #include "constructive_models/Core.h"
 #include "constructive_models/Coil.h"
 #include "constructive_models/Wire.h"
@@ -875,6 +876,54 @@ TEST_CASE("Leakage inductance matrix is symmetric and reproduces pairwise leakag
 
     settings.reset();
 }
+
+TEST_CASE("Leakage field basis reproduces the energy of arbitrary current vectors", "[physical-model][leakage-inductance][multi-winding]") {
+    // The basis holds one unit-current field per winding; any other excitation is obtained by
+    // superposition. Its energies must match a direct field solve of the same excitation, and
+    // the matrix built from it must be the same quadratic form: W(I) = I^T·Λ·I / 4.
+    settings.reset();
+    std::vector<int64_t> numberTurns({50, 100, 25});
+    std::vector<int64_t> numberParallels({1, 1, 1});
+    std::string shapeName = "E 42/21/15";
+
+    std::vector<OpenMagnetics::Wire> wires;
+    for (int i = 0; i < 3; ++i) wires.push_back(OpenMagnetics::Wire::create_quick_litz_wire(0.00005, 200));
+    auto coil = OpenMagnetics::Coil::create_quick_coil(shapeName, numberTurns, numberParallels, wires);
+    auto gapping = OpenMagnetics::Core::create_ground_gapping(2e-5, 3);
+    auto core = OpenMagnetics::Core::create_quick_core(shapeName, "3C97", gapping);
+    OpenMagnetics::Magnetic magnetic;
+    magnetic.set_core(core);
+    magnetic.set_coil(coil);
+    double frequency = 100000;
+
+    LeakageInductance li;
+    auto basis = li.calculate_leakage_field_basis(magnetic, frequency);
+    REQUIRE(basis.fieldPerWinding.size() == 3);
+    for (auto& field : basis.fieldPerWinding) {
+        REQUIRE(field.get_data().size() == basis.weightPerPoint.size());
+    }
+    auto leakageMatrix = LeakageInductance::calculate_leakage_inductance_matrix(basis);
+
+    std::vector<std::vector<double>> currentVectors{{1.0, 0.0, 0.0}, {1.0, -0.5, 0.0}, {1.5, -0.7, 0.3}, {-0.2, 0.4, -2.0}};
+    for (auto& currents : currentVectors) {
+        double fromBasis = LeakageInductance::calculate_leakage_field_energy(basis, currents);
+        double direct = li.calculate_leakage_field_energy(magnetic, currents, frequency);
+        CHECK(fromBasis > 0);
+        CHECK_THAT(fromBasis, WithinRel(direct, 1e-6));
+
+        double quadraticForm = 0;
+        for (size_t a = 0; a < 3; ++a) {
+            for (size_t b = 0; b < 3; ++b) {
+                quadraticForm += currents[a] * leakageMatrix[a][b] * currents[b];
+            }
+        }
+        CHECK_THAT(quadraticForm / 4.0, WithinRel(fromBasis, 1e-9));
+    }
+
+    CHECK_THROWS_AS(LeakageInductance::calculate_leakage_field_energy(basis, {1.0, 0.0}), InvalidInputException);
+    settings.reset();
+}
+
 TEST_CASE("MagneticSimulator leakage output is winding-indexed with a zero primary slot", "[physical-model][leakage-inductance]") {
     // Regression for web bug reports 125/134/139 (ABT #198): MagneticSimulator used to emit a
     // secondaries-only (N-1) array into outputs.leakageInductance while the public
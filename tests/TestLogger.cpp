@@ -0,0 +1,165 @@
+// =============================================================================
+// TestLogger.cpp
+// =============================================================================
+// The asynchronous mode of support/Logger: nothing lost under BLOCK with many
+// producers, drops counted and reported under DROP, disableAsync() while
+// other threads log, and level-guarded macros and logEntry that never
+// evaluate a disabled message.
+// =============================================================================
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "support/Logger.h"
+#include "support/Utils.h"
+
+using namespace OpenMagnetics;
+
+namespace {
+
+class SlowSink : public LogSink {
+public:
+    void write(LogLevel, const std::string&, const std::string& message, const std::string&) override {
+        std::this_thread::sleep_for(std::chrono::microseconds(100));
+        _messages.push_back(message);
+    }
+    void flush() override {}
+    const std::vector<std::string>& get_messages() const { return _messages; }
+
+private:
+    std::vector<std::string> _messages;
+};
+
+size_t count_lines(const std::string& contents) {
+    return static_cast<size_t>(std::count(contents.begin(), contents.end(), '\n'));
+}
+
+} // namespace
+
+TEST_CASE("Test_Logger_Async_Keeps_Every_Message_Under_Block", "[support][logger]") {
+    auto& logger = Logger::getInstance();
+    auto previousLevel = logger.getLevel();
+    auto sink = std::make_shared<StringSink>();
+    logger.addSink(sink);
+    logger.setLevel(LogLevel::INFO);
+    // Far smaller than the traffic, so producers do wait for room.
+    logger.enableAsync(64);
+    REQUIRE(logger.isAsync());
+
+    const size_t numberThreads = 8;
+    const size_t messagesPerThread = 500;
+    std::vector<std::thread> threads;
+    for (size_t thread = 0; thread < numberThreads; ++thread) {
+        threads.emplace_back([thread]() {
+            for (size_t index = 0; index < messagesPerThread; ++index) {
+                OM_INFO_M("TestLogger", std::to_string(thread) + ":" + std::to_string(index));
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    logger.flush();
+    CHECK(count_lines(sink->getContents()) == numberThreads * messagesPerThread);
+    CHECK(sink->getContents().find("[TestLogger]") != std::string::npos);
+
+    logger.disableAsync();
+    CHECK(!logger.isAsync());
+    logger.removeSink(sink);
+    logger.setLevel(previousLevel);
+}
+
+TEST_CASE("Test_Logger_Async_Counts_Drops_When_Full", "[support][logger]") {
+    auto& logger = Logger::getInstance();
+    auto previousLevel = logger.getLevel();
+    auto sink = std::make_shared<SlowSink>();
+    logger.addSink(sink);
+    logger.setLevel(LogLevel::INFO);
+    auto droppedBefore = logger.getDroppedCount();
+    logger.enableAsync(4, LogOverflowPolicy::DROP);
+
+    const size_t numberMessages = 500;
+    for (size_t index = 0; index < numberMessages; ++index) {
+        OM_INFO("message " + std::to_string(index));
+    }
+    logger.flush();
+    logger.disableAsync();
+
+    auto dropped = logger.getDroppedCount() - droppedBefore;
+    CHECK(dropped > 0);
+    auto& messages = sink->get_messages();
+    auto reports = std::count_if(messages.begin(), messages.end(), [](const std::string& message) {
+        return message.find("dropped") != std::string::npos;
+    });
+    CHECK(reports > 0);
+    CHECK(messages.size() - reports + dropped == numberMessages);
+
+    logger.removeSink(sink);
+    logger.setLevel(previousLevel);
+}
+
+TEST_CASE("Test_Logger_Disable_Async_While_Logging", "[support][logger]") {
+    auto& logger = Logger::getInstance();
+    auto previousLevel = logger.getLevel();
+    auto sink = std::make_shared<StringSink>();
+    logger.addSink(sink);
+    logger.setLevel(LogLevel::INFO);
+    logger.enableAsync(16);
+
+    // Producers keep logging across the switch back to synchronous mode; none
+    // may touch the released queue, and every message still reaches the sink.
+    const size_t numberThreads = 4;
+    const size_t messagesPerThread = 2000;
+    std::atomic<size_t> started{0};
+    std::vector<std::thread> threads;
+    for (size_t thread = 0; thread < numberThreads; ++thread) {
+        threads.emplace_back([&started]() {
+            started.fetch_add(1);
+            for (size_t index = 0; index < messagesPerThread; ++index) {
+                OM_INFO_M("TestLogger", "message " + std::to_string(index));
+            }
+        });
+    }
+    while (started.load() < numberThreads) {
+        std::this_thread::yield();
+    }
+    logger.disableAsync();
+    CHECK(!logger.isAsync());
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    logger.flush();
+    CHECK(count_lines(sink->getContents()) == numberThreads * messagesPerThread);
+
+    logger.removeSink(sink);
+    logger.setLevel(previousLevel);
+}
+
+TEST_CASE("Test_Logger_Macros_Skip_Disabled_Messages", "[support][logger]") {
+    auto& logger = Logger::getInstance();
+    auto previousLevel = logger.getLevel();
+    logger.setLevel(LogLevel::ERROR);
+
+    bool evaluated = false;
+    auto build_message = [&evaluated]() {
+        evaluated = true;
+        return std::string("never built");
+    };
+    OM_DEBUG(build_message());
+    OM_INFO_M("TestLogger", build_message());
+    logEntry(build_message, "TestLogger", 2);
+    CHECK(!evaluated);
+    CHECK(!log_entry_enabled(1));
+    CHECK(log_entry_enabled(0));
+    CHECK(!logger.isEnabled(LogLevel::WARNING));
+    CHECK(logger.isEnabled(LogLevel::CRITICAL));
+    CHECK(!logger.isEnabled(LogLevel::OFF));
+
+    logger.setLevel(previousLevel);
+}
@@ -0,0 +1,122 @@
+// =============================================================================
+// TestMagneticAdviserMemoryBudget.cpp
+// =============================================================================
+// MagneticAdviser::set_memory_budget and the candidate-pool memory it reports.
+//
+// FIXTURE
+//   Single-winding inductor, 100 uH, 600 Vpp sinusoidal @ 100 kHz, 25 C —
+//   the same fixture as TestMagneticAdviserPareto.cpp, known to wind several
+//   cores.
+// =============================================================================
+
+#include <string>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "advisers/AdviserResultCache.h"
+#include "advisers/MagneticAdviser.h"
+#include "constructive_models/Mas.h"
+#include "processors/Inputs.h"
+#include "support/Settings.h"
+
+#include "TestingUtils.h"
+
+using namespace MAS;
+using namespace OpenMagnetics;
+
+namespace {
+
+OpenMagnetics::Inputs make_inductor_inputs() {
+    return OpenMagnetics::Inputs::create_quick_operating_point(
+        100000, 10e-5, 25, WaveformLabel::SINUSOIDAL, 600, 0.5, 0, {});
+}
+
+} // namespace
+
+TEST_CASE("Test_MagneticAdviser_Memory_Budget", "[adviser][magnetic-adviser][heavy]") {
+    settings.reset();
+    auto inputs = make_inductor_inputs();
+
+    // Unbounded: the peak is measured and nothing is limited.
+    size_t unboundedPeak = 0;
+    {
+        MagneticAdviser adviser;
+        auto results = adviser.get_advised_magnetic(inputs, 3);
+        REQUIRE(!results.empty());
+        CHECK(!adviser.get_last_search_memory_limited());
+        unboundedPeak = adviser.get_last_search_peak_candidate_memory();
+        CHECK(unboundedPeak >= MagneticAdviser::estimate_candidate_memory(results[0].first));
+    }
+
+    // A budget below the unbounded peak prunes the pool to the best few (or
+    // stops the search) instead of failing, and still returns designs.
+    {
+        MagneticAdviser adviser;
+        adviser.set_memory_budget(unboundedPeak / 2);
+        std::vector<size_t> poolSizes;
+        adviser.set_progress_callback([&poolSizes](const AdviserProgress& progress) {
+            poolSizes.push_back(progress.candidateMemory);
+        });
+        auto results = adviser.get_advised_magnetic(inputs, 3);
+        CHECK(!results.empty());
+        CHECK(adviser.get_last_search_memory_limited());
+        CHECK(!adviser.get_last_search_truncated());
+        REQUIRE(!poolSizes.empty());
+        CHECK(poolSizes.back() > 0);
+        // Same cores and coils in the same order, only fewer kept at a time.
+        CHECK(adviser.get_last_search_peak_candidate_memory() <= unboundedPeak);
+    }
+    settings.reset();
+}
+
+TEST_CASE("Test_MagneticAdviser_Unrecorded_Scoring_Leaves_Scorings", "[adviser][magnetic-adviser][heavy]") {
+    settings.reset();
+    auto inputs = make_inductor_inputs();
+
+    // The pruning rank scores candidates that are then dropped: it must not
+    // leave them in what get_scorings() normalizes over.
+    MagneticAdviser adviser;
+    auto results = adviser.get_advised_magnetic(inputs, 3);
+    REQUIRE(!results.empty());
+    auto scorings = adviser.get_scorings();
+
+    std::vector<Mas> renamed;
+    for (auto& [mas, scoring] : results) {
+        auto copy = mas;
+        auto manufacturerInfo = copy.get_magnetic().get_manufacturer_info().value_or(MagneticManufacturerInfo());
+        manufacturerInfo.set_reference(copy.get_magnetic().get_reference() + " (dropped)");
+        copy.get_mutable_magnetic().set_manufacturer_info(manufacturerInfo);
+        renamed.push_back(copy);
+    }
+    auto ranked = adviser.score_magnetics(renamed, adviser._loadedFilterFlow, false);
+    CHECK(ranked.size() == renamed.size());
+    CHECK(adviser.get_scorings() == scorings);
+    settings.reset();
+}
+
+TEST_CASE("Test_MagneticAdviser_Memory_Budget_Peak_On_Cache_Hit", "[adviser][magnetic-adviser][adviser-result-cache][heavy]") {
+    settings.reset();
+    settings.set_adviser_result_cache_size(2);
+    auto& cache = AdviserResultCache::instance();
+    cache.clear();
+    auto inputs = make_inductor_inputs();
+
+    MagneticAdviser adviser;
+    auto searched = adviser.get_advised_magnetic(inputs, 3);
+    REQUIRE(!searched.empty());
+    REQUIRE(cache.size() == 1);
+
+    // The cached designs are what the call holds: their estimate, not 0.
+    auto cached = adviser.get_advised_magnetic(inputs, 3);
+    size_t cachedMemory = 0;
+    for (auto& [mas, scoring] : cached) {
+        cachedMemory += MagneticAdviser::estimate_candidate_memory(mas);
+    }
+    CHECK(cachedMemory > 0);
+    CHECK(adviser.get_last_search_peak_candidate_memory() == cachedMemory);
+    CHECK(!adviser.get_last_search_memory_limited());
+
+    cache.clear();
+    settings.reset();
+}
@@ -0,0 +1,179 @@
+// =============================================================================
+// TestMagneticAdviserPareto.cpp
+// =============================================================================
+// MagneticAdviser::get_pareto_front (NSGA-II) and rank_pareto_front.
+//
+// FIXTURE
+//   Single-winding inductor, 100 uH, 600 Vpp sinusoidal @ 100 kHz, 25 C —
+//   the first query of TestConcurrency.cpp, known to wind several cores.
+//   The search budget is kept small so the case stays in the [heavy] bucket
+//   rather than the benchmark one.
+// =============================================================================
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <map>
+#include <random>
+#include <set>
+#include <string>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "advisers/MagneticAdviser.h"
+#include "advisers/MagneticAdviserInternal.h"
+#include "constructive_models/Mas.h"
+#include "processors/Inputs.h"
+#include "support/Settings.h"
+
+#include "TestingUtils.h"
+
+using namespace MAS;
+using namespace OpenMagnetics;
+
+namespace {
+
+OpenMagnetics::Inputs make_inductor_inputs() {
+    return OpenMagnetics::Inputs::create_quick_operating_point(
+        100000, 10e-5, 25, WaveformLabel::SINUSOIDAL, 600, 0.5, 0, {});
+}
+
+ParetoSearchOptions small_search() {
+    ParetoSearchOptions options;
+    options.populationSize = 8;
+    options.numberGenerations = 3;
+    options.maximumNumberCores = 12;
+    options.coilsPerCore = 2;
+    return options;
+}
+
+// True when `a` is at least as good as `b` on every objective and strictly
+// better on one, using the same direction convention as the search.
+bool dominates(const ParetoCandidate& a, const ParetoCandidate& b, const std::vector<MagneticFilterOperation>& objectives) {
+    bool strictlyBetter = false;
+    for (auto& objective : objectives) {
+        double costA = a.objectives.at(objective.get_filter());
+        double costB = b.objectives.at(objective.get_filter());
+        if (!objective.get_invert()) {
+            costA = -costA;
+            costB = -costB;
+        }
+        if (costA > costB) {
+            return false;
+        }
+        if (costA < costB) {
+            strictlyBetter = true;
+        }
+    }
+    return strictlyBetter;
+}
+
+std::vector<std::string> references(std::vector<ParetoCandidate>& front) {
+    std::vector<std::string> result;
+    for (auto& candidate : front) {
+        result.push_back(candidate.mas.get_mutable_magnetic().get_reference());
+    }
+    return result;
+}
+
+} // namespace
+
+TEST_CASE("Test_MagneticAdviser_Pareto_Front_Non_Dominated", "[adviser][magnetic-adviser][pareto][heavy]") {
+    settings.reset();
+    auto inputs = make_inductor_inputs();
+    std::vector<MagneticFilterOperation> objectives{
+        MagneticFilterOperation(MagneticFilters::LOSSES, true, true, 1.0),
+        MagneticFilterOperation(MagneticFilters::DIMENSIONS, true, false, 1.0),
+    };
+
+    MagneticAdviser adviser;
+    auto front = adviser.get_pareto_front(inputs, objectives, small_search());
+
+    REQUIRE(!front.empty());
+    for (auto& candidate : front) {
+        CHECK(candidate.rank == 0);
+        REQUIRE(candidate.objectives.size() == objectives.size());
+        for (auto& [filter, value] : candidate.objectives) {
+            CHECK(std::isfinite(value));
+        }
+    }
+    for (size_t i = 0; i < front.size(); ++i) {
+        for (size_t j = 0; j < front.size(); ++j) {
+            if (i != j) {
+                CHECK(!dominates(front[i], front[j], objectives));
+            }
+        }
+    }
+    settings.reset();
+}
+
+TEST_CASE("Test_MagneticAdviser_Pareto_Front_Deterministic_Across_Threads", "[adviser][magnetic-adviser][pareto][concurrency][heavy]") {
+    settings.reset();
+    auto inputs = make_inductor_inputs();
+
+    settings.set_parallel_number_threads(1);
+    MagneticAdviser serialAdviser;
+    auto serialFront = serialAdviser.get_pareto_front(inputs, small_search());
+
+    settings.set_parallel_number_threads(4);
+    MagneticAdviser parallelAdviser;
+    auto parallelFront = parallelAdviser.get_pareto_front(inputs, small_search());
+
+    REQUIRE(!serialFront.empty());
+    CHECK(references(serialFront) == references(parallelFront));
+    settings.reset();
+}
+
+TEST_CASE("Test_MagneticAdviser_Pareto_Front_Reranking", "[adviser][magnetic-adviser][pareto][heavy]") {
+    settings.reset();
+    auto inputs = make_inductor_inputs();
+
+    MagneticAdviser adviser;
+    auto front = adviser.get_pareto_front(inputs, small_search());
+    REQUIRE(!front.empty());
+
+    // Only LOSSES weighted: the re-ranked winner must be the lowest-loss member.
+    std::vector<MagneticFilterOperation> lossesOnly{
+        MagneticFilterOperation(MagneticFilters::LOSSES, true, true, 1.0),
+        MagneticFilterOperation(MagneticFilters::COST, true, true, 0.0),
+        MagneticFilterOperation(MagneticFilters::DIMENSIONS, true, false, 0.0),
+    };
+    double minimumLosses = std::numeric_limits<double>::infinity();
+    for (auto& candidate : front) {
+        minimumLosses = std::min(minimumLosses, candidate.objectives.at(MagneticFilters::LOSSES));
+    }
+    auto ranked = MagneticAdviser::rank_pareto_front(front, lossesOnly, front.size());
+    REQUIRE(ranked.size() == front.size());
+    auto winnerReference = ranked[0].first.get_mutable_magnetic().get_reference();
+    bool winnerHasMinimumLosses = false;
+    for (auto& candidate : front) {
+        if (candidate.mas.get_mutable_magnetic().get_reference() == winnerReference) {
+            winnerHasMinimumLosses = candidate.objectives.at(MagneticFilters::LOSSES) == minimumLosses;
+        }
+    }
+    CHECK(winnerHasMinimumLosses);
+
+    // Truncation honours maximumNumberResults.
+    CHECK(MagneticAdviser::rank_pareto_front(front, lossesOnly, 1).size() == 1);
+    settings.reset();
+}
+
+TEST_CASE("Test_MagneticAdviser_Pareto_Crossover_Coil_Index_Within_Child_Pool", "[adviser][magnetic-adviser][pareto]") {
+    std::mt19937_64 generator(7);
+
+    // A donor rank that exists in the child core's pool is kept.
+    CHECK(resolve_child_coil_index(1, 3, generator) == 1);
+    CHECK(resolve_child_coil_index(0, 1, generator) == 0);
+
+    // A donor wound with 4 variants crossed onto a core with only 2: every
+    // draw lands in the child's pool, and both of its variants are reachable.
+    std::set<size_t> drawn;
+    for (size_t draw = 0; draw < 64; ++draw) {
+        auto coilIndex = resolve_child_coil_index(3, 2, generator);
+        REQUIRE(coilIndex < 2);
+        drawn.insert(coilIndex);
+    }
+    CHECK(drawn.size() == 2);
+    CHECK(resolve_child_coil_index(5, 1, generator) == 0);
+}
@@ -1,6 +1,7 @@
 #include <source_location>
 #include "support/Painter.h"
 #include "physical_models/MagneticField.h"
+#include "support/CoilMesher.h"
 #include "json.hpp"
 #include "TestingUtils.h"
 #include "Models.h"
@@ -581,4 +582,63 @@ namespace {
         settings.reset();
     }
 
+    TEST_CASE("Test_Coil_Mesh_Cache_Reused_Across_Operating_Points", "[physical-model][magnetic-field][coil-mesher]") {
+        settings.reset();
+        numberTurns = {12, 6};
+        numberParallels = {1, 1};
+        turnsRatios = {2};
+        interleavingLevel = 1;
+        frequency = 125000;
+        setup();
+
+        OpenMagnetics::Magnetic magnetic;
+        magnetic.set_core(core);
+        magnetic.set_coil(coil);
+        auto cachedMagnetic = magnetic;
+        auto cache = std::make_shared<CoilMeshCache>();
+        cachedMagnetic.set_coil_mesh_cache(cache);
+
+        auto lowCurrent = OpenMagnetics::Inputs::create_quick_operating_point(frequency, 0.001, 25, WaveformLabel::TRIANGULAR, voltagePeakToPeak, 0.5, 0, turnsRatios).get_operating_point(0);
+        auto highCurrent = OpenMagnetics::Inputs::create_quick_operating_point(frequency, 0.001, 25, WaveformLabel::TRIANGULAR, 3 * voltagePeakToPeak, 0.5, 0, turnsRatios).get_operating_point(0);
+
+        CoilMesher coilMesher;
+        for (auto& operatingPoint : {lowCurrent, highCurrent}) {
+            auto uncached = coilMesher.generate_mesh_inducing_coil(magnetic, operatingPoint);
+            auto cached = coilMesher.generate_mesh_inducing_coil(cachedMagnetic, operatingPoint);
+            REQUIRE(cached.size() == uncached.size());
+            for (size_t harmonicIndex = 0; harmonicIndex < cached.size(); ++harmonicIndex) {
+                REQUIRE(cached[harmonicIndex].get_data().size() == uncached[harmonicIndex].get_data().size());
+                for (size_t pointIndex = 0; pointIndex < cached[harmonicIndex].get_data().size(); ++pointIndex) {
+                    CHECK(cached[harmonicIndex].get_data()[pointIndex].get_point() == uncached[harmonicIndex].get_data()[pointIndex].get_point());
+                    CHECK(cached[harmonicIndex].get_data()[pointIndex].get_value() == uncached[harmonicIndex].get_data()[pointIndex].get_value());
+                }
+            }
+            coilMesher.generate_mesh_induced_coil(cachedMagnetic, operatingPoint);
+        }
+        // One inducing and one induced geometry, shared by both operating points.
+        CHECK(cache->size() == 2);
+
+        // Moving the turns is a different geometry, never a stale hit.
+        auto turns = cachedMagnetic.get_coil().get_turns_description().value();
+        for (auto& turn : turns) {
+            turn.set_coordinates({turn.get_coordinates()[0] + 1e-4, turn.get_coordinates()[1]});
+        }
+        cachedMagnetic.get_mutable_coil().set_turns_description(turns);
+        auto moved = coilMesher.generate_mesh_induced_coil(cachedMagnetic, lowCurrent);
+        CHECK(cache->size() == 3);
+        CHECK(moved[0].get_data()[0].get_point()[0] != coilMesher.generate_mesh_induced_coil(magnetic, lowCurrent)[0].get_data()[0].get_point()[0]);
+
+        // So are a different turn cross-section and a different stack count.
+        for (auto& turn : turns) {
+            turn.set_cross_sectional_shape(TurnCrossSectionalShape::RECTANGULAR);
+        }
+        cachedMagnetic.get_mutable_coil().set_turns_description(turns);
+        coilMesher.generate_mesh_induced_coil(cachedMagnetic, lowCurrent);
+        CHECK(cache->size() == 4);
+        cachedMagnetic.get_mutable_core().set_number_stacks(2);
+        coilMesher.generate_mesh_induced_coil(cachedMagnetic, lowCurrent);
+        CHECK(cache->size() == 5);
+        settings.reset();
+    }
+
 }  // namespace
@@ -1493,6 +1493,80 @@ namespace {
         REQUIRE_THROWS(simulator.build_datasheet(mas));
     }
 
+    TEST_CASE("Test_Simulator_Thermal_Coupling", "[processor][magnetic-simulator][temperature]") {
+        auto path = get_examples_dir() / "01_simple_inductor_etd34_n87.json";
+        auto mas = OpenMagneticsTesting::mas_loader(path.string());
+        auto magnetic = OpenMagnetics::magnetic_autocomplete(mas.get_magnetic());
+        auto inputs = OpenMagnetics::inputs_autocomplete(mas.get_inputs(), magnetic);
+
+        settings.reset();
+        MagneticSimulator simulator;
+        auto ambientMas = simulator.simulate(inputs, magnetic);
+
+        settings.set_magnetic_simulator_thermal_coupling(true);
+        settings.set_magnetic_simulator_thermal_coupling_tolerance(0.1);
+        auto coupledMas = simulator.simulate(inputs, magnetic);
+        settings.reset();
+
+        check_simulation_outputs_sane(coupledMas);
+        for (size_t opIdx = 0; opIdx < coupledMas.get_outputs().size(); ++opIdx) {
+            INFO("Operating point " << opIdx);
+            auto ambientTemperature = inputs.get_operating_points()[opIdx].get_conditions().get_ambient_temperature();
+            auto& ambientOutput = ambientMas.get_outputs()[opIdx];
+            auto& coupledOutput = coupledMas.get_outputs()[opIdx];
+
+            // Copper resistivity only grows with temperature, so a self-heated
+            // winding dissipates more than the same winding at ambient.
+            CHECK(coupledOutput.get_winding_losses()->get_winding_losses() > ambientOutput.get_winding_losses()->get_winding_losses());
+            // Both runs report the hottest core node; with the winding's heat
+            // in the network the coupled core runs hotter than the core alone.
+            CHECK(coupledOutput.get_core_losses()->get_temperature().value() > ambientOutput.get_core_losses()->get_temperature().value());
+            // The caller's conditions are restored after the loop.
+            CHECK(coupledMas.get_inputs().get_operating_points()[opIdx].get_conditions().get_ambient_temperature() == ambientTemperature);
+        }
+    }
+
+    TEST_CASE("Test_Simulator_Parallel_Operating_Points_Match_Serial", "[processor][magnetic-simulator][concurrency]") {
+        auto path = get_examples_dir() / "01_simple_inductor_etd34_n87.json";
+        auto mas = OpenMagneticsTesting::mas_loader(path.string());
+        auto magnetic = OpenMagnetics::magnetic_autocomplete(mas.get_magnetic());
+        auto inputs = OpenMagnetics::inputs_autocomplete(mas.get_inputs(), magnetic);
+
+        // Line/load corners: the same excitation at several ambients.
+        auto baseOperatingPoint = inputs.get_operating_points()[0];
+        std::vector<OperatingPoint> operatingPoints;
+        for (double ambientTemperature : {25.0, 50.0, 75.0, 100.0, 125.0}) {
+            auto operatingPoint = baseOperatingPoint;
+            operatingPoint.get_mutable_conditions().set_ambient_temperature(ambientTemperature);
+            operatingPoints.push_back(operatingPoint);
+        }
+        inputs.set_operating_points(operatingPoints);
+
+        settings.reset();
+        settings.set_parallel_number_threads(1);
+        MagneticSimulator serialSimulator;
+        auto serialMas = serialSimulator.simulate(inputs, magnetic);
+
+        settings.set_parallel_number_threads(4);
+        MagneticSimulator parallelSimulator;
+        auto parallelMas = parallelSimulator.simulate(inputs, magnetic);
+        settings.reset();
+
+        check_simulation_outputs_sane(parallelMas);
+        REQUIRE(parallelMas.get_outputs().size() == operatingPoints.size());
+        for (size_t opIdx = 0; opIdx < operatingPoints.size(); ++opIdx) {
+            INFO("Operating point " << opIdx);
+            auto& serialOutput = serialMas.get_outputs()[opIdx];
+            auto& parallelOutput = parallelMas.get_outputs()[opIdx];
+            CHECK(parallelMas.get_inputs().get_operating_points()[opIdx].get_conditions().get_ambient_temperature() ==
+                  operatingPoints[opIdx].get_conditions().get_ambient_temperature());
+            CHECK(parallelOutput.get_core_losses()->get_core_losses() == serialOutput.get_core_losses()->get_core_losses());
+            CHECK(parallelOutput.get_winding_losses()->get_winding_losses() == serialOutput.get_winding_losses()->get_winding_losses());
+            CHECK(resolve_dimensional_values(parallelOutput.get_inductance()->get_magnetizing_inductance().get_magnetizing_inductance()) ==
+                  resolve_dimensional_values(serialOutput.get_inductance()->get_magnetizing_inductance().get_magnetizing_inductance()));
+        }
+    }
+
 }
 
 // ABT #366/#362/#357: the FULL simulate path over all four new families. Individual models were
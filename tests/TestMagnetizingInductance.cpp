@@ -1774,3 +1774,159 @@ TEST_CASE("Test_ABT635_Gapping_From_Inductance_Without_ProcessedDescription",
 
     settings.reset();
 }
+
+TEST_CASE("Test_NumberTurns_Warm_Start_From_Neighbour", "[physical-model][magnetizing-inductance]") {
+    // Biased powder core (the Test_NumberTurns_Powder fixture): the unbiased
+    // seed is far from the answer, so a cold search needs several Newton
+    // steps. Seeded from the solution for a neighbouring target, the search
+    // must land on the same turns with fewer operating-point solves.
+    settings.reset();
+    clear_databases();
+
+    double dcCurrent = 96;
+    double ambientTemperature = 25;
+    double frequency = 68000;
+    std::string coreShape = "E 42/21/15";
+    std::string coreMaterial = "Edge 60";
+    auto gapping = OpenMagneticsTesting::get_residual_gap();
+
+    Core core;
+    OpenMagnetics::Coil winding;
+    OpenMagnetics::Inputs neighbourInputs;
+    OpenMagnetics::Inputs inputs;
+    MagnetizingInductance magnetizing_inductance("ZHANG");
+
+    prepare_test_parameters(dcCurrent, ambientTemperature, frequency, -1, 15.7e-6, gapping,
+                            coreShape, coreMaterial, core, winding, neighbourInputs);
+    prepare_test_parameters(dcCurrent, ambientTemperature, frequency, -1, 18e-6, gapping,
+                            coreShape, coreMaterial, core, winding, inputs);
+
+    MagnetizingInductanceSolverState warmState;
+    magnetizing_inductance.calculate_number_turns_from_gapping_and_inductance(core, winding, &neighbourInputs, DimensionalValues::NOMINAL, &warmState);
+    REQUIRE(warmState.numberTurns);
+    REQUIRE(warmState.magnetizingInductance);
+
+    MagnetizingInductanceSolverState coldState;
+    int coldNumberTurns = magnetizing_inductance.calculate_number_turns_from_gapping_and_inductance(core, winding, &inputs, DimensionalValues::NOMINAL, &coldState);
+    int warmNumberTurns = magnetizing_inductance.calculate_number_turns_from_gapping_and_inductance(core, winding, &inputs, DimensionalValues::NOMINAL, &warmState);
+
+    REQUIRE(warmNumberTurns == coldNumberTurns);
+    REQUIRE(warmState.numberTurns.value() == coldNumberTurns);
+    CHECK(warmState.numberInductanceEvaluations < coldState.numberInductanceEvaluations);
+    settings.reset();
+}
+
+TEST_CASE("Test_Gapping_Warm_Start_From_Neighbour", "[physical-model][magnetizing-inductance]") {
+    // The re-gap sweep of the core adviser: same core and target, N then N+1.
+    // The warm search starts at the previous gap instead of the residual one.
+    settings.reset();
+    clear_databases();
+
+    double dcCurrent = 0;
+    double ambientTemperature = 25;
+    double desiredMagnetizingInductance = 23.3e-3;
+    double frequency = 20000;
+    std::string coreShape = "ETD 29";
+    std::string coreMaterial = "3C97";
+
+    Core core;
+    OpenMagnetics::Coil winding;
+    OpenMagnetics::Inputs inputs;
+    MagnetizingInductance magnetizing_inductance("ZHANG");
+
+    prepare_test_parameters(dcCurrent, ambientTemperature, frequency, 666, desiredMagnetizingInductance, {},
+                            coreShape, coreMaterial, core, winding, inputs);
+
+    MagnetizingInductanceSolverState warmState;
+    magnetizing_inductance.calculate_gapping_from_number_turns_and_inductance(core, winding, &inputs, GappingType::GROUND, 4, &warmState);
+    REQUIRE(warmState.gapLength);
+
+    winding.get_mutable_functional_description()[0].set_number_turns(700);
+    MagnetizingInductanceSolverState coldState;
+    auto coldGapping = magnetizing_inductance.calculate_gapping_from_number_turns_and_inductance(core, winding, &inputs, GappingType::GROUND, 4, &coldState);
+    auto warmGapping = magnetizing_inductance.calculate_gapping_from_number_turns_and_inductance(core, winding, &inputs, GappingType::GROUND, 4, &warmState);
+
+    // Both searches stop inside the same 0.1% reluctance band; the reported
+    // gaps are that point rounded to 0.1 mm.
+    REQUIRE(coldGapping.size() == warmGapping.size());
+    REQUIRE_THAT(warmState.gapLength.value(), Catch::Matchers::WithinRel(coldState.gapLength.value(), 0.01));
+    REQUIRE_THAT(warmGapping[0].get_length(), Catch::Matchers::WithinAbs(coldGapping[0].get_length(), 1e-4 + 1e-12));
+    CHECK(warmState.numberReluctanceEvaluations < coldState.numberReluctanceEvaluations);
+    settings.reset();
+}
+
+TEST_CASE("Test_Gapping_Timed_Out_Search_Does_Not_Seed", "[physical-model][magnetizing-inductance]") {
+    // No gap reaches an inductance far above the ungapped one: the search
+    // times out at the residual gap and must not hand that point on as a
+    // converged seed.
+    settings.reset();
+    clear_databases();
+
+    double dcCurrent = 0;
+    double ambientTemperature = 25;
+    double frequency = 20000;
+    std::string coreShape = "ETD 29";
+    std::string coreMaterial = "3C97";
+
+    Core core;
+    OpenMagnetics::Coil winding;
+    OpenMagnetics::Inputs reachableInputs;
+    OpenMagnetics::Inputs unreachableInputs;
+    MagnetizingInductance magnetizing_inductance("ZHANG");
+
+    prepare_test_parameters(dcCurrent, ambientTemperature, frequency, 666, 23.3e-3, {},
+                            coreShape, coreMaterial, core, winding, reachableInputs);
+    prepare_test_parameters(dcCurrent, ambientTemperature, frequency, 666, 100, {},
+                            coreShape, coreMaterial, core, winding, unreachableInputs);
+
+    MagnetizingInductanceSolverState solverState;
+    magnetizing_inductance.calculate_gapping_from_number_turns_and_inductance(core, winding, &reachableInputs, GappingType::GROUND, 4, &solverState);
+    REQUIRE(solverState.gapLength);
+
+    magnetizing_inductance.calculate_gapping_from_number_turns_and_inductance(core, winding, &unreachableInputs, GappingType::GROUND, 4, &solverState);
+    CHECK(!solverState.gapLength);
+    settings.reset();
+}
+
+TEST_CASE("Test_Inductance_Memo_Hit_Restores_Operating_Point", "[physical-model][magnetizing-inductance]") {
+    settings.reset();
+    clear_databases();
+    settings.set_magnetizing_inductance_memo_size(8);
+    MagnetizingInductance::clear_memo();
+
+    Core core;
+    OpenMagnetics::Coil winding;
+    OpenMagnetics::Inputs inputs;
+    MagnetizingInductance magnetizingInductanceModel("ZHANG");
+    prepare_test_parameters(0, 25, 20000, 666, -1, OpenMagneticsTesting::get_ground_gap(0.003), "ETD 29",
+                            "3C97", core, winding, inputs);
+
+    auto solvedOperatingPoint = inputs.get_operating_point(0);
+    auto solved = magnetizingInductanceModel.calculate_inductance_and_magnetic_flux_density(core, winding, &solvedOperatingPoint);
+    REQUIRE(MagnetizingInductance::get_memo_size() == 1);
+
+    auto memoisedOperatingPoint = inputs.get_operating_point(0);
+    auto memoised = magnetizingInductanceModel.calculate_inductance_and_magnetic_flux_density(core, winding, &memoisedOperatingPoint);
+    CHECK(MagnetizingInductance::get_memo_size() == 1);
+    CHECK(memoised.first.get_magnetizing_inductance().get_nominal().value() == solved.first.get_magnetizing_inductance().get_nominal().value());
+    CHECK(memoised.second.get_waveform()->get_data() == solved.second.get_waveform()->get_data());
+    REQUIRE(memoisedOperatingPoint.get_excitations_per_winding()[0].get_voltage());
+    CHECK(memoisedOperatingPoint.get_excitations_per_winding()[0].get_voltage()->get_waveform()->get_data() ==
+          solvedOperatingPoint.get_excitations_per_winding()[0].get_voltage()->get_waveform()->get_data());
+
+    // Without the memo the same solve gives the same answer.
+    settings.set_magnetizing_inductance_memo_size(0);
+    auto uncachedOperatingPoint = inputs.get_operating_point(0);
+    auto uncached = magnetizingInductanceModel.calculate_inductance_and_magnetic_flux_density(core, winding, &uncachedOperatingPoint);
+    CHECK(uncached.first.get_magnetizing_inductance().get_nominal().value() == solved.first.get_magnetizing_inductance().get_nominal().value());
+
+    // A different turn count is a different key.
+    settings.set_magnetizing_inductance_memo_size(8);
+    winding.get_mutable_functional_description()[0].set_number_turns(600);
+    auto otherOperatingPoint = inputs.get_operating_point(0);
+    magnetizingInductanceModel.calculate_inductance_and_magnetic_flux_density(core, winding, &otherOperatingPoint);
+    CHECK(MagnetizingInductance::get_memo_size() == 2);
+
+    MagnetizingInductance::clear_memo();
+    settings.reset();
+}
@@ -9,6 +9,7 @@
 #include <source_location>
 #include <catch2/catch_test_macros.hpp>
 #include <catch2/matchers/catch_matchers_floating_point.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
 
 #include <fstream>
 #include <string>
@@ -16,6 +17,9 @@
 #include <filesystem>
 #include <iostream>
 #include <chrono>
+#include <map>
+#include <regex>
+#include <set>
 #include <thread>
 
 using namespace MAS;
@@ -5026,4 +5030,139 @@ namespace {
         REQUIRE(std::filesystem::exists(outFile));
         settings.reset();
     }
+
+    // Litz strands (like field cells) are streamed as text and spliced in at
+    // export: no placeholder may survive, and the strands must be there.
+    TEST_CASE("Test_Painter_Streamed_Elements_Spliced", "[support][painter][magnetic-painter][smoke-test]") {
+        settings.set_painter_simple_litz(false);
+        settings.set_painter_advanced_litz(false);
+        auto wire = find_wire_by_name("Litz TXXL07/28FXXX-2(MWXX)");
+        auto coil = OpenMagneticsTesting::get_quick_coil({4}, {1}, "PQ 26/25", 1, WindingOrientation::CONTIGUOUS, WindingOrientation::OVERLAPPING, CoilAlignment::INNER_OR_TOP, CoilAlignment::CENTERED, {wire});
+        auto core = OpenMagneticsTesting::get_quick_core("PQ 26/25", OpenMagneticsTesting::get_ground_gap(0.001), 1, "3C97");
+        OpenMagnetics::Magnetic magnetic;
+        magnetic.set_core(core);
+        magnetic.set_coil(coil);
+
+        auto outFile = outputFilePath;
+        outFile.append("Test_Painter_Streamed_Elements_Spliced.svg");
+        std::filesystem::remove(outFile);
+        Painter painter(outFile);
+        painter.paint_core(magnetic);
+        painter.paint_coil_turns(magnetic);
+        auto svg = painter.export_svg();
+
+        CHECK(svg.find("streamed-block-") == std::string::npos);
+        CHECK(svg.find("<circle cx=") != std::string::npos);
+        // Exporting twice gives the same document.
+        CHECK(painter.export_svg() == svg);
+        settings.reset();
+    }
+
+    TEST_CASE("Test_Painter_Field_Grid_Tiled_Matches_Serial", "[support][painter][magnetic-field-painter][electric-field-painter][smoke-test]") {
+        OpenMagneticsTesting::PainterTestConfig config;
+        auto [magnetic, inputs] = OpenMagneticsTesting::prepare_painter_test(config);
+        auto operatingPoint = inputs.get_operating_point(0);
+
+        auto paint_fields = [&](size_t numberThreads, std::string fileName) {
+            settings.set_painter_number_points_x(20);
+            settings.set_painter_number_points_y(40);
+            settings.set_parallel_number_threads(numberThreads);
+            auto outFile = outputFilePath;
+            outFile.append(fileName);
+            std::filesystem::remove(outFile);
+            Painter painter(outFile);
+            painter.paint_magnetic_field(operatingPoint, magnetic);
+            painter.paint_electric_field(operatingPoint, magnetic, 1, std::nullopt, ElectricFieldVisualizationModel::SDF_PHYSICS);
+            auto svg = painter.export_svg();
+            settings.reset();
+            return svg;
+        };
+
+        // CSS class names are random per painter: rename them by order of first
+        // appearance so that only the painted content is compared.
+        auto normalize_class_names = [](const std::string& svg) {
+            std::set<std::string> classNames;
+            std::regex classAttribute("class=\"([A-Za-z]+)\"");
+            for (auto match = std::sregex_iterator(svg.begin(), svg.end(), classAttribute); match != std::sregex_iterator(); ++match) {
+                classNames.insert((*match)[1].str());
+            }
+            std::map<std::string, std::string> renamedClassNames;
+            std::string normalized;
+            size_t position = 0;
+            while (position < svg.size()) {
+                if (!std::isalpha(static_cast<unsigned char>(svg[position]))) {
+                    normalized += svg[position++];
+                    continue;
+                }
+                size_t end = position;
+                while (end < svg.size() && std::isalpha(static_cast<unsigned char>(svg[end]))) {
+                    end++;
+                }
+                std::string word = svg.substr(position, end - position);
+                if (classNames.contains(word)) {
+                    auto [renamed, inserted] = renamedClassNames.emplace(word, "class" + std::to_string(renamedClassNames.size()));
+                    word = renamed->second;
+                }
+                normalized += word;
+                position = end;
+            }
+            return normalized;
+        };
+
+        auto serialSvg = normalize_class_names(paint_fields(1, "Test_Painter_Field_Grid_Tiled_Matches_Serial_Serial.svg"));
+        auto tiledSvg = normalize_class_names(paint_fields(4, "Test_Painter_Field_Grid_Tiled_Matches_Serial_Tiled.svg"));
+        REQUIRE(serialSvg.find("class0") != std::string::npos);
+        CHECK(tiledSvg == serialSvg);
+
+        // Progressive mode hands over one coarse preview per field and leaves
+        // the final image untouched.
+        auto outFile = outputFilePath;
+        outFile.append("Test_Painter_Field_Grid_Tiled_Matches_Serial_Progressive.svg");
+        std::filesystem::remove(outFile);
+        Painter painter(outFile);
+        std::vector<std::string> previews;
+        painter.set_progress_callback([&](const std::string& previewSvg) {
+            previews.push_back(previewSvg);
+        });
+        settings.set_painter_number_points_x(20);
+        settings.set_painter_number_points_y(40);
+        painter.paint_magnetic_field(operatingPoint, magnetic);
+        painter.paint_electric_field(operatingPoint, magnetic, 1, std::nullopt, ElectricFieldVisualizationModel::SDF_PHYSICS);
+        CHECK(normalize_class_names(painter.export_svg()) == serialSvg);
+        REQUIRE(previews.size() == 2);
+        CHECK(previews[0].size() < serialSvg.size());
+        CHECK(settings.get_painter_number_points_x() == 20);
+        settings.reset();
+    }
+
+    TEST_CASE("Benchmark_Painter_Representative_Magnetics", "[support][painter][!benchmark]") {
+        OpenMagneticsTesting::PainterTestConfig config;
+        auto [fieldMagnetic, inputs] = OpenMagneticsTesting::prepare_painter_test(config);
+
+        settings.set_painter_simple_litz(false);
+        auto wire = find_wire_by_name("Litz TXXL07/28FXXX-2(MWXX)");
+        auto coil = OpenMagneticsTesting::get_quick_coil({40}, {1}, "PQ 40/40", 1, WindingOrientation::OVERLAPPING, WindingOrientation::OVERLAPPING, CoilAlignment::INNER_OR_TOP, CoilAlignment::CENTERED, {wire});
+        auto core = OpenMagneticsTesting::get_quick_core("PQ 40/40", OpenMagneticsTesting::get_ground_gap(0.001), 1, "3C97");
+        OpenMagnetics::Magnetic litzMagnetic;
+        litzMagnetic.set_core(core);
+        litzMagnetic.set_coil(coil);
+
+        auto outFile = outputFilePath;
+        outFile.append("Benchmark_Painter_Representative_Magnetics.svg");
+
+        BENCHMARK("Magnetic field plot with turns") {
+            Painter painter(outFile);
+            painter.paint_magnetic_field(inputs.get_operating_point(0), fieldMagnetic);
+            painter.paint_core(fieldMagnetic);
+            painter.paint_coil_turns(fieldMagnetic);
+            return painter.export_svg().size();
+        };
+        BENCHMARK("Litz-heavy coil") {
+            Painter painter(outFile);
+            painter.paint_core(litzMagnetic);
+            painter.paint_coil_turns(litzMagnetic);
+            return painter.export_svg().size();
+        };
+        settings.reset();
+    }
 }  // namespace
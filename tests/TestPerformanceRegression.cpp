@@ -0,0 +1,286 @@
+// =============================================================================
+// TestPerformanceRegression.cpp
+// =============================================================================
+// Performance regression gate for the expensive entry points: Coil::wind,
+// WindingLosses, Temperature, MagneticSimulator, CoilAdviser and
+// MagneticAdviser, each run on a fixed, offline input.
+//
+// WHAT IS MEASURED
+//   * Work counters (support/WorkCounters.h): wind() calls, field, winding-
+//     and core-loss evaluations, thermal solves. They are exact and machine
+//     independent, so they are always gated.
+//   * Wall time, normalised by a fixed calibration workload timed in the same
+//     process, so the stored figure is "this many calibration units" rather
+//     than seconds. Still noisier than the counters: only gated when
+//     MKF_PERFORMANCE_TIMINGS=1 (e.g. on the reference benchmark runner).
+//
+// Each scenario runs once to warm the memo caches and is then measured, so
+// the figures do not depend on which tests ran earlier in the process. Runs
+// are serial (parallel_number_threads = 1) for stable timings; the counters
+// would be the same with any thread count.
+//
+// BASELINES
+//   testData/performance_baselines.json. A measurement fails when it exceeds
+//   its baseline by more than counterTolerance / timingTolerance (relative).
+//   A scenario with no recorded baseline is reported and not gated.
+//
+// REGENERATING BASELINES
+//   Run with MKF_PERFORMANCE_RECORD=1 (serially: each scenario rewrites the
+//   file) on the reference machine and commit the updated JSON. Also copy
+//   the BASELINE lines from stderr, which carry the same data.
+// =============================================================================
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <fstream>
+#include <functional>
+#include <limits>
+#include <random>
+#include <source_location>
+#include <string>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "advisers/CoilAdviser.h"
+#include "advisers/MagneticAdviser.h"
+#include "constructive_models/Mas.h"
+#include "physical_models/Temperature.h"
+#include "physical_models/WindingLosses.h"
+#include "processors/Inputs.h"
+#include "processors/MagneticSimulator.h"
+#include "support/Settings.h"
+#include "support/WorkCounters.h"
+
+#include "TestingUtils.h"
+
+using namespace MAS;
+using namespace OpenMagnetics;
+
+namespace {
+
+const std::vector<WorkCounter> gatedCounters = {
+    WorkCounter::COIL_WIND,
+    WorkCounter::MAGNETIC_FIELD_EVALUATION,
+    WorkCounter::WINDING_LOSSES_EVALUATION,
+    WorkCounter::CORE_LOSSES_EVALUATION,
+    WorkCounter::TEMPERATURE_SOLVE,
+};
+
+bool environment_flag(const char* name) {
+    const char* value = std::getenv(name);
+    return value != nullptr && std::string(value) == "1";
+}
+
+std::filesystem::path get_baselines_path() {
+    return OpenMagneticsTesting::get_test_data_path(std::source_location::current(), "performance_baselines.json");
+}
+
+json load_baselines() {
+    std::ifstream file(get_baselines_path());
+    REQUIRE(file.good());
+    return json::parse(file);
+}
+
+double time_seconds(const std::function<void()>& work) {
+    auto start = std::chrono::steady_clock::now();
+    work();
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+// Fixed CPU work (a seeded sort) that scenario times are divided by; best of
+// five to keep scheduler noise out of the unit.
+double get_calibration_seconds() {
+    double best = std::numeric_limits<double>::infinity();
+    for (size_t run = 0; run < 5; ++run) {
+        std::mt19937_64 generator(42);
+        std::uniform_real_distribution<double> distribution(0.0, 1.0);
+        std::vector<double> values(1 << 20);
+        for (auto& value : values) {
+            value = distribution(generator);
+        }
+        best = std::min(best, time_seconds([&values]() { std::sort(values.begin(), values.end()); }));
+    }
+    return best;
+}
+
+struct Measurement {
+    json counters = json::object();
+    double normalizedTime = 0;
+};
+
+Measurement measure(const std::function<void()>& scenario, size_t timedRuns) {
+    settings.reset();
+    settings.set_parallel_number_threads(1);
+    scenario();
+
+    Measurement measurement;
+    reset_work_counters();
+    double best = time_seconds(scenario);
+    for (auto counter : gatedCounters) {
+        measurement.counters[to_string(counter)] = get_work_count(counter);
+    }
+    for (size_t run = 1; run < timedRuns; ++run) {
+        best = std::min(best, time_seconds(scenario));
+    }
+    measurement.normalizedTime = best / get_calibration_seconds();
+    settings.reset();
+    return measurement;
+}
+
+void check_against_baseline(const std::string& scenarioName, const Measurement& measurement) {
+    json entry = {{"counters", measurement.counters}, {"normalizedTime", measurement.normalizedTime}};
+    WARN("BASELINE " << scenarioName << " " << entry.dump());
+
+    auto baselines = load_baselines();
+    if (environment_flag("MKF_PERFORMANCE_RECORD")) {
+        baselines["scenarios"][scenarioName] = entry;
+        std::ofstream file(get_baselines_path());
+        file << baselines.dump(4) << std::endl;
+        return;
+    }
+
+    auto& baseline = baselines["scenarios"][scenarioName];
+    if (!baseline.contains("counters") || baseline["counters"].empty()) {
+        WARN("No baseline recorded for " << scenarioName << "; not gated");
+        return;
+    }
+
+    double counterTolerance = baselines.at("counterTolerance").get<double>();
+    for (auto& [counterName, recorded] : baseline["counters"].items()) {
+        INFO(scenarioName << ": " << counterName << " was " << recorded << ", now " << measurement.counters.value(counterName, uint64_t(0)));
+        CHECK(measurement.counters.value(counterName, uint64_t(0)) <= recorded.get<double>() * (1 + counterTolerance));
+    }
+
+    if (environment_flag("MKF_PERFORMANCE_TIMINGS") && baseline["normalizedTime"].is_number()) {
+        double timingTolerance = baselines.at("timingTolerance").get<double>();
+        double recorded = baseline["normalizedTime"].get<double>();
+        INFO(scenarioName << ": normalized time was " << recorded << ", now " << measurement.normalizedTime);
+        CHECK(measurement.normalizedTime <= recorded * (1 + timingTolerance));
+    }
+}
+
+// --- Fixed corpus -----------------------------------------------------------
+
+// Wound once here: get_quick_magnetic() drops the turns, and the loss,
+// thermal and simulator scenarios must not count that wind.
+OpenMagnetics::Magnetic make_two_winding_magnetic() {
+    auto gapping = OpenMagneticsTesting::get_ground_gap(0.001);
+    auto magnetic = OpenMagneticsTesting::get_quick_magnetic("ETD 39", gapping, {40, 10}, 1, "3C97");
+    auto coil = magnetic.get_coil();
+    coil.wind();
+    magnetic.set_coil(coil);
+    return magnetic;
+}
+
+OpenMagnetics::Inputs make_two_winding_inputs() {
+    return OpenMagnetics::Inputs::create_quick_operating_point_only_current(
+        /*frequency*/     100000,
+        /*magInductance*/ 100e-6,
+        /*temperature*/   25,
+        /*waveShape*/     WaveformLabel::TRIANGULAR,
+        /*peakToPeak*/    4,
+        /*dutyCycle*/     0.5,
+        /*dcCurrent*/     0,
+        /*turnsRatios*/   {4});
+}
+
+// Same flyback fixture as TestCoilAdviserCharacterisation.cpp.
+OpenMagnetics::Mas make_flyback_fixture() {
+    auto gapping = OpenMagneticsTesting::get_ground_gap(0.003);
+    auto magnetic = OpenMagneticsTesting::get_quick_magnetic("ETD 59", gapping, {82, 5}, 1, "3C91");
+    auto inputs = OpenMagnetics::Inputs::create_quick_operating_point_only_current(
+        175590, 10e-6, 25, WaveformLabel::SINUSOIDAL, 20, 0.5, 0, {82.0 / 5});
+
+    DimensionWithTolerance altitude;
+    altitude.set_maximum(2000);
+    DimensionWithTolerance mainSupplyVoltage;
+    mainSupplyVoltage.set_nominal(400);
+    auto standards = std::vector<InsulationStandards>{InsulationStandards::IEC_606641, InsulationStandards::IEC_623681};
+    auto insulationRequirements = OpenMagneticsTesting::get_quick_insulation_requirements(
+        altitude, Cti::GROUP_I, IsolationClass::BASIC, mainSupplyVoltage, OvervoltageCategory::IV, PollutionDegree::PD1, standards);
+    inputs.get_mutable_design_requirements().set_insulation(insulationRequirements);
+
+    OpenMagnetics::Mas mas;
+    inputs.process();
+    mas.set_inputs(inputs);
+    mas.set_magnetic(magnetic);
+    return mas;
+}
+
+} // namespace
+
+TEST_CASE("Test_Performance_Coil_Wind", "[performance][heavy]") {
+    auto magnetic = make_two_winding_magnetic();
+    auto measurement = measure([&magnetic]() {
+        for (size_t repetition = 0; repetition < 20; ++repetition) {
+            auto coil = magnetic.get_coil();
+            coil.wind();
+        }
+    }, 3);
+    CHECK(measurement.counters[to_string(WorkCounter::COIL_WIND)].get<uint64_t>() >= 20);
+    check_against_baseline("coil_wind", measurement);
+}
+
+TEST_CASE("Test_Performance_Winding_Losses", "[performance][heavy]") {
+    auto magnetic = make_two_winding_magnetic();
+    auto inputs = make_two_winding_inputs();
+    auto operatingPoint = inputs.get_operating_point(0);
+    auto measurement = measure([&magnetic, &operatingPoint]() {
+        WindingLosses windingLosses;
+        for (double temperature : {25.0, 60.0, 100.0}) {
+            windingLosses.calculate_losses(magnetic, operatingPoint, temperature);
+        }
+    }, 3);
+    CHECK(measurement.counters[to_string(WorkCounter::WINDING_LOSSES_EVALUATION)].get<uint64_t>() >= 3);
+    check_against_baseline("winding_losses", measurement);
+}
+
+TEST_CASE("Test_Performance_Temperature", "[performance][heavy]") {
+    auto magnetic = make_two_winding_magnetic();
+    auto measurement = measure([&magnetic]() {
+        TemperatureConfig config;
+        config.ambientTemperature = 25.0;
+        config.coreLosses = 0.5;
+        config.windingLosses = 0.3;
+        Temperature temperature(magnetic, config);
+        temperature.calculateTemperatures();
+    }, 3);
+    CHECK(measurement.counters[to_string(WorkCounter::TEMPERATURE_SOLVE)].get<uint64_t>() == 1);
+    check_against_baseline("temperature", measurement);
+}
+
+TEST_CASE("Test_Performance_Magnetic_Simulator", "[performance][heavy]") {
+    auto magnetic = make_two_winding_magnetic();
+    auto inputs = make_two_winding_inputs();
+    auto measurement = measure([&magnetic, &inputs]() {
+        MagneticSimulator magneticSimulator;
+        magneticSimulator.simulate(inputs, magnetic);
+    }, 3);
+    CHECK(measurement.counters[to_string(WorkCounter::CORE_LOSSES_EVALUATION)].get<uint64_t>() >= 1);
+    check_against_baseline("magnetic_simulator", measurement);
+}
+
+TEST_CASE("Test_Performance_Coil_Adviser", "[performance][heavy]") {
+    auto mas = make_flyback_fixture();
+    auto measurement = measure([&mas]() {
+        CoilAdviser coilAdviser;
+        coilAdviser.get_advised_coil(mas, 2);
+    }, 1);
+    CHECK(measurement.counters[to_string(WorkCounter::COIL_WIND)].get<uint64_t>() >= 1);
+    check_against_baseline("coil_adviser", measurement);
+}
+
+TEST_CASE("Test_Performance_Magnetic_Adviser", "[performance][heavy]") {
+    auto inputs = make_two_winding_inputs();
+    inputs.process();
+    auto measurement = measure([&inputs]() {
+        MagneticAdviser magneticAdviser;
+        magneticAdviser.get_advised_magnetic(inputs, 1);
+    }, 1);
+    // Counted in the models, so the scoring filters' direct calls show up too.
+    CHECK(measurement.counters[to_string(WorkCounter::CORE_LOSSES_EVALUATION)].get<uint64_t>() >= 1);
+    check_against_baseline("magnetic_adviser", measurement);
+}
@@ -5,6 +5,7 @@
 #include "physical_models/AmplitudePermeability.h"
 #include "support/Painter.h"
 #include "support/Utils.h"
+#include "support/Exceptions.h"
 #include "json.hpp"
 
 #include <catch2/catch_test_macros.hpp>
@@ -444,6 +445,24 @@ namespace {
         REQUIRE(complexPermeabilityValueAt100000.second < complexPermeabilityValueAt10000000.second);
     }
 
+    TEST_CASE("Test_Complex_Permeability_Batched_Matches_Single_Point", "[physical-model][complex-permeability]") {
+        ComplexPermeability complexPermeability;
+        auto coreMaterial = find_core_material_by_name("3C97");
+        // Well past both ends of the measured data, so the clamping is covered too.
+        auto frequencies = logarithmic_spaced_array(1, 1e10, 200);
+        std::vector<double> realParts(frequencies.size());
+        std::vector<double> imaginaryParts(frequencies.size());
+        complexPermeability.get_complex_permeability(coreMaterial, frequencies, realParts, imaginaryParts);
+        for (size_t index = 0; index < frequencies.size(); ++index) {
+            auto [real, imaginary] = complexPermeability.get_complex_permeability(coreMaterial, frequencies[index]);
+            CHECK(realParts[index] == real);
+            CHECK(imaginaryParts[index] == imaginary);
+        }
+
+        std::vector<double> tooShort(frequencies.size() - 1);
+        REQUIRE_THROWS_AS(complexPermeability.get_complex_permeability(coreMaterial, frequencies, tooShort, imaginaryParts), InvalidInputException);
+    }
+
     // ABT #169: POCO NPF materials carry a fitted poco frequencyFactor (from
     // the POCO catalog V2026 permeability-vs-frequency curves), which both
     // makes mu_i(f) frequency-dependent and unlocks the Mueller complex-
@@ -4,6 +4,7 @@
 #include "TestingUtils.h"
 
 #include <cmath>
+#include <catch2/benchmark/catch_benchmark.hpp>
 #include <catch2/catch_test_macros.hpp>
 #include <catch2/generators/catch_generators.hpp>
 #include <catch2/matchers/catch_matchers_floating_point.hpp>
@@ -550,3 +551,71 @@ TEST_CASE("Test_Annular_Clearance_Reluctance_Drum_Ring", "[physical-model][reluc
                    Catch::Matchers::WithinRel(2 * oneGap, 0.01));
     }
 }
+
+TEST_CASE("Test_Reluctance_Model_Handle_Matches_Factory", "[physical-model][reluctance][smoke-test]") {
+    CoreGap coreGap(json::parse(R"({"area":0.000123,"coordinates":[0,0.0005,0],"distanceClosestNormalSurface":0.014098,"distanceClosestParallelSurface":0.0088,"length":0.0005,"sectionDimensions":[0.0125,0.0125],"shape":"round","type":"subtractive"})"));
+    auto core = OpenMagneticsTesting::get_quick_core("E 42/21/20", OpenMagneticsTesting::get_ground_gap(0.001));
+
+    for (auto modelName : magic_enum::enum_values<ReluctanceModels>()) {
+        INFO(magic_enum::enum_name(modelName));
+        auto factoryModel = ReluctanceModel::factory(modelName);
+        ReluctanceModelHandle handle(modelName);
+        CHECK(handle.get_model_name() == modelName);
+
+        auto expectedGap = factoryModel->get_gap_reluctance(coreGap);
+        auto gap = handle.get_gap_reluctance(coreGap);
+        CHECK(gap.get_reluctance() == expectedGap.get_reluctance());
+        CHECK(gap.get_fringing_factor() == expectedGap.get_fringing_factor());
+        CHECK(handle->get_gap_reluctance(coreGap).get_reluctance() == expectedGap.get_reluctance());
+
+        double expectedCore = factoryModel->get_core_reluctance(core, 2000.0).get_core_reluctance();
+        CHECK(handle->get_core_reluctance(core, 2000.0).get_core_reluctance() == expectedCore);
+
+        auto copy = handle;
+        CHECK(copy.get_gap_reluctance(coreGap).get_reluctance() == expectedGap.get_reluctance());
+    }
+
+    std::map<std::string, std::string> models = {{"gapReluctance", "Stenglein"}};
+    CHECK(ReluctanceModelHandle(models).get_model_name() == ReluctanceModels::STENGLEIN);
+    CHECK(ReluctanceModelHandle().get_model_name() == Defaults().reluctanceModelDefault);
+}
+
+TEST_CASE("Benchmark_Reluctance_Model_Handle_Versus_Factory", "[physical-model][reluctance][!benchmark]") {
+    CoreGap coreGap(json::parse(R"({"area":0.000123,"coordinates":[0,0.0005,0],"distanceClosestNormalSurface":0.014098,"distanceClosestParallelSurface":0.0088,"length":0.0005,"sectionDimensions":[0.0125,0.0125],"shape":"round","type":"subtractive"})"));
+    auto core = OpenMagneticsTesting::get_quick_core("E 42/21/20", OpenMagneticsTesting::get_ground_gap(0.001));
+    const size_t numberEvaluations = 100;
+
+    // The pattern the hot loops used to follow: resolve the model on every request.
+    BENCHMARK("factory per gap") {
+        double reluctance = 0;
+        for (size_t index = 0; index < numberEvaluations; ++index) {
+            auto model = ReluctanceModel::factory(ReluctanceModels::ZHANG);
+            reluctance += model->get_gap_reluctance(coreGap).get_reluctance();
+        }
+        return reluctance;
+    };
+    BENCHMARK("handle per gap") {
+        ReluctanceModelHandle handle(ReluctanceModels::ZHANG);
+        double reluctance = 0;
+        for (size_t index = 0; index < numberEvaluations; ++index) {
+            reluctance += handle.get_gap_reluctance(coreGap).get_reluctance();
+        }
+        return reluctance;
+    };
+    BENCHMARK("factory per core") {
+        double reluctance = 0;
+        for (size_t index = 0; index < numberEvaluations; ++index) {
+            auto model = ReluctanceModel::factory(ReluctanceModels::ZHANG);
+            reluctance += model->get_core_reluctance(core, 2000.0).get_core_reluctance();
+        }
+        return reluctance;
+    };
+    BENCHMARK("handle per core") {
+        ReluctanceModelHandle handle(ReluctanceModels::ZHANG);
+        double reluctance = 0;
+        for (size_t index = 0; index < numberEvaluations; ++index) {
+            reluctance += handle->get_core_reluctance(core, 2000.0).get_core_reluctance();
+        }
+        return reluctance;
+    };
+}
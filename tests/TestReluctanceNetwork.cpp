@@ -6,11 +6,13 @@
 #include "physical_models/WindingLosses.h"
 #include "processors/Inputs.h"
 #include "support/Painter.h"
+#include <algorithm>
 #include <filesystem>
 #include <source_location>
 #include "constructive_models/Core.h"
 #include "constructive_models/Bobbin.h"
 #include "support/Settings.h"
+#include "support/Exceptions.h"
 #include "advisers/CoilAdviser.h"
 #include "TestingUtils.h"
 #include "json.hpp"
@@ -148,6 +150,77 @@ TEST_CASE("ReluctanceNetwork_LateralPlacement_FluxDividerCoupling", "[physical-m
     CHECK(std::abs(columnFluxDensities[mainColumnIndex]) > 0);
 }
 
+TEST_CASE("ReluctanceNetwork_Factorized_Solves_Match_Nodal_Reference", "[physical-model][magnetic-circuit][multi-column][smoke-test]") {
+    auto magnetic = buildTwoWindingMagnetic(2);
+    auto core = magnetic.get_core();
+    auto circuit = buildCircuit(core);
+    auto columnIndexes = ReluctanceNetwork::resolve_winding_column_indexes(magnetic);
+    size_t mainColumnIndex = circuit.get_main_column_index();
+    REQUIRE(columnIndexes[0] == mainColumnIndex);
+    REQUIRE(columnIndexes[1] != mainColumnIndex);
+
+    auto columnReluctances = circuit.get_column_reluctances();
+    auto yokeReluctances = circuit.get_yoke_segment_reluctances();
+    auto orderedColumns = circuit.get_ordered_column_indexes();
+    REQUIRE(columnReluctances.size() == 3);
+    REQUIRE(yokeReluctances.size() == 2);
+
+    // Independent of the factorized mesh: each leg is a branch between the two
+    // yoke nodes (a lateral leg with its yoke segment in series) with its own MMF
+    // source, so the node potential is U = sum(F/R) / sum(1/R) and each branch
+    // carries (F - U) / R.
+    auto yokeBetween = [&](size_t columnA, size_t columnB) {
+        for (size_t segmentIndex = 0; segmentIndex + 1 < orderedColumns.size(); ++segmentIndex) {
+            if ((orderedColumns[segmentIndex] == columnA && orderedColumns[segmentIndex + 1] == columnB) ||
+                (orderedColumns[segmentIndex] == columnB && orderedColumns[segmentIndex + 1] == columnA)) {
+                return yokeReluctances[segmentIndex];
+            }
+        }
+        throw std::runtime_error("no yoke segment between requested columns");
+    };
+    std::vector<double> branchReluctances(3, 0);
+    for (size_t columnIndex = 0; columnIndex < 3; ++columnIndex) {
+        branchReluctances[columnIndex] = columnReluctances[columnIndex];
+        if (columnIndex != mainColumnIndex) {
+            branchReluctances[columnIndex] += yokeBetween(mainColumnIndex, columnIndex);
+        }
+    }
+
+    // Several samples of a two-winding current waveform, each solved against the
+    // network's single factorization.
+    auto columns = core.get_columns();
+    std::vector<std::vector<double>> windingCurrentsPerSample{{1.0, 0.0}, {0.0, 1.0}, {0.5, -2.0}, {-3.0, 0.25}};
+    for (auto& windingCurrents : windingCurrentsPerSample) {
+        std::vector<double> branchMagnetomotiveForces(3, 0);
+        branchMagnetomotiveForces[columnIndexes[0]] += 20.0 * windingCurrents[0];
+        branchMagnetomotiveForces[columnIndexes[1]] += 10.0 * windingCurrents[1];
+        double weightedSum = 0;
+        double conductanceSum = 0;
+        for (size_t columnIndex = 0; columnIndex < 3; ++columnIndex) {
+            weightedSum += branchMagnetomotiveForces[columnIndex] / branchReluctances[columnIndex];
+            conductanceSum += 1 / branchReluctances[columnIndex];
+        }
+        double nodePotential = weightedSum / conductanceSum;
+
+        auto columnFluxes = circuit.calculate_column_magnetic_fluxes(magnetic, windingCurrents);
+        auto columnFluxDensities = circuit.calculate_column_magnetic_flux_densities(magnetic, windingCurrents);
+        REQUIRE(columnFluxes.size() == 3);
+        REQUIRE(columnFluxDensities.size() == 3);
+        double fluxScale = 0;
+        for (size_t columnIndex = 0; columnIndex < 3; ++columnIndex) {
+            fluxScale = std::max(fluxScale, std::abs(branchMagnetomotiveForces[columnIndex] / branchReluctances[columnIndex]));
+        }
+        for (size_t columnIndex = 0; columnIndex < 3; ++columnIndex) {
+            double expectedFlux = (branchMagnetomotiveForces[columnIndex] - nodePotential) / branchReluctances[columnIndex];
+            double area = columns[columnIndex].get_area();
+            CHECK_THAT(columnFluxes[columnIndex], Catch::Matchers::WithinAbs(expectedFlux, fluxScale * 1e-9));
+            CHECK_THAT(columnFluxDensities[columnIndex], Catch::Matchers::WithinAbs(expectedFlux / area, fluxScale / area * 1e-9));
+        }
+    }
+
+    CHECK_THROWS_AS(circuit.calculate_column_magnetic_fluxes(magnetic, {1.0}), InvalidInputException);
+}
+
 TEST_CASE("ReluctanceNetwork_MagnetizingInductance_PlacementGate", "[physical-model][magnetic-circuit][multi-column][smoke-test]") {
     // Placing the SECONDARY on a lateral leg must not change the primary's
     // magnetizing inductance (its driving-point reluctance is unchanged), and the
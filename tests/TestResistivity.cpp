@@ -2,6 +2,7 @@
 #include "support/Utils.h"
 #include "constructive_models/Core.h"
 
+#include <catch2/benchmark/catch_benchmark.hpp>
 #include <catch2/catch_test_macros.hpp>
 #include <catch2/matchers/catch_matchers_floating_point.hpp>
 #include <filesystem>
@@ -83,4 +84,44 @@ namespace {
         REQUIRE_THAT(resistivity, Catch::Matchers::WithinAbs(expectedResistivity, expectedResistivity * maximumError));
     }
 
+    TEST_CASE("Test_Resistivity_Shared_Model_Matches_Factory", "[physical-model][resistivity][smoke-test]") {
+        auto coreMaterial = find_core_material_by_name("3C94");
+        auto wireMaterial = find_wire_material_by_name("copper");
+
+        auto& sharedCoreModel = ResistivityModel::get_shared(ResistivityModels::CORE_MATERIAL);
+        auto& sharedWireModel = ResistivityModel::get_shared(ResistivityModels::WIRE_MATERIAL);
+        CHECK(sharedCoreModel.get() == ResistivityModel::get_shared(ResistivityModels::CORE_MATERIAL).get());
+        CHECK(sharedWireModel.get() == ResistivityModel::get_shared(ResistivityModels::WIRE_MATERIAL).get());
+
+        for (double temperature : {20.0, 42.0, 200.0}) {
+            CHECK(sharedCoreModel->get_resistivity(coreMaterial, temperature) ==
+                  ResistivityModel::factory(ResistivityModels::CORE_MATERIAL)->get_resistivity(coreMaterial, temperature));
+            CHECK(sharedWireModel->get_resistivity(wireMaterial, temperature) ==
+                  ResistivityModel::factory(ResistivityModels::WIRE_MATERIAL)->get_resistivity(wireMaterial, temperature));
+        }
+    }
+
+    TEST_CASE("Benchmark_Resistivity_Shared_Model_Versus_Factory", "[physical-model][resistivity][!benchmark]") {
+        auto wireMaterial = find_wire_material_by_name("copper");
+        const size_t numberEvaluations = 100;
+
+        // The pattern the DC-resistance paths used to follow: one factory call per wire.
+        BENCHMARK("factory per wire") {
+            double resistivity = 0;
+            for (size_t index = 0; index < numberEvaluations; ++index) {
+                auto model = ResistivityModel::factory(ResistivityModels::WIRE_MATERIAL);
+                resistivity += model->get_resistivity(wireMaterial, 20 + index);
+            }
+            return resistivity;
+        };
+        BENCHMARK("shared model per wire") {
+            double resistivity = 0;
+            for (size_t index = 0; index < numberEvaluations; ++index) {
+                auto& model = ResistivityModel::get_shared(ResistivityModels::WIRE_MATERIAL);
+                resistivity += model->get_resistivity(wireMaterial, 20 + index);
+            }
+            return resistivity;
+        };
+    }
+
 }  // namespace
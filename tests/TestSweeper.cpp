@@ -8,6 +8,7 @@
 #include "support/Settings.h"
 #include "TestingUtils.h"
 #include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
 #include <catch2/matchers/catch_matchers_floating_point.hpp>
 
 using namespace MAS;
@@ -1094,5 +1095,74 @@ namespace {
         settings.reset();
     }
 
+    OpenMagnetics::Magnetic make_parallel_sweep_magnetic() {
+        std::vector<int64_t> numberTurns = {80, 8};
+        std::vector<int64_t> numberParallels = {1, 2};
+        std::string shapeName = "ER 28";
+        std::vector<OpenMagnetics::Wire> wires{find_wire_by_name("Round 0.25 - FIW 6"), find_wire_by_name("Round T21A01TXXX-1")};
+        auto coil = OpenMagneticsTesting::get_quick_coil(numberTurns,
+                                                         numberParallels,
+                                                         shapeName,
+                                                         1,
+                                                         WindingOrientation::OVERLAPPING,
+                                                         WindingOrientation::OVERLAPPING,
+                                                         CoilAlignment::SPREAD,
+                                                         CoilAlignment::CENTERED,
+                                                         wires,
+                                                         true);
+        auto core = OpenMagneticsTesting::get_quick_core(shapeName, OpenMagneticsTesting::get_ground_gap(0.0005), 1, "3C95");
+        OpenMagnetics::Magnetic magnetic;
+        magnetic.set_core(core);
+        magnetic.set_coil(coil);
+        return magnetic;
+    }
+
+    TEST_CASE("Test_Sweeper_Parallel_Bit_Identical_To_Serial", "[processor][sweeper][concurrency]") {
+        settings.reset();
+        auto magnetic = make_parallel_sweep_magnetic();
+        auto operatingPoint = OpenMagnetics::Inputs::create_quick_operating_point(
+            100000, 10e-5, 25, WaveformLabel::TRIANGULAR, 100, 0.5, 0, {10}).get_operating_points()[0];
+
+        auto run_sweeps = [&]() {
+            std::vector<std::vector<double>> curves;
+            curves.push_back(Sweeper::sweep_impedance_over_frequency(magnetic, 1000, 10000000, 64).get_y_points());
+            curves.push_back(Sweeper::sweep_winding_resistance_over_frequency(magnetic, 1000, 1000000, 32, 0).get_y_points());
+            curves.push_back(Sweeper::sweep_magnetizing_inductance_over_frequency(magnetic, 1000, 1000000, 32).get_y_points());
+            curves.push_back(Sweeper::sweep_core_losses_over_frequency(magnetic, operatingPoint, 50000, 500000, 16).get_y_points());
+            curves.push_back(Sweeper::sweep_winding_losses_over_frequency(magnetic, operatingPoint, 50000, 500000, 16).get_y_points());
+            return curves;
+        };
+
+        settings.set_parallel_number_threads(1);
+        auto serialCurves = run_sweeps();
+        settings.set_parallel_number_threads(4);
+        auto parallelCurves = run_sweeps();
+
+        REQUIRE(serialCurves.size() == parallelCurves.size());
+        for (size_t curveIndex = 0; curveIndex < serialCurves.size(); ++curveIndex) {
+            REQUIRE(!serialCurves[curveIndex].empty());
+            // Exact comparison on purpose: every point is computed by the same
+            // code on its own copy of the inputs, whatever thread it runs on.
+            CHECK(serialCurves[curveIndex] == parallelCurves[curveIndex]);
+        }
+        settings.reset();
+    }
+
+    // Use:  ./MKF_tests "[benchmark-sweeper]" --benchmark-samples 3 --benchmark-warmup-time 0
+    TEST_CASE("Benchmark Sweeper winding resistance 500 points", "[processor][sweeper][!benchmark][benchmark-sweeper]") {
+        settings.reset();
+        auto magnetic = make_parallel_sweep_magnetic();
+
+        settings.set_parallel_number_threads(1);
+        BENCHMARK("sweep_winding_resistance_over_frequency serial") {
+            return Sweeper::sweep_winding_resistance_over_frequency(magnetic, 1000, 10000000, 500, 0);
+        };
+        settings.set_parallel_number_threads(0);
+        BENCHMARK("sweep_winding_resistance_over_frequency parallel") {
+            return Sweeper::sweep_winding_resistance_over_frequency(magnetic, 1000, 10000000, 500, 0);
+        };
+        settings.reset();
+    }
+
 }  // namespace
  
\ No newline at end of file
@@ -1,4 +1,5 @@
 #include "physical_models/WindingSkinEffectLosses.h"
+#include "support/Settings.h"
 #include "support/Utils.h"
 #include "constructive_models/Core.h"
 
@@ -48,6 +49,30 @@ namespace {
         double expectedSkinDepth = 220e-6;
         REQUIRE_THAT(skinDepth, Catch::Matchers::WithinAbs(expectedSkinDepth, expectedSkinDepth * maximumError));
     }
+
+    TEST_CASE("Test_Skin_Factor_Tabulated_Within_Tolerance", "[physical-model][skin-losses][tabulated]") {
+        settings.reset();
+        auto wire = find_wire_by_name("Round 0.5 - Grade 1");
+        auto exactModel = WindingSkinEffectLossesModel::factory(WindingSkinEffectLossesModels::DOWELL);
+        settings.set_winding_losses_tabulated(true);
+        double tolerance = settings.get_winding_losses_tabulated_tolerance();
+        auto tabulatedModel = WindingSkinEffectLossesModel::factory(WindingSkinEffectLossesModels::DOWELL);
+
+        // With a unit DC loss, turn losses are FR - 1. None of these points is a table node.
+        for (double frequency : {7300.0, 63000.0, 171000.0, 1.37e6}) {
+            for (double temperature : {23.0, 67.0, 118.0}) {
+                INFO("f " << frequency << ", T " << temperature);
+                settings.set_winding_losses_tabulated(false);
+                double exactSkinFactor = 1 + exactModel->calculate_turn_losses(wire, 1, frequency, temperature);
+                settings.set_winding_losses_tabulated(true);
+                double tabulatedSkinFactor = 1 + tabulatedModel->calculate_turn_losses(wire, 1, frequency, temperature);
+                CHECK_THAT(tabulatedSkinFactor, Catch::Matchers::WithinRel(exactSkinFactor, tolerance));
+                CHECK(tabulatedModel->calculate_turn_losses(wire, 1, frequency, temperature) == tabulatedSkinFactor - 1);
+            }
+        }
+        settings.reset();
+    }
+
 // End of SUITE
 
 }  // namespace